@@ -0,0 +1,52 @@
+from paraview import servermanager
+import paraview.simple as smp
+from paraview.modules.vtkRemotingCore import vtkPVSession, vtkTCPNetworkAccessManager
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+
+def getHost(url):
+   return url.split(':')[1][2:]
+
+
+def getPort(url):
+   return int(url.split(':')[2])
+
+def runTest():
+
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    url = options.GetServerURL()
+
+    smp.Connect(getHost(url), getPort(url))
+
+    # Both the client and the server request data sockets, so bulk data is
+    # striped across them.
+    controller = servermanager.ActiveConnection.Session.GetController(vtkPVSession.DATA_SERVER)
+    assert vtkTCPNetworkAccessManager.GetNumberOfDataSockets(controller) > 0
+
+    # A few MB of geometry, well above the smallest striped payload.
+    sphere = smp.Sphere(ThetaResolution=400, PhiResolution=400)
+    sphere.UpdatePipeline()
+    info = sphere.GetDataInformation()
+
+    # Delivered by vtkClientServerMoveData.
+    data = servermanager.Fetch(sphere)
+    assert data.GetNumberOfPoints() == info.GetNumberOfPoints()
+    assert data.GetNumberOfCells() == info.GetNumberOfCells()
+
+    # Delivered by vtkMPIMoveData for rendering, then fetched again to check
+    # the connection is still in sync.
+    view = smp.CreateRenderView()
+    smp.Show(sphere, view)
+    smp.Render(view)
+
+    elevation = smp.Elevation(Input=sphere)
+    data = servermanager.Fetch(elevation)
+    assert data.GetNumberOfPoints() == info.GetNumberOfPoints()
+    assert data.GetPointData().GetArray("Elevation") is not None
+
+    smp.Disconnect()
+
+
+runTest()
@@ -22,7 +22,8 @@ static const int NO_COMPRESSION = 0;
 static const int LZ4_COMPRESSION = 1;
 static const int SQUIRT_COMPRESSION = 2;
 static const int ZLIB_COMPRESSION = 3;
-static const int NVPIPE_COMPRESSION = 4;
+static const int DELTA_COMPRESSION = 4;
+static const int NVPIPE_COMPRESSION = 5;
 //-----------------------------------------------------------------------------
 
 class pqImageCompressorWidget::pqInternals
@@ -104,6 +105,12 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
                     "\\s+"     // space
                     "([0-9]+)" // num-of-bits.
                     "$");
+  QRegExp deltaRegExp("^vtkDeltaImageCompressor"
+                      "\\s+"     // space
+                      "0"        // 0
+                      "\\s+"     // space
+                      "([0-9]+)" // num-of-bits.
+                      "$");
   QRegExp nvpipeRegExp("^vtkNvPipeCompressor"
                        "\\s+"     // space
                        "0"        // 0
@@ -117,6 +124,12 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
     ui.compressionType->setCurrentIndex(LZ4_COMPRESSION);
     ui.squirtColorSpace->setValue(numBits);
   }
+  else if (deltaRegExp.exactMatch(value))
+  {
+    int numBits = deltaRegExp.cap(1).toInt();
+    ui.compressionType->setCurrentIndex(DELTA_COMPRESSION);
+    ui.squirtColorSpace->setValue(numBits);
+  }
   else if (squirtRegExp.exactMatch(value))
   {
     int numBits = squirtRegExp.cap(1).toInt();
@@ -154,6 +167,9 @@ QString pqImageCompressorWidget::compressorConfig() const
     case LZ4_COMPRESSION:
       return QString("vtkLZ4Compressor 0 %1").arg(ui.squirtColorSpace->value());
 
+    case DELTA_COMPRESSION:
+      return QString("vtkDeltaImageCompressor 0 %1").arg(ui.squirtColorSpace->value());
+
     case SQUIRT_COMPRESSION: // squirt
       return QString("vtkSquirtCompressor 0 %1").arg(ui.squirtColorSpace->value());
 
@@ -174,8 +190,10 @@ QString pqImageCompressorWidget::compressorConfig() const
 void pqImageCompressorWidget::currentIndexChanged(int index)
 {
   Ui::ImageCompressorWidget& ui = this->Internals->Ui;
-  ui.squirtLabel->setVisible(index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION);
-  ui.squirtColorSpace->setVisible(index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION);
+  const bool useColorSpace =
+    index == SQUIRT_COMPRESSION || index == LZ4_COMPRESSION || index == DELTA_COMPRESSION;
+  ui.squirtLabel->setVisible(useColorSpace);
+  ui.squirtColorSpace->setVisible(useColorSpace);
 
   ui.zlibLabel1->setVisible(index == ZLIB_COMPRESSION);
   ui.zlibLabel2->setVisible(index == ZLIB_COMPRESSION);
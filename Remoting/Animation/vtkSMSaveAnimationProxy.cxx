@@ -12,6 +12,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPVProgressHandler.h"
 #include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
 #include "vtkRemoteWriterHelper.h"
 #include "vtkRenderWindow.h"
 #include "vtkSMAnimationScene.h"
@@ -25,9 +26,11 @@
 #include "vtkSMViewLayoutProxy.h"
 #include "vtkSMViewProxy.h"
 #include "vtkStringFormatter.h"
+#include "vtkThreadedCallbackQueue.h"
 
 #include <algorithm>
 #include <sstream>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 namespace vtkSMSaveAnimationProxyNS
@@ -237,6 +240,18 @@ class SceneImageWriterImageSeries : public SceneImageWriter
 {
   vtkSmartPointer<vtkSMSourceProxy> RemoteWriterHelper = nullptr;
 
+  // Writers used to write images in the background. Each one writes at most
+  // one image at a time.
+  struct BackgroundWriter
+  {
+    vtkSmartPointer<vtkSMProxy> Format;
+    vtkSmartPointer<vtkSMSourceProxy> RemoteWriterHelper;
+    std::string FileName;
+  };
+  std::vector<BackgroundWriter> BackgroundWriters;
+  std::size_t NextBackgroundWriter = 0;
+  bool BackgroundWritesSucceeded = true;
+
 public:
   static SceneImageWriterImageSeries* New();
   vtkTypeMacro(SceneImageWriterImageSeries, SceneImageWriter);
@@ -267,6 +282,33 @@ public:
     this->RemoteWriterHelper = this->GetRemoteWriterHelper(formatProxy, location);
   }
 
+  /**
+   * Encode and write images in the background, on the threads of
+   * vtkProcessModule::GetCallbackQueue(), while the next frames render.
+   * `count` copies of the format proxy are used in turn, and writing a frame
+   * waits for the copy it uses to be done with its previous image, so at most
+   * `count` images are kept in memory. Only supported for images written on
+   * the client.
+   */
+  void SetBackgroundWriters(vtkSMProxy* formatProxy, int count)
+  {
+    this->BackgroundWriters.clear();
+    const auto pxm = formatProxy->GetSessionProxyManager();
+    for (int cc = 0; cc < count; ++cc)
+    {
+      BackgroundWriter writer;
+      writer.Format.TakeReference(
+        pxm->NewProxy(formatProxy->GetXMLGroup(), formatProxy->GetXMLName()));
+      writer.Format->SetLocation(formatProxy->GetLocation());
+      writer.Format->Copy(formatProxy);
+      writer.Format->UpdateVTKObjects();
+      writer.RemoteWriterHelper = this->GetRemoteWriterHelper(writer.Format, vtkPVSession::CLIENT);
+      vtkSMPropertyHelper(writer.RemoteWriterHelper, "TryWritingInBackground").Set(1);
+      writer.RemoteWriterHelper->UpdateVTKObjects();
+      this->BackgroundWriters.push_back(writer);
+    }
+  }
+
 protected:
   SceneImageWriterImageSeries()
     : Counter(0)
@@ -278,6 +320,8 @@ protected:
   bool SaveInitialize(int startCount) override
   {
     this->Counter = startCount;
+    this->NextBackgroundWriter = 0;
+    this->BackgroundWritesSucceeded = true;
     auto path = vtksys::SystemTools::GetFilenamePath(this->FileName);
     auto prefix = vtksys::SystemTools::GetFilenameWithoutLastExtension(this->FileName);
     this->Prefix = path.empty() ? prefix : path + "/" + prefix;
@@ -306,6 +350,22 @@ protected:
     str << this->Prefix << buffer << this->Extension;
 
     const std::string filename = str.str();
+    if (!this->BackgroundWriters.empty())
+    {
+      if (dataRight)
+      {
+        this->WriteInBackground(this->GetStereoFileName(filename, /*left=*/false), dataRight);
+        this->WriteInBackground(this->GetStereoFileName(filename, /*left=*/true), dataLeft);
+      }
+      else
+      {
+        this->WriteInBackground(filename, dataLeft);
+      }
+      // errors are reported once the images are written, by SaveFinalize().
+      this->Counter += this->Stride;
+      return this->BackgroundWritesSucceeded;
+    }
+
     if (dataRight)
     {
       // write right image.
@@ -349,6 +409,50 @@ protected:
     return success;
   }
 
+  bool SaveFinalize() override
+  {
+    for (auto& writer : this->BackgroundWriters)
+    {
+      this->WaitForBackgroundWriter(writer);
+    }
+    return this->Superclass::SaveFinalize() && this->BackgroundWritesSucceeded;
+  }
+
+  void WriteInBackground(const std::string& filename, vtkImageData* data)
+  {
+    auto& writer = this->BackgroundWriters[this->NextBackgroundWriter];
+    this->NextBackgroundWriter = (this->NextBackgroundWriter + 1) % this->BackgroundWriters.size();
+
+    // the writer may still be writing an earlier frame.
+    this->WaitForBackgroundWriter(writer);
+
+    vtkSMPropertyHelper(writer.Format, "FileName").Set(filename.c_str());
+    writer.Format->UpdateVTKObjects();
+    auto remoteWriterAlgorithm =
+      vtkAlgorithm::SafeDownCast(writer.RemoteWriterHelper->GetClientSideObject());
+    remoteWriterAlgorithm->SetInputDataObject(data);
+    vtkSMPropertyHelper(writer.RemoteWriterHelper, "State").Set(vtkRemoteWriterHelper::WRITE);
+    writer.RemoteWriterHelper->UpdateVTKObjects();
+    writer.RemoteWriterHelper->UpdatePipeline();
+    remoteWriterAlgorithm->SetInputDataObject(nullptr);
+    writer.FileName = filename;
+  }
+
+  void WaitForBackgroundWriter(BackgroundWriter& writer)
+  {
+    if (!writer.FileName.empty())
+    {
+      vtkRemoteWriterHelper::Wait(writer.FileName);
+      auto imageWriter = vtkAlgorithm::SafeDownCast(writer.Format->GetClientSideObject());
+      if (imageWriter->GetErrorCode() != vtkErrorCode::NoError)
+      {
+        vtkErrorMacro("Failed to write '" << writer.FileName << "'.");
+        this->BackgroundWritesSucceeded = false;
+      }
+      writer.FileName.clear();
+    }
+  }
+
 private:
   SceneImageWriterImageSeries(const SceneImageWriterImageSeries&) = delete;
   void operator=(const SceneImageWriterImageSeries&) = delete;
@@ -514,6 +618,15 @@ bool vtkSMSaveAnimationProxy::WriteAnimationInternal(const char* filename, vtkTy
     realWriter->SetSuffixFormat(vtkSMPropertyHelper(formatProxy, "SuffixFormat").GetAsString());
     realWriter->SetHelper(this);
     realWriter->SetFormatProxy(formatProxy, location);
+    if (location == vtkPVSession::CLIENT &&
+      vtkSMPropertyHelper(this, "SaveInBackground", /*quiet=*/true).GetAsInt() != 0)
+    {
+      // one image being written per thread, and one more waiting, so that
+      // threads do not idle while the next frame renders.
+      const int numberOfThreads =
+        vtkProcessModule::GetProcessModule()->GetCallbackQueue()->GetNumberOfThreads();
+      realWriter->SetBackgroundWriters(formatProxy, std::max(numberOfThreads, 1) + 1);
+    }
     writer = realWriter;
   }
   else if (vtkGenericMovieWriter::SafeDownCast(formatObj))
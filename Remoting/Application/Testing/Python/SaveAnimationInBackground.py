@@ -0,0 +1,61 @@
+from paraview.simple import *
+from paraview import smtesting
+
+import os
+import os.path
+
+smtesting.ProcessCommandLineArguments()
+
+tempdir = smtesting.GetUniqueTempDirectory("SaveAnimationInBackground-")
+print("Generating output files in `%s`" % tempdir)
+
+# Several background writers, so that frames are written out of order.
+GetSettingsProxy("GeneralSettings").NumberOfCallbackThreads = 4
+
+view = CreateView("RenderView")
+view.ViewSize = [300, 300]
+
+sphere = Sphere(ThetaResolution=64, PhiResolution=64)
+Show(sphere, view)
+view.ResetCamera()
+
+# Every frame differs from the others.
+track = GetAnimationTrack("Radius", proxy=sphere)
+track.KeyFrames = [CompositeKeyFrame(KeyTime=0, KeyValues=[0.1]),
+                   CompositeKeyFrame(KeyTime=1, KeyValues=[0.5])]
+
+scene = GetAnimationScene()
+scene.PlayMode = "Sequence"
+scene.NumberOfFrames = 20
+
+# Frames written one after the other are the reference.
+SaveAnimation(tempdir + "/Serial.png", view, ImageResolution=[300, 300], SaveInBackground=0)
+SaveAnimation(tempdir + "/Background.png", view, ImageResolution=[300, 300],
+              SaveInBackground=1)
+SaveAnimation(tempdir + "/BackgroundStereo.png", view, ImageResolution=[300, 300],
+              StereoMode="Both Eyes", SaveInBackground=1)
+
+pm = servermanager.vtkProcessModule.GetProcessModule()
+if pm.GetPartitionId() == 0:
+    def readFrame(name):
+        with open(os.path.join(tempdir, name), "rb") as f:
+            data = f.read()
+        # a PNG file ends with its IEND chunk.
+        if data[-8:-4] != b"IEND":
+            raise RuntimeError("Incomplete frame `%s`" % name)
+        return data
+
+    # All the frames are complete when SaveAnimation returns, and are the
+    # same as the ones written serially.
+    for frame in range(scene.NumberOfFrames):
+        reference = readFrame("Serial.%04d.png" % frame)
+        if readFrame("Background.%04d.png" % frame) != reference:
+            raise RuntimeError("Frame %d differs from the serial one" % frame)
+        if frame > 0 and reference == readFrame("Serial.%04d.png" % (frame - 1)):
+            raise RuntimeError("Frames %d and %d are the same" % (frame - 1, frame))
+        readFrame("BackgroundStereo.%04d_left.png" % frame)
+        readFrame("BackgroundStereo.%04d_right.png" % frame)
+
+    names = [name for name in os.listdir(tempdir) if name.startswith("Background.")]
+    if len(names) != scene.NumberOfFrames:
+        raise RuntimeError("Expected %d frames, got %d" % (scene.NumberOfFrames, len(names)))
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+// Micro-benchmark for the vtkClientServerInterpreter method dispatch cache.
+// The command functions below mimic the ones generated by
+// vtkWrapClientServer: a chain of strcmp calls followed by a fallback to the
+// command function of the superclass. Also checks that overloads of a
+// subclass and its superclass are not mixed up by the cache.
+
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerStream.h"
+#include "vtkCollection.h"
+#include "vtkNew.h"
+#include "vtkObject.h"
+#include "vtkObjectFactory.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+class vtkMethodCacheDerived : public vtkObject
+{
+public:
+  static vtkMethodCacheDerived* New();
+  vtkTypeMacro(vtkMethodCacheDerived, vtkObject);
+
+protected:
+  vtkMethodCacheDerived() = default;
+  ~vtkMethodCacheDerived() override = default;
+
+private:
+  vtkMethodCacheDerived(const vtkMethodCacheDerived&) = delete;
+  void operator=(const vtkMethodCacheDerived&) = delete;
+};
+vtkStandardNewMacro(vtkMethodCacheDerived);
+
+namespace
+{
+const int NumberOfLevels = 6;
+const int NumberOfMethods = 60;
+
+std::vector<std::string> MethodNames;
+
+const char* LevelName(int level)
+{
+  static const char* names[NumberOfLevels] = { "vtkObject", "Level1", "Level2", "Level3",
+    "Level4", "Level5" };
+  return names[level];
+}
+
+int LevelCommand(vtkClientServerInterpreter* arlu, vtkObjectBase* ob, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& resultStream, void* ctx)
+{
+  const int level = static_cast<int>(reinterpret_cast<intptr_t>(ctx));
+  for (int cc = 0; cc < NumberOfMethods; ++cc)
+  {
+    if (!strcmp(MethodNames[level * NumberOfMethods + cc].c_str(), method) &&
+      msg.GetNumberOfArguments(0) == 3)
+    {
+      int value;
+      if (msg.GetArgument(0, 2, &value))
+      {
+        resultStream.Reset();
+        resultStream << vtkClientServerStream::Reply << value + level
+                     << vtkClientServerStream::End;
+        return 1;
+      }
+    }
+  }
+  if (level + 1 < NumberOfLevels)
+  {
+    const char* commandName = LevelName(level + 1);
+    if (arlu->HasCommandFunction(commandName) &&
+      arlu->CallCommandFunction(commandName, ob, method, msg, resultStream))
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Superclass wrapper: Foo(vtkObject*) and SetPoint(double*, any length).
+int BaseCommand(vtkClientServerInterpreter*, vtkObjectBase*, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& resultStream, void*)
+{
+  vtkObjectBase* arg;
+  vtkTypeUInt32 length;
+  if ((!strcmp("Foo", method) && msg.GetNumberOfArguments(0) == 3 &&
+        msg.GetArgumentObject(0, 2, &arg, "vtkObject")) ||
+    (!strcmp("SetPoint", method) && msg.GetNumberOfArguments(0) == 3 &&
+      msg.GetArgumentLength(0, 2, &length)))
+  {
+    resultStream.Reset();
+    resultStream << vtkClientServerStream::Reply << "base" << vtkClientServerStream::End;
+    return 1;
+  }
+  return 0;
+}
+
+// Subclass wrapper: Foo(vtkCollection*) and SetPoint(double[3]), falls back
+// to the superclass wrapper.
+int DerivedCommand(vtkClientServerInterpreter* arlu, vtkObjectBase* ob, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& resultStream, void*)
+{
+  vtkObjectBase* arg;
+  vtkTypeUInt32 length;
+  if ((!strcmp("Foo", method) && msg.GetNumberOfArguments(0) == 3 &&
+        msg.GetArgumentObject(0, 2, &arg, "vtkCollection")) ||
+    (!strcmp("SetPoint", method) && msg.GetNumberOfArguments(0) == 3 &&
+      msg.GetArgumentLength(0, 2, &length) && length == 3))
+  {
+    resultStream.Reset();
+    resultStream << vtkClientServerStream::Reply << "derived" << vtkClientServerStream::End;
+    return 1;
+  }
+  return arlu->CallCommandFunction("vtkObject", ob, method, msg, resultStream);
+}
+
+// Invokes `stream` and checks which overload handled it.
+bool CheckOverload(vtkClientServerInterpreter* interp, const vtkClientServerStream& stream,
+  const char* expected)
+{
+  const char* result = nullptr;
+  if (!interp->ProcessStream(stream) || !interp->GetLastResult().GetArgument(0, 0, &result) ||
+    strcmp(result, expected) != 0)
+  {
+    std::cerr << "ERROR: Expected the " << expected << " overload, got "
+              << (result ? result : "an error") << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestOverloads()
+{
+  vtkNew<vtkClientServerInterpreter> interp;
+  interp->AddCommandFunction("vtkObject", BaseCommand);
+  interp->AddCommandFunction("vtkMethodCacheDerived", DerivedCommand);
+
+  vtkNew<vtkMethodCacheDerived> obj;
+  vtkNew<vtkObject> object;
+  vtkNew<vtkCollection> collection;
+  const double point3[3] = { 1, 2, 3 };
+  const double point4[4] = { 1, 2, 3, 4 };
+
+  vtkClientServerStream fooObject;
+  fooObject << vtkClientServerStream::Invoke << obj.GetPointer() << "Foo" << object.GetPointer()
+            << vtkClientServerStream::End;
+  vtkClientServerStream fooCollection;
+  fooCollection << vtkClientServerStream::Invoke << obj.GetPointer() << "Foo"
+                << collection.GetPointer() << vtkClientServerStream::End;
+  vtkClientServerStream setPoint4;
+  setPoint4 << vtkClientServerStream::Invoke << obj.GetPointer() << "SetPoint"
+            << vtkClientServerStream::InsertArray(point4, 4) << vtkClientServerStream::End;
+  vtkClientServerStream setPoint3;
+  setPoint3 << vtkClientServerStream::Invoke << obj.GetPointer() << "SetPoint"
+            << vtkClientServerStream::InsertArray(point3, 3) << vtkClientServerStream::End;
+
+  // Resolve to the superclass overload first, then call with arguments
+  // matching the subclass overload.
+  return CheckOverload(interp, fooObject, "base") &&
+    CheckOverload(interp, fooCollection, "derived") &&
+    CheckOverload(interp, fooObject, "base") && CheckOverload(interp, fooCollection, "derived") &&
+    CheckOverload(interp, setPoint4, "base") && CheckOverload(interp, setPoint3, "derived") &&
+    CheckOverload(interp, setPoint4, "base") && interp->GetMethodCacheHits() == 3;
+}
+
+double RunInvokes(vtkClientServerInterpreter* interp, vtkObject* obj, int count, bool& ok)
+{
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << obj
+         << MethodNames[NumberOfLevels * NumberOfMethods - 1].c_str() << 10
+         << vtkClientServerStream::End;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int cc = 0; cc < count; ++cc)
+  {
+    int value = 0;
+    if (!interp->ProcessStream(stream) || !interp->GetLastResult().GetArgument(0, 0, &value) ||
+      value != 10 + NumberOfLevels - 1)
+    {
+      ok = false;
+      break;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+}
+
+extern int TestClientServerMethodCache(int, char*[])
+{
+  if (!TestOverloads())
+  {
+    std::cerr << "ERROR: Method cache mixed up overloads." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (int level = 0; level < NumberOfLevels; ++level)
+  {
+    for (int cc = 0; cc < NumberOfMethods; ++cc)
+    {
+      MethodNames.push_back("Set" + std::string(LevelName(level)) + "Method" + std::to_string(cc));
+    }
+  }
+
+  vtkNew<vtkClientServerInterpreter> interp;
+  for (int level = 0; level < NumberOfLevels; ++level)
+  {
+    interp->AddCommandFunction(
+      LevelName(level), LevelCommand, reinterpret_cast<void*>(static_cast<intptr_t>(level)));
+  }
+  vtkNew<vtkObject> obj;
+
+  const int count = 100000;
+  bool ok = true;
+  interp->UseMethodCacheOff();
+  const double uncached = RunInvokes(interp, obj, count, ok);
+  interp->UseMethodCacheOn();
+  const double cached = RunInvokes(interp, obj, count, ok);
+  if (!ok)
+  {
+    std::cerr << "ERROR: Invoke returned an unexpected result." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Invokes: " << count << std::endl
+            << "Without method cache: " << uncached << " s" << std::endl
+            << "With method cache: " << cached << " s" << std::endl
+            << "Cache hits/misses: " << interp->GetMethodCacheHits() << "/"
+            << interp->GetMethodCacheMisses() << std::endl;
+
+  if (interp->GetMethodCacheMisses() != 1 ||
+    interp->GetMethodCacheHits() != static_cast<vtkTypeUInt64>(count - 1))
+  {
+    std::cerr << "ERROR: Unexpected method cache statistics." << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -6,7 +6,11 @@
 #include "vtkStringArray.h"
 #include "vtkVariantArray.h"
 
+#include <atomic>
+#include <cstring>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 static double dblIni[] = { 904., 906., 917. };
 static const char* strIni[] = { "901", "Turbo", "Targa" };
@@ -349,7 +353,120 @@ static bool do_test()
   return true;
 }
 
+static bool do_test_array_reference()
+{
+  // Build the same message once by copy and once by reference.
+  std::vector<double> values(1000);
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = 0.5 * static_cast<double>(i);
+  }
+  const int count = static_cast<int>(values.size());
+  vtkClientServerStream copied;
+  copied << vtkClientServerStream::Reply << 1
+         << vtkClientServerStream::InsertArray(values.data(), count) << "tail"
+         << vtkClientServerStream::End;
+  vtkClientServerStream referenced;
+  referenced << vtkClientServerStream::Reply << 1
+             << vtkClientServerStream::InsertArrayReference(values.data(), count, nullptr)
+             << "tail" << vtkClientServerStream::End;
+
+  // The referenced payload must be handed out in place.
+  std::vector<unsigned char> gathered;
+  bool in_place = false;
+  for (int i = 0; i < referenced.GetNumberOfDataSegments(); ++i)
+  {
+    const unsigned char* data;
+    size_t length;
+    if (!referenced.GetDataSegment(i, &data, &length))
+    {
+      std::cerr << "FAILED: GetDataSegment failed." << endl;
+      return false;
+    }
+    in_place = in_place || data == reinterpret_cast<const unsigned char*>(values.data());
+    gathered.insert(gathered.end(), data, data + length);
+  }
+  if (!in_place)
+  {
+    std::cerr << "FAILED: Array reference was copied into the stream." << endl;
+    return false;
+  }
+
+  // Concatenated segments must match the contiguous form.
+  const unsigned char* data;
+  size_t length;
+  copied.GetData(&data, &length);
+  if (gathered.size() != length || memcmp(gathered.data(), data, length) != 0)
+  {
+    std::cerr << "FAILED: Data segments do not match stream data." << endl;
+    return false;
+  }
+
+  // Reading the stream locally must see the referenced values.
+  std::vector<double> result(values.size());
+  const char* tail;
+  if (!referenced.GetArgument(0, 1, result.data(), static_cast<vtkTypeUInt32>(count)) ||
+    result != values || !referenced.GetArgument(0, 2, &tail) || strcmp(tail, "tail") != 0)
+  {
+    std::cerr << "FAILED: Array reference could not be read back." << endl;
+    return false;
+  }
+  return true;
+}
+
+static bool do_test_array_reference_threads()
+{
+  // Several threads reading a stream holding a reference at the same time
+  // must all see the referenced values, copied into the stream only once.
+  std::vector<int> values(100000);
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = static_cast<int>(i);
+  }
+  const int count = static_cast<int>(values.size());
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    vtkClientServerStream referenced;
+    referenced << vtkClientServerStream::Reply
+               << vtkClientServerStream::InsertArrayReference(values.data(), count, nullptr)
+               << vtkClientServerStream::End;
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int cc = 0; cc < 4; ++cc)
+    {
+      threads.emplace_back([&referenced, &values, &failures, count, cc]() {
+        if (cc % 2)
+        {
+          const unsigned char* data;
+          size_t length;
+          if (!referenced.GetData(&data, &length) || length < values.size() * sizeof(int))
+          {
+            ++failures;
+          }
+        }
+        std::vector<int> result(values.size());
+        if (!referenced.GetArgument(0, 0, result.data(), static_cast<vtkTypeUInt32>(count)) ||
+          result != values)
+        {
+          ++failures;
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    if (failures > 0)
+    {
+      std::cerr << "FAILED: Concurrent reads of an array reference failed." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 extern int coverClientServer(int, char*[])
 {
-  return do_test() ? 0 : 1;
+  return (do_test() && do_test_array_reference() && do_test_array_reference_threads()) ? 0 : 1;
 }
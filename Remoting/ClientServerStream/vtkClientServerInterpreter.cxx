@@ -13,6 +13,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkClientServerInterpreter);
@@ -64,6 +65,52 @@ public:
   NewInstanceFunctionsType NewInstanceFunctions;
   ClassToFunctionMapType ClassToFunctionMap;
   IDToMessageMapType IDToMessageMap;
+
+  // Command function that resolved each (class, method, argument types)
+  // key.  Command functions are never removed once added, so the
+  // pointers remain valid for the lifetime of the interpreter.
+  typedef std::unordered_map<std::string, const CommandFunction*> MethodCacheType;
+  MethodCacheType MethodCache;
+
+  // The innermost command function that succeeded during the current
+  // Invoke.  Set by CallCommandFunction.
+  const CommandFunction* ResolvedCommand = nullptr;
+
+  // Build the method cache key for an expanded Invoke message.  Wrapped
+  // overloads may differ by the class of an object argument or by the size
+  // of an array argument, so both are part of the key.  Otherwise a call
+  // resolved by a superclass overload would be sent there again, even when
+  // a subclass overload matches the new arguments.
+  static std::string GetMethodCacheKey(
+    const char* cname, const char* method, const vtkClientServerStream& msg)
+  {
+    std::string key = cname;
+    key += '\0';
+    key += method;
+    key += '\0';
+    const int nargs = msg.GetNumberOfArguments(0);
+    for (int cc = 2; cc < nargs; ++cc)
+    {
+      const vtkClientServerStream::Types type = msg.GetArgumentType(0, cc);
+      key += static_cast<char>(type);
+      if (type == vtkClientServerStream::vtk_object_pointer)
+      {
+        vtkObjectBase* arg = nullptr;
+        msg.GetArgument(0, cc, &arg);
+        key += arg ? arg->GetClassName() : "";
+        key += '\0';
+      }
+      else if (type <= vtkClientServerStream::float64_array &&
+        (type % 2) == vtkClientServerStream::int8_array)
+      {
+        vtkTypeUInt32 length = 0;
+        msg.GetArgumentLength(0, cc, &length);
+        key += std::to_string(length);
+        key += '\0';
+      }
+    }
+    return key;
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -74,6 +121,9 @@ vtkClientServerInterpreter::vtkClientServerInterpreter()
   this->LastResultMessage = new vtkClientServerStream(this);
   this->LogStream = nullptr;
   this->LogFileStream = nullptr;
+  this->UseMethodCache = true;
+  this->MethodCacheHits = 0;
+  this->MethodCacheMisses = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -406,12 +456,49 @@ int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream
       this->LogStream->flush();
     }
 
+    // Try the command function that handled this call last time.
+    std::string key;
+    if (obj && this->UseMethodCache)
+    {
+      key = vtkClientServerInterpreterInternals::GetMethodCacheKey(
+        obj->GetClassName(), method, msg);
+      auto cached = this->Internal->MethodCache.find(key);
+      if (cached != this->Internal->MethodCache.end())
+      {
+        ++this->MethodCacheHits;
+        const vtkClientServerInterpreterInternals::CommandFunction* n = cached->second;
+        void* ctx = n->Context ? n->Context->Context : nullptr;
+        if (n->Function(this, obj, method, msg, *this->LastResultMessage, ctx))
+        {
+          return 1;
+        }
+
+        // The cached handler rejected the call.  Resolve it again.
+        this->Internal->MethodCache.erase(cached);
+        this->LastResultMessage->Reset();
+      }
+      ++this->MethodCacheMisses;
+    }
+
     // Find the command function for this object's type.
     if (obj && this->HasCommandFunction(obj->GetClassName()))
     {
-      if (this->CallCommandFunction(
-            obj->GetClassName(), obj, method, msg, *this->LastResultMessage))
+      // Nested Invoke messages may be processed by the command function.
+      // Each level tracks its own resolved handler.
+      const vtkClientServerInterpreterInternals::CommandFunction* outer =
+        this->Internal->ResolvedCommand;
+      this->Internal->ResolvedCommand = nullptr;
+      int success = this->CallCommandFunction(
+        obj->GetClassName(), obj, method, msg, *this->LastResultMessage);
+      const vtkClientServerInterpreterInternals::CommandFunction* resolved =
+        this->Internal->ResolvedCommand;
+      this->Internal->ResolvedCommand = outer;
+      if (success)
       {
+        if (resolved && !key.empty())
+        {
+          this->Internal->MethodCache[key] = resolved;
+        }
         return 1;
       }
     }
@@ -795,7 +882,24 @@ int vtkClientServerInterpreter::CallCommandFunction(const char* cname, vtkObject
 
   vtkClientServerCommandFunction function = n->Function;
   void* ctx = n->Context ? n->Context->Context : nullptr;
-  return function(this, ptr, method, msg, result, ctx);
+  int success = function(this, ptr, method, msg, result, ctx);
+
+  // Generated command functions call the ones of their superclasses when
+  // they do not know the method.  The innermost one to succeed is the
+  // one that actually handled the call.
+  if (success && !this->Internal->ResolvedCommand)
+  {
+    this->Internal->ResolvedCommand = n;
+  }
+  return success;
+}
+
+//----------------------------------------------------------------------------
+void vtkClientServerInterpreter::ClearMethodCache()
+{
+  this->Internal->MethodCache.clear();
+  this->MethodCacheHits = 0;
+  this->MethodCacheMisses = 0;
 }
 
 void vtkClientServerInterpreter::AddNewInstanceFunction(const char* name,
@@ -1007,4 +1111,7 @@ vtkObjectBase* vtkClientServerInterpreter::NewInstance(const char* classname)
 void vtkClientServerInterpreter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseMethodCache: " << this->UseMethodCache << endl;
+  os << indent << "MethodCacheHits: " << this->MethodCacheHits << endl;
+  os << indent << "MethodCacheMisses: " << this->MethodCacheMisses << endl;
 }
@@ -140,6 +140,33 @@ public:
   int CallCommandFunction(const char* classname, vtkObjectBase* ptr, const char* method,
     const vtkClientServerStream& msg, vtkClientServerStream& result);
 
+  ///@{
+  /**
+   * Enable/disable the method dispatch cache. When enabled, the command
+   * function that successfully handled an Invoke is remembered per
+   * (object class, method name, argument types) so that subsequent calls
+   * go straight to the wrapper of the class defining the method instead of
+   * walking the wrappers of every class in the hierarchy. Enabled by
+   * default.
+   */
+  vtkSetMacro(UseMethodCache, bool);
+  vtkGetMacro(UseMethodCache, bool);
+  vtkBooleanMacro(UseMethodCache, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Statistics for the method dispatch cache.
+   */
+  vtkGetMacro(MethodCacheHits, vtkTypeUInt64);
+  vtkGetMacro(MethodCacheMisses, vtkTypeUInt64);
+  ///@}
+
+  /**
+   * Empty the method dispatch cache and reset its statistics.
+   */
+  void ClearMethodCache();
+
   /**
    * Add a function used to create new objects.
    */
@@ -211,6 +238,10 @@ private:
   vtkClientServerInterpreterInternals* Internal;
 
   int NextAvailableId;
+
+  bool UseMethodCache;
+  vtkTypeUInt64 MethodCacheHits;
+  vtkTypeUInt64 MethodCacheMisses;
 };
 
 #endif
@@ -16,6 +16,8 @@
 #include <vtkVariantArray.h>
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -125,14 +127,35 @@ public:
   {
   }
   vtkClientServerStreamInternals(const vtkClientServerStreamInternals& r, vtkObjectBase* owner)
-    : Data(r.Data)
-    , ValueOffsets(r.ValueOffsets)
-    , MessageIndexes(r.MessageIndexes)
-    , Objects(r.Objects, owner)
-    , StartIndex(r.StartIndex)
-    , Invalid(r.Invalid)
-    , String(r.String)
+    : Objects(r.Objects, owner)
   {
+    this->CopyFrom(r);
+  }
+
+  vtkClientServerStreamInternals& operator=(const vtkClientServerStreamInternals& r)
+  {
+    if (this != &r)
+    {
+      this->Objects = r.Objects;
+      this->CopyFrom(r);
+    }
+    return *this;
+  }
+
+  // Copy everything but Objects. The source may be flattened by a reader
+  // in another thread, so hold its lock.
+  void CopyFrom(const vtkClientServerStreamInternals& r)
+  {
+    std::lock_guard<std::mutex> lock(r.FlattenMutex);
+    this->Data = r.Data;
+    this->ValueOffsets = r.ValueOffsets;
+    this->MessageIndexes = r.MessageIndexes;
+    this->StartIndex = r.StartIndex;
+    this->Invalid = r.Invalid;
+    this->String = r.String;
+    this->References = r.References;
+    this->ReferencesSize = r.ReferencesSize;
+    this->HasReferences = !this->References.empty();
   }
 
   // Actual binary data in the stream.
@@ -224,6 +247,63 @@ public:
   // Buffer for return value from StreamToString.
   std::string String;
 
+  // Array payloads inserted by reference.  Each payload logically
+  // belongs in front of Data[Position].  ValueOffsets are always stored
+  // as if all payloads were already inline, so that Flatten does not
+  // need to update them.
+  struct ReferenceType
+  {
+    DataType::size_type Position;
+    const unsigned char* Data;
+    size_t Size;
+    vtkSmartPointer<vtkObjectBase> Owner;
+  };
+  typedef std::vector<ReferenceType> ReferencesType;
+  ReferencesType References;
+
+  // Total number of bytes held by References.
+  size_t ReferencesSize = 0;
+
+  // Const readers call Flatten, possibly from several threads at once.
+  // HasReferences lets them skip the lock once the stream is flat, and
+  // the lock makes sure only one of them copies the payloads.
+  mutable std::mutex FlattenMutex;
+  std::atomic<bool> HasReferences{ false };
+
+  // Offset at which the next value will be written.
+  DataType::difference_type GetEndOffset() const
+  {
+    return static_cast<DataType::difference_type>(this->Data.size() + this->ReferencesSize);
+  }
+
+  // Copy all referenced payloads into Data and drop the references.
+  void Flatten()
+  {
+    if (!this->HasReferences.load(std::memory_order_acquire))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(this->FlattenMutex);
+    if (this->References.empty())
+    {
+      return;
+    }
+    DataType flat;
+    flat.reserve(this->Data.size() + this->ReferencesSize);
+    DataType::size_type position = 0;
+    for (const ReferenceType& ref : this->References)
+    {
+      flat.insert(flat.end(), this->Data.begin() + position, this->Data.begin() + ref.Position);
+      flat.insert(flat.end(), ref.Data, ref.Data + ref.Size);
+      position = ref.Position;
+    }
+    flat.insert(flat.end(), this->Data.begin() + position, this->Data.end());
+    this->Data.swap(flat);
+    this->References.clear();
+    this->ReferencesSize = 0;
+    this->HasReferences.store(false, std::memory_order_release);
+  }
+
   // Access to protected members of vtkClientServerStream.
   static vtkClientServerStream& Write(vtkClientServerStream& css, const void* data, size_t length)
   {
@@ -305,6 +385,9 @@ void vtkClientServerStream::Reset()
 {
   // Empty the entire stream.
   vtkClientServerStreamInternals::DataType().swap(this->Internal->Data);
+  this->Internal->References.clear();
+  this->Internal->ReferencesSize = 0;
+  this->Internal->HasReferences = false;
 
   this->Internal->ValueOffsets.erase(
     this->Internal->ValueOffsets.begin(), this->Internal->ValueOffsets.end());
@@ -341,7 +424,7 @@ vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::
   this->Internal->StartIndex = this->Internal->ValueOffsets.size();
 
   // The command counts as the first value in the message.
-  this->Internal->ValueOffsets.push_back(this->Internal->Data.end() - this->Internal->Data.begin());
+  this->Internal->ValueOffsets.push_back(this->Internal->GetEndOffset());
 
   // Store the command in the stream.
   vtkTypeUInt32 data = static_cast<vtkTypeUInt32>(t);
@@ -372,7 +455,7 @@ vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::
 
   // All values write their type first.  Mark the start of this type
   // and optional value.
-  this->Internal->ValueOffsets.push_back(this->Internal->Data.end() - this->Internal->Data.begin());
+  this->Internal->ValueOffsets.push_back(this->Internal->GetEndOffset());
 
   // Store the type in the stream.
   vtkTypeUInt32 data = static_cast<vtkTypeUInt32>(t);
@@ -385,8 +468,7 @@ vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::
   if (a.Data && a.Size)
   {
     // Mark the start of this type and optional value.
-    this->Internal->ValueOffsets.push_back(
-      this->Internal->Data.end() - this->Internal->Data.begin());
+    this->Internal->ValueOffsets.push_back(this->Internal->GetEndOffset());
 
     // If the argument is a vtk_object_pointer, we need to store a
     // reference to the object.
@@ -422,6 +504,33 @@ vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::
   return *this;
 }
 
+//----------------------------------------------------------------------------
+vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::ArrayReference a)
+{
+  // Store the array type and length, then remember where the data
+  // belong instead of copying them.
+  *this << a.Values.Type;
+  this->Write(&a.Values.Length, sizeof(a.Values.Length));
+  if (a.Values.Size > 0)
+  {
+    if (!a.Values.Data)
+    {
+      vtkGenericWarningMacro("vtkClientServerStream given NULL array reference.");
+      this->Internal->Invalid = 1;
+      return *this;
+    }
+    vtkClientServerStreamInternals::ReferenceType ref;
+    ref.Position = this->Internal->Data.size();
+    ref.Data = static_cast<const unsigned char*>(a.Values.Data);
+    ref.Size = a.Values.Size;
+    ref.Owner = a.Owner;
+    this->Internal->References.push_back(ref);
+    this->Internal->ReferencesSize += ref.Size;
+    this->Internal->HasReferences = true;
+  }
+  return *this;
+}
+
 //----------------------------------------------------------------------------
 vtkClientServerStream& vtkClientServerStream::operator<<(const vtkClientServerStream& css)
 {
@@ -641,6 +750,29 @@ VTK_CLIENT_SERVER_INSERT_ARRAY(float)
 VTK_CLIENT_SERVER_INSERT_ARRAY(double)
 #undef VTK_CLIENT_SERVER_INSERT_ARRAY
 
+#define VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(type)                                             \
+  vtkClientServerStream::ArrayReference vtkClientServerStream::InsertArrayReference(               \
+    const type* data, int length, vtkObjectBase* owner)                                            \
+  {                                                                                                \
+    vtkClientServerStream::ArrayReference a = { ::vtkClientServerStreamInsertArray(data, length),  \
+      owner };                                                                                     \
+    return a;                                                                                      \
+  }
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(char)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(short)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(int)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(long)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(signed char)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(unsigned char)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(unsigned short)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(unsigned int)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(unsigned long)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(long long)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(unsigned long long)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(float)
+VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE(double)
+#undef VTK_CLIENT_SERVER_INSERT_ARRAY_REFERENCE
+
 //----------------------------------------------------------------------------
 // Template to implement each type conversion in the lookup tables below.
 // The "long, long, long" arguments are used to convince VS6 to select
@@ -1489,6 +1621,8 @@ int vtkClientServerStream::GetData(const unsigned char** data, size_t* length) c
   // Do not return data unless stream is valid.
   if (!this->Internal->Invalid)
   {
+    // A contiguous buffer is requested.  Copy any referenced arrays.
+    this->Internal->Flatten();
     if (data)
     {
       *data = &*this->Internal->Data.begin();
@@ -1515,6 +1649,50 @@ int vtkClientServerStream::GetData(const unsigned char** data, size_t* length) c
   }
 }
 
+//----------------------------------------------------------------------------
+int vtkClientServerStream::GetNumberOfDataSegments() const
+{
+  if (this->Internal->Invalid)
+  {
+    return 0;
+  }
+
+  // Inline data alternate with referenced arrays.
+  std::lock_guard<std::mutex> lock(this->Internal->FlattenMutex);
+  return static_cast<int>(2 * this->Internal->References.size() + 1);
+}
+
+//----------------------------------------------------------------------------
+int vtkClientServerStream::GetDataSegment(
+  int index, const unsigned char** data, size_t* length) const
+{
+  if (index < 0 || index >= this->GetNumberOfDataSegments())
+  {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(this->Internal->FlattenMutex);
+  const vtkClientServerStreamInternals::ReferencesType& refs = this->Internal->References;
+  const unsigned char* inline_data = &*this->Internal->Data.begin();
+  const size_t ref_index = static_cast<size_t>(index / 2);
+  if (index % 2 == 1)
+  {
+    // A referenced array.
+    *data = refs[ref_index].Data;
+    *length = refs[ref_index].Size;
+  }
+  else
+  {
+    // The inline data between two references.
+    const size_t begin = ref_index > 0 ? refs[ref_index - 1].Position : 0;
+    const size_t end =
+      ref_index < refs.size() ? refs[ref_index].Position : this->Internal->Data.size();
+    *data = inline_data + begin;
+    *length = end - begin;
+  }
+  return 1;
+}
+
 //----------------------------------------------------------------------------
 int vtkClientServerStream::SetData(const unsigned char* data, size_t length)
 {
@@ -1877,6 +2055,7 @@ const unsigned char* vtkClientServerStream::GetValue(int message, int value) con
       this->Internal->MessageIndexes[message];
 
     // Return a pointer to the value-th value in the message.
+    this->Internal->Flatten();
     const unsigned char* data = &*this->Internal->Data.begin();
     return data + this->Internal->ValueOffsets[index + value];
   }
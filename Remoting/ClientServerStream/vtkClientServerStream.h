@@ -228,6 +228,23 @@ public:
    */
   int GetData(const unsigned char** data, size_t* length) const;
 
+  ///@{
+  /**
+   * Access the stream data as an ordered list of contiguous segments
+   * for scatter/gather transmission.  Concatenating all segments gives
+   * exactly the bytes GetData would return, but payloads inserted with
+   * InsertArrayReference are returned in place instead of being copied
+   * into the stream.  Segments may have zero length.  The pointers are
+   * invalidated by any further writing to the stream and by a call to
+   * GetData or any reading method, which copy the referenced arrays into
+   * the stream once.  Reading methods may be called from several threads
+   * at the same time, but not while segments are being used.  Returns
+   * whether the stream is currently valid and the index is in range.
+   */
+  int GetNumberOfDataSegments() const;
+  int GetDataSegment(int index, const unsigned char** data, size_t* length) const;
+  ///@}
+
   //--------------------------------------------------------------------------
   // Stream writing methods:
 
@@ -245,6 +262,20 @@ public:
   };
   ///@}
 
+  ///@{
+  /**
+   * Proxy-object returned by InsertArrayReference.  The array data are
+   * not copied into the stream.  Instead the stream keeps a reference
+   * to Owner, which must keep Data alive and unmodified for as long as
+   * the stream refers to it.
+   */
+  struct ArrayReference
+  {
+    Array Values;
+    vtkObjectBase* Owner;
+  };
+  ///@}
+
   ///@{
   /**
    * Stream operators for special types.
@@ -253,6 +284,7 @@ public:
   vtkClientServerStream& operator<<(vtkClientServerStream::Types);
   vtkClientServerStream& operator<<(vtkClientServerStream::Argument);
   vtkClientServerStream& operator<<(vtkClientServerStream::Array);
+  vtkClientServerStream& operator<<(vtkClientServerStream::ArrayReference);
   vtkClientServerStream& operator<<(const vtkClientServerStream&);
   vtkClientServerStream& operator<<(vtkClientServerID);
   vtkClientServerStream& operator<<(vtkObjectBase*);
@@ -300,6 +332,44 @@ public:
   static vtkClientServerStream::Array InsertArray(const double*, int);
   ///@}
 
+  ///@{
+  /**
+   * Allow arrays to be passed into the stream by reference.  The
+   * resulting stream is identical to one built with InsertArray, but
+   * the array data are only copied when the stream is read locally or
+   * when GetData is called.  Sending the stream segment by segment (see
+   * GetDataSegment) moves the data directly from the given buffer.  The
+   * owner is referenced by the stream until the data are copied or the
+   * stream is reset.
+   */
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const char*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const short*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const int*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const long*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const signed char*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const unsigned char*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const unsigned short*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const unsigned int*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const unsigned long*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const long long*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const unsigned long long*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const float*, int, vtkObjectBase* owner);
+  static vtkClientServerStream::ArrayReference InsertArrayReference(
+    const double*, int, vtkObjectBase* owner);
+  ///@}
+
   /**
    * Construct the entire stream from the given data.  This destroys
    * any data already in the stream.  Returns whether the stream is
@@ -180,5 +180,54 @@ extern int TestPVArrayInformation(int, char*[])
     return EXIT_FAILURE;
   }
 
+  // Ranges of every component and of the magnitude must match the ones
+  // computed by the array, including after the array has been modified.
+  vtkNew<vtkFloatArray> vectors;
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(1000);
+  for (vtkIdType cc = 0; cc < vectors->GetNumberOfValues(); ++cc)
+  {
+    vectors->SetValue(cc, static_cast<float>((cc * 7919) % 1013) - 500.0f);
+  }
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    vtkNew<vtkPVArrayInformation> vectorsInfo;
+    vectorsInfo->CopyFromArray(vectors);
+    for (int compIdx = -1; compIdx < 3; ++compIdx)
+    {
+      double expected[2];
+      vectors->GetRange(expected, compIdx);
+      range = vectorsInfo->GetComponentRange(compIdx);
+      if (!vtkMathUtilities::FuzzyCompare(range[0], expected[0]) ||
+        !vtkMathUtilities::FuzzyCompare(range[1], expected[1]))
+      {
+        std::cerr << "ERROR: unexpected range for component " << compIdx << ": " << range[0]
+                  << ", " << range[1] << " instead of " << expected[0] << ", " << expected[1]
+                  << endl;
+        return EXIT_FAILURE;
+      }
+    }
+    if (vectorsInfo->HasInformationKey("vtkPVArrayInformationKeys", "RANGES"))
+    {
+      std::cerr << "ERROR: cached ranges are reported as an information key" << endl;
+      return EXIT_FAILURE;
+    }
+    vectors->SetValue(42, 1000.0f);
+    vectors->Modified();
+  }
+
+  // The ranges are cached in the information of the array, so they are not
+  // computed again until the array is modified.
+  vectors->SetValue(43, 2000.0f);
+  {
+    vtkNew<vtkPVArrayInformation> vectorsInfo;
+    vectorsInfo->CopyFromArray(vectors);
+    if (vectorsInfo->GetComponentRange(1)[1] == 2000.0)
+    {
+      std::cerr << "ERROR: ranges of an unmodified array were computed again" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
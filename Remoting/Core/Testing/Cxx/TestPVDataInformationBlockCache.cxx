@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> GetSphere(int resolution)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(resolution);
+  sphere->SetPhiResolution(resolution);
+  sphere->Update();
+  return sphere->GetOutput();
+}
+
+bool Check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << what << std::endl;
+  }
+  return condition;
+}
+}
+
+extern int TestPVDataInformationBlockCache(int, char*[])
+{
+  vtkNew<vtkMultiBlockDataSet> data;
+  vtkSmartPointer<vtkPolyData> block0 = GetSphere(8);
+  data->SetBlock(0, block0);
+  data->SetBlock(1, GetSphere(8));
+  const vtkIdType numberOfPoints = block0->GetNumberOfPoints();
+
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyFromObject(data);
+  if (!Check(info->GetNumberOfPoints() == 2 * numberOfPoints, "wrong number of points") ||
+    !Check(vtkPVDataInformation::GetBlockInformationCacheSize(data) == 2,
+      "both blocks should be cached"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Moving the points of a block must invalidate its entry.
+  vtkPoints* points = block0->GetPoints();
+  for (vtkIdType cc = 0; cc < points->GetNumberOfPoints(); ++cc)
+  {
+    double pt[3];
+    points->GetPoint(cc, pt);
+    pt[0] += 10.0;
+    points->SetPoint(cc, pt);
+  }
+  points->Modified();
+  info->CopyFromObject(data);
+  if (!Check(info->GetBounds()[1] > 10.0, "changed block was not revisited") ||
+    !Check(info->GetBounds()[0] < 0.0, "unchanged block is missing"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Replacing a block must not reuse the information of the old one, even if
+  // the new block happens to be allocated at the same address.
+  block0 = nullptr;
+  data->SetBlock(0, GetSphere(16));
+  const vtkIdType numberOfPoints16 =
+    vtkPolyData::SafeDownCast(data->GetBlock(0))->GetNumberOfPoints();
+  info->CopyFromObject(data);
+  if (!Check(info->GetNumberOfPoints() == numberOfPoints + numberOfPoints16,
+        "replaced block was not revisited") ||
+    !Check(info->GetBounds()[1] < 10.0, "information of the replaced block was reused") ||
+    !Check(vtkPVDataInformation::GetBlockInformationCacheSize(data) == 2,
+      "entry of the deleted block was not released"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Entries for blocks that were removed are released.
+  data->SetNumberOfBlocks(1);
+  info->CopyFromObject(data);
+  if (!Check(info->GetNumberOfPoints() == numberOfPoints16, "wrong number of points") ||
+    !Check(vtkPVDataInformation::GetBlockInformationCacheSize(data) == 1,
+      "entry of the removed block was not released"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkPVDataInformation::ClearBlockInformationCache(data);
+  if (!Check(vtkPVDataInformation::GetBlockInformationCacheSize(data) == 0,
+        "cache was not cleared"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
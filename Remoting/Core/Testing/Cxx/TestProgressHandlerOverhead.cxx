@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+// Measures the per-event cost of vtkPVProgressHandler with progress enabled
+// and disabled, and checks that reports are throttled to ProgressInterval and
+// that progress held back by throttling is reported on cleanup.
+// The same cost is paid on each rank of a parallel job since progress is only
+// accumulated locally.
+
+#include "vtkAlgorithm.h"
+#include "vtkCommand.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVProgressHandler.h"
+#include "vtkPVSession.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+class vtkTestProgressSession : public vtkPVSession
+{
+public:
+  static vtkTestProgressSession* New();
+  vtkTypeMacro(vtkTestProgressSession, vtkPVSession);
+  bool GetIsAlive() override { return true; }
+  vtkPVServerInformation* GetServerInformation() override { return nullptr; }
+};
+vtkStandardNewMacro(vtkTestProgressSession);
+
+class ProgressCounter
+{
+public:
+  int Count = 0;
+  int LastProgress = -1;
+  vtkTypeUInt32 LastProgressId = 0;
+  std::string LastProgressText;
+  void OnProgress(vtkObject* caller, unsigned long, void*)
+  {
+    auto handler = vtkPVProgressHandler::SafeDownCast(caller);
+    ++this->Count;
+    this->LastProgress = handler->GetLastProgress();
+    this->LastProgressId = handler->GetLastProgressId();
+    this->LastProgressText = handler->GetLastProgressText() ? handler->GetLastProgressText() : "";
+  }
+};
+
+double FireProgressEvents(vtkAlgorithm* algorithm, int count)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int cc = 0; cc < count; ++cc)
+  {
+    double progress = static_cast<double>(cc) / count;
+    algorithm->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+}
+
+extern int TestProgressHandlerOverhead(int, char*[])
+{
+  vtkNew<vtkTestProgressSession> session;
+  vtkPVProgressHandler* handler = session->GetProgressHandler();
+  handler->SetProgressInterval(0.01);
+
+  ProgressCounter counter;
+  handler->AddObserver(vtkCommand::ProgressEvent, &counter, &ProgressCounter::OnProgress);
+
+  vtkNew<vtkAlgorithm> algorithm;
+  handler->RegisterProgressEvent(algorithm, 1);
+
+  const int count = 1000000;
+  const double disabled = FireProgressEvents(algorithm, count);
+
+  session->PrepareProgress();
+  const double enabled = FireProgressEvents(algorithm, count);
+  session->CleanupPendingProgress();
+  handler->UnregisterObject(algorithm);
+
+  std::cout << "Progress events: " << count << std::endl
+            << "Progress disabled: " << disabled << " s" << std::endl
+            << "Progress enabled: " << enabled << " s" << std::endl
+            << "Reported: " << handler->GetNumberOfReportedProgressEvents() << std::endl;
+
+  if (handler->GetNumberOfProgressEvents() != static_cast<vtkTypeUInt64>(count))
+  {
+    std::cerr << "ERROR: Expected " << count << " progress events, got "
+              << handler->GetNumberOfProgressEvents() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // At most one report per interval, and never more than the 101 distinct
+  // percentages.
+  const auto reported = handler->GetNumberOfReportedProgressEvents();
+  const auto maxReported =
+    static_cast<vtkTypeUInt64>(enabled / handler->GetProgressInterval()) + 2;
+  if (reported == 0 || reported > 101 || reported > maxReported ||
+    reported != static_cast<vtkTypeUInt64>(counter.Count))
+  {
+    std::cerr << "ERROR: Unexpected number of reported progress events: " << reported
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The final progress of another algorithm arrives while reports are
+  // throttled. It must be reported on cleanup, with its own id and text.
+  vtkNew<vtkAlgorithm> first;
+  vtkNew<vtkAlgorithm> second;
+  first->SetProgressText("First");
+  second->SetProgressText("Second");
+  handler->RegisterProgressEvent(first, 2);
+  handler->RegisterProgressEvent(second, 3);
+  handler->SetProgressInterval(3600);
+  session->PrepareProgress();
+  double progress = 0.5;
+  first->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+  progress = 1.0;
+  second->InvokeEvent(vtkCommand::ProgressEvent, &progress);
+  if (counter.LastProgressId != 2)
+  {
+    std::cerr << "ERROR: Progress was not throttled." << std::endl;
+    return EXIT_FAILURE;
+  }
+  session->CleanupPendingProgress();
+  handler->UnregisterObject(first);
+  handler->UnregisterObject(second);
+  if (counter.LastProgress != 100 || counter.LastProgressId != 3 ||
+    counter.LastProgressText != "Second")
+  {
+    std::cerr << "ERROR: Pending progress was not reported on cleanup, last report: "
+              << counter.LastProgressText << " (" << counter.LastProgressId
+              << "): " << counter.LastProgress << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
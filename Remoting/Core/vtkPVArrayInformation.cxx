@@ -3,14 +3,19 @@
 #include "vtkPVArrayInformation.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
 #include "vtkCellAttribute.h"
 #include "vtkCellGrid.h"
 #include "vtkCellGridSummaryInformationQuery.h"
 #include "vtkClientServerStream.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkFieldData.h"
 #include "vtkGenericAttribute.h"
 #include "vtkInformation.h"
+#include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationIntegerKey.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKey.h"
 #include "vtkNew.h"
@@ -18,12 +23,18 @@
 #include "vtkObjectFactory.h"
 #include "vtkPVLogger.h"
 #include "vtkPVPostFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkStringFormatter.h"
+#include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <set>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 namespace
@@ -264,32 +275,212 @@ void vtkPVArrayInformation::DeepCopy(vtkPVArrayInformation* other)
   this->InformationKeys = other->InformationKeys;
 }
 
+//----------------------------------------------------------------------------
+namespace
+{
+// Computes the range and finite range of every component, and of the
+// magnitude, in a single multithreaded pass over the array. This matches
+// vtkDataArray::GetRange()/GetFiniteRange(): NaNs are always ignored,
+// infinite values only for the finite range, ghost tuples flagged with any
+// of the `GhostsToSkip` bits are ignored and the magnitude of a single
+// component array is the range of that component.
+template <typename ArrayT>
+class ArrayRangesFunctor
+{
+  ArrayT* Array;
+  const unsigned char* Ghosts;
+  unsigned char GhostsToSkip;
+  int NumberOfComponents;
+
+  // For each component + 1: min, max, finite min and finite max.
+  vtkSMPThreadLocal<std::vector<double>> TLRanges;
+
+public:
+  std::vector<double> Ranges;
+
+  ArrayRangesFunctor(ArrayT* array, const unsigned char* ghosts, unsigned char ghostsToSkip)
+    : Array(array)
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+    , NumberOfComponents(array->GetNumberOfComponents())
+  {
+  }
+
+  static void InitializeRanges(std::vector<double>& ranges, int numComps)
+  {
+    ranges.resize(4 * (numComps + 1));
+    for (int cc = 0; cc <= numComps; ++cc)
+    {
+      ranges[4 * cc] = ranges[4 * cc + 2] = VTK_DOUBLE_MAX;
+      ranges[4 * cc + 1] = ranges[4 * cc + 3] = -VTK_DOUBLE_MAX;
+    }
+  }
+
+  static void UpdateRange(double* range, double value)
+  {
+    if (!std::isnan(value))
+    {
+      range[0] = std::min(range[0], value);
+      range[1] = std::max(range[1], value);
+      if (std::isfinite(value))
+      {
+        range[2] = std::min(range[2], value);
+        range[3] = std::max(range[3], value);
+      }
+    }
+  }
+
+  void Initialize() { InitializeRanges(this->TLRanges.Local(), this->NumberOfComponents); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    const int numComps = this->NumberOfComponents;
+    double* ranges = this->TLRanges.Local().data();
+    const auto tuples = vtk::DataArrayTupleRange(this->Array, begin, end);
+    vtkIdType tupleIdx = begin;
+    for (const auto tuple : tuples)
+    {
+      if (this->Ghosts && (this->Ghosts[tupleIdx++] & this->GhostsToSkip))
+      {
+        continue;
+      }
+      double squaredNorm = 0.0;
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double value = static_cast<double>(tuple[comp]);
+        UpdateRange(ranges + 4 * (comp + 1), value);
+        squaredNorm += value * value;
+      }
+      if (numComps > 1)
+      {
+        UpdateRange(ranges, std::sqrt(squaredNorm));
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    InitializeRanges(this->Ranges, this->NumberOfComponents);
+    for (const auto& local : this->TLRanges)
+    {
+      for (size_t cc = 0; cc < local.size(); cc += 2)
+      {
+        this->Ranges[cc] = std::min(this->Ranges[cc], local[cc]);
+        this->Ranges[cc + 1] = std::max(this->Ranges[cc + 1], local[cc + 1]);
+      }
+    }
+    if (this->NumberOfComponents == 1)
+    {
+      std::copy(this->Ranges.begin() + 4, this->Ranges.end(), this->Ranges.begin());
+    }
+  }
+};
+
+struct ArrayRangesWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const unsigned char* ghosts, unsigned char ghostsToSkip,
+    std::vector<double>& result)
+  {
+    ArrayRangesFunctor<ArrayT> functor(array, ghosts, ghostsToSkip);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    result = std::move(functor.Ranges);
+  }
+};
+
+// Keys used to cache the ranges in the information of the array, next to the
+// range keys of vtkDataArray, so that gathering information again on arrays
+// that have not been modified does not traverse them. The ranges are stored
+// as computed by ArrayRangesFunctor. They are valid for the array MTime, and
+// for the MTime of the ghost array and the ghost flags used to skip tuples.
+class vtkPVArrayInformationKeys : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkPVArrayInformationKeys, vtkObject);
+
+  static vtkInformationDoubleVectorKey* RANGES();
+  static vtkInformationIdTypeKey* RANGES_MTIME();
+  static vtkInformationIdTypeKey* RANGES_GHOSTS_MTIME();
+  static vtkInformationIntegerKey* RANGES_GHOSTS_TO_SKIP();
+
+protected:
+  vtkPVArrayInformationKeys() = default;
+  ~vtkPVArrayInformationKeys() override = default;
+
+private:
+  vtkPVArrayInformationKeys(const vtkPVArrayInformationKeys&) = delete;
+  void operator=(const vtkPVArrayInformationKeys&) = delete;
+};
+vtkInformationKeyMacro(vtkPVArrayInformationKeys, RANGES, DoubleVector);
+vtkInformationKeyMacro(vtkPVArrayInformationKeys, RANGES_MTIME, IdType);
+vtkInformationKeyMacro(vtkPVArrayInformationKeys, RANGES_GHOSTS_MTIME, IdType);
+vtkInformationKeyMacro(vtkPVArrayInformationKeys, RANGES_GHOSTS_TO_SKIP, Integer);
+} // end of namespace
+
 //----------------------------------------------------------------------------
 struct vtkPVArrayInformation::GetRangeFunctor
 {
-  // Compute ranges using the appropriate method: if the containing field data is available, use its
-  // method which can handle caching ghost values. Fallback to the array's method.
-  void operator()(vtkDataArray* dataArray, int componentIdx, ComponentInfo& compInfo)
+  // Compute ranges of all components at once. If the containing field data is
+  // available, skip the ghost tuples it is set up to skip, as
+  // vtkFieldData::GetRange() would.
+  void operator()(vtkDataArray* dataArray, std::vector<ComponentInfo>& components)
   {
-    bool rangeFound = false, finiteRangeFound = false;
+    vtkUnsignedCharArray* ghosts = nullptr;
+    unsigned char ghostsToSkip = 0;
     if (this->FieldData != nullptr && this->ArrayIdx >= 0)
     {
-      rangeFound =
-        this->FieldData->GetRange(this->ArrayIdx, compInfo.Range.GetData(), componentIdx);
-      finiteRangeFound = this->FieldData->GetFiniteRange(
-        this->ArrayIdx, compInfo.FiniteRange.GetData(), componentIdx);
+      ghosts = this->FieldData->GetGhostArray();
+      ghostsToSkip = this->FieldData->GetGhostsToSkip();
+      if (ghosts == nullptr || ghosts == dataArray || ghostsToSkip == 0 ||
+        ghosts->GetNumberOfTuples() < dataArray->GetNumberOfTuples())
+      {
+        ghosts = nullptr;
+        ghostsToSkip = 0;
+      }
     }
 
-    if (!rangeFound)
+    const std::vector<double> ranges = this->GetRanges(dataArray, ghosts, ghostsToSkip);
+    for (size_t cc = 0; cc < components.size() && 4 * cc + 3 < ranges.size(); ++cc)
     {
-      dataArray->GetRange(compInfo.Range.GetData(), componentIdx);
+      const double* range = ranges.data() + 4 * cc;
+      components[cc].Range = vtkTuple<double, 2>({ range[0], range[1] });
+      components[cc].FiniteRange = vtkTuple<double, 2>({ range[2], range[3] });
     }
+  };
 
-    if (!finiteRangeFound)
+  std::vector<double> GetRanges(
+    vtkDataArray* dataArray, vtkUnsignedCharArray* ghosts, unsigned char ghostsToSkip)
+  {
+    using Keys = vtkPVArrayInformationKeys;
+    const vtkIdType mtime = static_cast<vtkIdType>(dataArray->GetMTime());
+    const vtkIdType ghostsMTime = ghosts ? static_cast<vtkIdType>(ghosts->GetMTime()) : 0;
+    const size_t size = 4 * static_cast<size_t>(dataArray->GetNumberOfComponents() + 1);
+
+    vtkInformation* info = dataArray->GetInformation();
+    if (info->Has(Keys::RANGES()) && info->Get(Keys::RANGES_MTIME()) == mtime &&
+      info->Get(Keys::RANGES_GHOSTS_MTIME()) == ghostsMTime &&
+      info->Get(Keys::RANGES_GHOSTS_TO_SKIP()) == ghostsToSkip &&
+      static_cast<size_t>(info->Length(Keys::RANGES())) == size)
     {
-      dataArray->GetFiniteRange(compInfo.FiniteRange.GetData(), componentIdx);
+      const double* cached = info->Get(Keys::RANGES());
+      return std::vector<double>(cached, cached + size);
+    }
+
+    std::vector<double> ranges;
+    const unsigned char* ghostsPtr = ghosts ? ghosts->GetPointer(0) : nullptr;
+    ArrayRangesWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(dataArray, worker, ghostsPtr, ghostsToSkip, ranges))
+    {
+      worker(dataArray, ghostsPtr, ghostsToSkip, ranges);
     }
-  };
+
+    // Setting the keys modifies the information, not the array.
+    info->Set(Keys::RANGES(), ranges.data(), static_cast<int>(ranges.size()));
+    info->Set(Keys::RANGES_MTIME(), mtime);
+    info->Set(Keys::RANGES_GHOSTS_MTIME(), ghostsMTime);
+    info->Set(Keys::RANGES_GHOSTS_TO_SKIP(), ghostsToSkip);
+    return ranges;
+  }
 
   vtkAbstractArray* Array = nullptr;
   vtkFieldData* FieldData = nullptr;
@@ -331,11 +522,7 @@ void vtkPVArrayInformation::CopyFromArrayInternal(
   auto dataArray = vtkDataArray::SafeDownCast(array);
   if (dataArray && dataArray->IsNumeric())
   {
-    for (int comp = -1; comp < numComponents; ++comp)
-    {
-      auto& compInfo = this->Components.at(comp + 1);
-      getRangeFn(dataArray, comp, compInfo);
-    }
+    getRangeFn(dataArray, this->Components);
   }
   else if (auto sarray = vtkStringArray::SafeDownCast(array))
   {
@@ -358,6 +545,10 @@ void vtkPVArrayInformation::CopyFromArrayInternal(
     for (it->GoToFirstItem(); !it->IsDoneWithTraversal(); it->GoToNextItem())
     {
       vtkInformationKey* key = it->GetCurrentKey();
+      if (strcmp(key->GetLocation(), "vtkPVArrayInformationKeys") == 0)
+      {
+        continue; // ranges cached by GetRangeFunctor
+      }
       this->InformationKeys.insert(
         std::make_pair<std::string, std::string>(key->GetLocation(), key->GetName()));
     }
@@ -24,6 +24,7 @@
 #include "vtkHyperTreeGrid.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
@@ -37,19 +38,124 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUniformGridAMR.h"
+#include "vtkWeakPointer.h"
 
 #include <algorithm>
 #include <cassert>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+// Information for the non-composite blocks of a data object. It is kept in
+// the information of the data object passed to CopyFromObject(), so it is
+// released along with the pipeline that produced the data.
+class vtkPVDataInformationBlockCache : public vtkObject
+{
+public:
+  static vtkPVDataInformationBlockCache* New();
+  vtkTypeMacro(vtkPVDataInformationBlockCache, vtkObject);
+
+  static vtkInformationObjectBaseKey* BLOCK_INFORMATION_CACHE();
+
+  // Past this many entries, entries unused by the latest pass are dropped and
+  // new blocks are no longer cached.
+  static constexpr size_t MaximumNumberOfEntries = 65536;
+
+  struct EntryType
+  {
+    vtkWeakPointer<vtkDataObject> Object;
+    vtkMTimeType MTime;
+    bool InspectCells;
+    unsigned int LastPass;
+    vtkSmartPointer<vtkPVDataInformation> Information;
+  };
+  std::unordered_map<vtkDataObject*, EntryType> Entries;
+  unsigned int Pass = 0;
+
+  static vtkPVDataInformationBlockCache* GetCache(vtkDataObject* dobj, bool create)
+  {
+    vtkInformation* dinfo = dobj ? dobj->GetInformation() : nullptr;
+    if (!dinfo)
+    {
+      return nullptr;
+    }
+    auto cache = vtkPVDataInformationBlockCache::SafeDownCast(dinfo->Get(BLOCK_INFORMATION_CACHE()));
+    if (!cache && create)
+    {
+      vtkNew<vtkPVDataInformationBlockCache> newCache;
+      dinfo->Set(BLOCK_INFORMATION_CACHE(), newCache);
+      cache = newCache;
+    }
+    return cache;
+  }
+
+  vtkPVDataInformation* GetBlockInformation(vtkDataObject* dobj, bool inspectCells)
+  {
+    const vtkMTimeType mtime = dobj->GetMTime();
+    auto iter = this->Entries.find(dobj);
+    if (iter != this->Entries.end() && iter->second.Object == dobj &&
+      iter->second.MTime == mtime && iter->second.InspectCells == inspectCells)
+    {
+      iter->second.LastPass = this->Pass;
+      return iter->second.Information;
+    }
+    if (iter == this->Entries.end() && this->Entries.size() >= MaximumNumberOfEntries)
+    {
+      return nullptr;
+    }
+
+    vtkNew<vtkPVDataInformation> blockInfo;
+    blockInfo->SetInspectCells(inspectCells);
+    blockInfo->CopyFromDataObject(dobj);
+
+    auto& entry = this->Entries[dobj];
+    entry.Object = dobj;
+    entry.MTime = mtime;
+    entry.InspectCells = inspectCells;
+    entry.LastPass = this->Pass;
+    entry.Information = blockInfo;
+    return blockInfo;
+  }
+
+  // Drops entries for blocks that no longer exist (pointers may be reused,
+  // which the weak pointer detects) and, when the cache is full, entries
+  // that were not used by the pass that just ended.
+  void EndPass()
+  {
+    const bool full = this->Entries.size() >= MaximumNumberOfEntries;
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end();)
+    {
+      if (iter->second.Object == nullptr || (full && iter->second.LastPass != this->Pass))
+      {
+        iter = this->Entries.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+    ++this->Pass;
+  }
+
+protected:
+  vtkPVDataInformationBlockCache() = default;
+  ~vtkPVDataInformationBlockCache() override = default;
+
+private:
+  vtkPVDataInformationBlockCache(const vtkPVDataInformationBlockCache&) = delete;
+  void operator=(const vtkPVDataInformationBlockCache&) = delete;
+};
+vtkStandardNewMacro(vtkPVDataInformationBlockCache);
+vtkInformationKeyMacro(vtkPVDataInformationBlockCache, BLOCK_INFORMATION_CACHE, ObjectBase);
+
 class vtkPVDataInformationAccumulator
 {
   vtkNew<vtkPVDataInformation> Current;
 
 public:
   std::set<int> UniqueBlockTypes;
+  vtkPVDataInformationBlockCache* Cache = nullptr;
   vtkPVDataInformation* operator()(vtkPVDataInformation* info, vtkDataObject* dobj)
   {
     if (!dobj)
@@ -58,14 +164,20 @@ public:
     }
     assert(vtkCompositeDataSet::SafeDownCast(dobj) == nullptr);
 
-    this->Current->Initialize();
-    this->Current->SetInspectCells(info->InspectCells);
-    this->Current->CopyFromDataObject(dobj);
-    if (this->Current->GetDataSetType() != -1)
+    vtkPVDataInformation* blockInfo =
+      this->Cache ? this->Cache->GetBlockInformation(dobj, info->InspectCells) : nullptr;
+    if (!blockInfo)
+    {
+      this->Current->Initialize();
+      this->Current->SetInspectCells(info->InspectCells);
+      this->Current->CopyFromDataObject(dobj);
+      blockInfo = this->Current;
+    }
+    if (blockInfo->GetDataSetType() != -1)
     {
-      assert(this->Current->GetCompositeDataSetType() == -1);
-      this->UniqueBlockTypes.insert(this->Current->GetDataSetType());
-      info->AddInformation(this->Current);
+      assert(blockInfo->GetCompositeDataSetType() == -1);
+      this->UniqueBlockTypes.insert(blockInfo->GetDataSetType());
+      info->AddInformation(blockInfo);
     }
     return info;
   }
@@ -432,6 +544,7 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
   }
 
   vtkPVDataInformationAccumulator accumulator;
+  accumulator.Cache = vtkPVDataInformationBlockCache::GetCache(dobj, true);
   if (auto cd = vtkCompositeDataSet::SafeDownCast(subset))
   {
     vtkSmartPointer<vtkCompositeDataSet> simpleCD = this->SimplifyCompositeDataSet(cd);
@@ -491,6 +604,11 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
     accumulator(this, subset);
   }
 
+  if (accumulator.Cache)
+  {
+    accumulator.Cache->EndPass();
+  }
+
   this->UniqueBlockTypes.clear();
   if (this->CompositeDataSetType != -1)
   {
@@ -510,6 +628,22 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ClearBlockInformationCache(vtkDataObject* dobj)
+{
+  if (dobj && dobj->GetInformation())
+  {
+    dobj->GetInformation()->Remove(vtkPVDataInformationBlockCache::BLOCK_INFORMATION_CACHE());
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkPVDataInformation::GetBlockInformationCacheSize(vtkDataObject* dobj)
+{
+  auto cache = vtkPVDataInformationBlockCache::GetCache(dobj, false);
+  return cache ? static_cast<vtkIdType>(cache->Entries.size()) : 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromPipelineInformation(vtkInformation* pinfo)
 {
@@ -483,6 +483,19 @@ public:
    */
   const std::vector<unsigned char>& GetUniqueCellTypes() const { return this->UniqueCellTypes; }
 
+  ///@{
+  /**
+   * Information for each non-composite block is cached in the information of
+   * the data object CopyFromObject() was called for, keyed on the block and
+   * its MTime, so that the next call only revisits blocks that changed. The
+   * cache is released along with the data object, or earlier with
+   * ClearBlockInformationCache(). GetBlockInformationCacheSize() returns the
+   * number of cached blocks and is mostly meant for testing.
+   */
+  static void ClearBlockInformationCache(vtkDataObject* dobj);
+  static vtkIdType GetBlockInformationCacheSize(vtkDataObject* dobj);
+  ///@}
+
 protected:
   vtkPVDataInformation();
   ~vtkPVDataInformation() override;
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVPipelineProfilerInformation.h"
+
+#include "vtkClientServerStream.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+
+#include <vtksys/FStream.hxx>
+
+vtkStandardNewMacro(vtkPVPipelineProfilerInformation);
+//----------------------------------------------------------------------------
+vtkPVPipelineProfilerInformation::vtkPVPipelineProfilerInformation() = default;
+
+//----------------------------------------------------------------------------
+vtkPVPipelineProfilerInformation::~vtkPVPipelineProfilerInformation() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyFromObject(vtkObject*)
+{
+  this->Events = vtkPVPipelineProfiler::GetEvents();
+  if (this->ClearEvents)
+  {
+    vtkNew<vtkPVPipelineProfiler> profiler;
+    profiler->Clear();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::AddInformation(vtkPVInformation* info)
+{
+  auto other = vtkPVPipelineProfilerInformation::SafeDownCast(info);
+  if (other)
+  {
+    this->Events.insert(this->Events.end(), other->Events.begin(), other->Events.end());
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyToStream(vtkClientServerStream* css)
+{
+  css->Reset();
+  *css << vtkClientServerStream::Reply << static_cast<int>(this->Events.size());
+  for (const auto& event : this->Events)
+  {
+    *css << event.Algorithm << event.Request << event.Rank << event.StartTime << event.Duration
+         << event.MemoryDelta << event.OutputSize;
+  }
+  *css << vtkClientServerStream::End;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyFromStream(const vtkClientServerStream* css)
+{
+  this->Events.clear();
+  int numEvents = 0;
+  if (!css->GetArgument(0, 0, &numEvents) || numEvents < 0)
+  {
+    vtkErrorMacro("Error parsing number of events from message.");
+    return;
+  }
+
+  this->Events.resize(numEvents);
+  int arg = 1;
+  for (auto& event : this->Events)
+  {
+    if (!css->GetArgument(0, arg++, &event.Algorithm) ||
+      !css->GetArgument(0, arg++, &event.Request) || !css->GetArgument(0, arg++, &event.Rank) ||
+      !css->GetArgument(0, arg++, &event.StartTime) ||
+      !css->GetArgument(0, arg++, &event.Duration) ||
+      !css->GetArgument(0, arg++, &event.MemoryDelta) ||
+      !css->GetArgument(0, arg++, &event.OutputSize))
+    {
+      vtkErrorMacro("Error parsing event from message.");
+      this->Events.clear();
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyParametersToStream(vtkMultiProcessStream& str)
+{
+  str << 718923 << (this->ClearEvents ? 1 : 0);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
+{
+  int magic_number;
+  int clearEvents;
+  str >> magic_number >> clearEvents;
+  if (magic_number != 718923)
+  {
+    vtkErrorMacro("Magic number mismatch.");
+  }
+  this->ClearEvents = clearEvents != 0;
+}
+
+//----------------------------------------------------------------------------
+const vtkPVPipelineProfiler::Event* vtkPVPipelineProfilerInformation::GetEvent(int index) const
+{
+  return (index >= 0 && index < this->GetNumberOfEvents()) ? &this->Events[index] : nullptr;
+}
+
+//----------------------------------------------------------------------------
+const char* vtkPVPipelineProfilerInformation::GetEventAlgorithm(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->Algorithm.c_str() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVPipelineProfilerInformation::GetEventRequest(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->Request : -1;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVPipelineProfilerInformation::GetEventRank(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->Rank : -1;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVPipelineProfilerInformation::GetEventStartTime(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->StartTime : 0.0;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVPipelineProfilerInformation::GetEventDuration(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->Duration : 0.0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVPipelineProfilerInformation::GetEventMemoryDelta(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->MemoryDelta : 0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVPipelineProfilerInformation::GetEventOutputSize(int index) const
+{
+  auto event = this->GetEvent(index);
+  return event ? event->OutputSize : 0;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVPipelineProfilerInformation::GetChromeTrace() const
+{
+  return vtkPVPipelineProfiler::ToChromeTrace(this->Events);
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineProfilerInformation::WriteChromeTrace(const char* filename)
+{
+  if (!filename)
+  {
+    return false;
+  }
+  vtksys::ofstream file(filename, std::ios::out | std::ios::trunc);
+  if (!file)
+  {
+    vtkErrorMacro("Cannot open file for writing: " << filename);
+    return false;
+  }
+  file << this->GetChromeTrace();
+  return static_cast<bool>(file);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfilerInformation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ClearEvents: " << this->ClearEvents << endl;
+  os << indent << "NumberOfEvents: " << this->Events.size() << endl;
+}
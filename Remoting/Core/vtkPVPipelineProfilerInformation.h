@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkPVPipelineProfilerInformation
+ * @brief gathers pipeline execution events recorded on all ranks.
+ *
+ * vtkPVPipelineProfilerInformation collects the events recorded by
+ * vtkPVPipelineProfiler on each rank. Gather it from the "PipelineProfiler"
+ * misc proxy. The events can be inspected one by one or exported in the Chrome
+ * trace event format, where each rank is shown as a separate process, to spot
+ * slow filters and straggler ranks.
+ */
+
+#ifndef vtkPVPipelineProfilerInformation_h
+#define vtkPVPipelineProfilerInformation_h
+
+#include "vtkPVInformation.h"
+#include "vtkPVPipelineProfiler.h" // for vtkPVPipelineProfiler::Event
+#include "vtkRemotingCoreModule.h" // needed for exports
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+class VTKREMOTINGCORE_EXPORT vtkPVPipelineProfilerInformation : public vtkPVInformation
+{
+public:
+  static vtkPVPipelineProfilerInformation* New();
+  vtkTypeMacro(vtkPVPipelineProfilerInformation, vtkPVInformation);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * When set, events are discarded on each rank once gathered. This must be
+   * set before calling GatherInformation(). Default is false.
+   */
+  vtkSetMacro(ClearEvents, bool);
+  vtkGetMacro(ClearEvents, bool);
+  vtkBooleanMacro(ClearEvents, bool);
+  ///@}
+
+  /**
+   * Transfer information about a single object into this object. The object
+   * is ignored; events are read from vtkPVPipelineProfiler.
+   */
+  void CopyFromObject(vtkObject*) override;
+
+  /**
+   * Merge another information object.
+   */
+  void AddInformation(vtkPVInformation*) override;
+
+  ///@{
+  /**
+   * Manage a serialized version of the information.
+   */
+  void CopyToStream(vtkClientServerStream*) override;
+  void CopyFromStream(const vtkClientServerStream*) override;
+  ///@}
+
+  ///@{
+  /**
+   * Serialize/Deserialize the parameters that control how/what information is
+   * gathered.
+   */
+  void CopyParametersToStream(vtkMultiProcessStream&) override;
+  void CopyParametersFromStream(vtkMultiProcessStream&) override;
+  ///@}
+
+  ///@{
+  /**
+   * Access the gathered events. See vtkPVPipelineProfiler::Event for the
+   * meaning of each field. Out-of-range indices return default values.
+   */
+  int GetNumberOfEvents() const { return static_cast<int>(this->Events.size()); }
+  const char* GetEventAlgorithm(int index) const;
+  int GetEventRequest(int index) const;
+  int GetEventRank(int index) const;
+  double GetEventStartTime(int index) const;
+  double GetEventDuration(int index) const;
+  vtkTypeInt64 GetEventMemoryDelta(int index) const;
+  vtkTypeInt64 GetEventOutputSize(int index) const;
+  const std::vector<vtkPVPipelineProfiler::Event>& GetEvents() const { return this->Events; }
+  ///@}
+
+  /**
+   * Returns the events in the Chrome trace event format.
+   */
+  std::string GetChromeTrace() const;
+
+  /**
+   * Write the events in the Chrome trace event format to a file.
+   * Returns false on failure.
+   */
+  bool WriteChromeTrace(const char* filename);
+
+protected:
+  vtkPVPipelineProfilerInformation();
+  ~vtkPVPipelineProfilerInformation() override;
+
+  bool ClearEvents = false;
+  std::vector<vtkPVPipelineProfiler::Event> Events;
+
+private:
+  vtkPVPipelineProfilerInformation(const vtkPVPipelineProfilerInformation&) = delete;
+  void operator=(const vtkPVPipelineProfilerInformation&) = delete;
+
+  const vtkPVPipelineProfiler::Event* GetEvent(int index) const;
+};
+
+#endif
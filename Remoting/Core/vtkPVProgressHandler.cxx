@@ -9,17 +9,18 @@
 #include "vtkCompositeMultiProcessController.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
-#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutputWindow.h"
 #include "vtkPVSession.h"
 #include "vtkProcessModule.h"
-#include "vtkTimerLog.h"
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
 
 // define this variable to disable progress all together. This may be useful to
 // doing really large runs.
@@ -95,7 +96,18 @@ public:
   // between calls to PrepareProgress() and CleanupPendingProgress().
   bool EnableProgress;
 
-  vtkNew<vtkTimerLog> ProgressTimer;
+  // Progress accumulated since the last report, packed as (id << 32 | percent + 1)
+  // so that it can be updated atomically from any thread. Only the main thread
+  // of the root node reports it, once per ProgressInterval.
+  static constexpr vtkTypeUInt64 NO_PROGRESS = 0;
+  std::atomic<vtkTypeUInt64> PendingProgress{ NO_PROGRESS };
+  std::atomic<vtkTypeUInt64> NumberOfProgressEvents{ 0 };
+  std::atomic<vtkTypeUInt64> NumberOfReportedProgressEvents{ 0 };
+  vtkTypeUInt64 ReportedProgress = NO_PROGRESS;
+  std::chrono::steady_clock::time_point NextReportTime;
+  std::thread::id MainThread;
+  bool ReportProgress = true;
+
   vtkInternals()
   {
     this->EnableProgress = false;
@@ -115,6 +127,23 @@ public:
     }
     return 0;
   }
+
+  vtkObject* GetObjectFromID(int id)
+  {
+    for (const auto& pair : this->RegisteredObjects)
+    {
+      if (pair.second == id)
+      {
+        return pair.first;
+      }
+    }
+    return nullptr;
+  }
+
+  static vtkTypeUInt64 PackProgress(vtkTypeUInt32 id, int percent)
+  {
+    return (static_cast<vtkTypeUInt64>(id) << 32) | static_cast<vtkTypeUInt64>(percent + 1);
+  }
 };
 
 vtkStandardNewMacro(vtkPVProgressHandler);
@@ -250,6 +279,15 @@ void vtkPVProgressHandler::PrepareProgress()
   this->InvokeEvent(vtkCommand::StartEvent, this);
   this->Internals->EnableProgress = true;
   this->LastProgressId = 0;
+
+  // Satellites only accumulate progress; reporting is done by the root node.
+  auto& internals = *this->Internals;
+  vtkMultiProcessController* mpiController = vtkMultiProcessController::GetGlobalController();
+  internals.ReportProgress = !mpiController || mpiController->GetLocalProcessId() == 0;
+  internals.MainThread = std::this_thread::get_id();
+  internals.PendingProgress = vtkInternals::NO_PROGRESS;
+  internals.ReportedProgress = vtkInternals::NO_PROGRESS;
+  internals.NextReportTime = std::chrono::steady_clock::time_point();
 }
 
 //----------------------------------------------------------------------------
@@ -273,6 +311,13 @@ void vtkPVProgressHandler::CleanupPendingProgress()
     return;
   }
 
+  // Report progress held back by throttling, such as the final 1.0, before
+  // the client is told that we are done.
+  if (this->Internals->ReportProgress)
+  {
+    this->FlushProgress(nullptr);
+  }
+
   vtkMultiProcessController* mpiController = vtkMultiProcessController::GetGlobalController();
   if (mpiController && mpiController->GetNumberOfProcesses() > 1)
   {
@@ -330,6 +375,10 @@ void vtkPVProgressHandler::CleanupPendingProgress()
 void vtkPVProgressHandler::LocalCleanupPendingProgress()
 {
   SKIP_IF_DISABLED();
+  if (this->Internals->EnableProgress && this->Internals->ReportProgress)
+  {
+    this->FlushProgress(nullptr);
+  }
   this->Internals->EnableProgress = false;
   this->LastProgressId = 0;
   this->InvokeEvent(vtkCommand::EndEvent, this);
@@ -344,24 +393,10 @@ void vtkPVProgressHandler::OnProgressEvent(vtkObject* caller, unsigned long even
     return;
   }
 
-  // Try to clamp frequent progress events.
-  this->Internals->ProgressTimer->StopTimer();
-  // std::cout <<"Elapsed: " << this->Internals->ProgressTimer->GetElapsedTime() <<
-  //  endl;
-  double progress = *reinterpret_cast<double*>(calldata);
-  if (this->LastProgress == static_cast<int>(progress * 100.0))
-  {
-    // If the progress hasn't changed, we don't need to update.
-    return;
-  }
-  // If the elapsed time is less than the interval, we skip this update.
-  if (this->Internals->ProgressTimer->GetElapsedTime() < this->ProgressInterval)
-  {
-    return;
-  }
-
-  this->Internals->ProgressTimer->StartTimer();
+  auto& internals = *this->Internals;
+  internals.NumberOfProgressEvents.fetch_add(1, std::memory_order_relaxed);
 
+  double progress = *reinterpret_cast<double*>(calldata);
   if (progress < 0 || progress > 1.0)
   {
 #ifndef NDEBUG
@@ -373,10 +408,69 @@ void vtkPVProgressHandler::OnProgressEvent(vtkObject* caller, unsigned long even
     progress = (progress > 1.0) ? 1.0 : progress;
   }
 
-  const auto id = this->Internals->GetIDFromObject(caller);
-  std::string text = ::vtkGetProgressText(caller);
-  this->RefreshProgress(text.c_str(), progress, id);
-  this->CheckAbort(id, caller, nullptr);
+  const auto id = internals.GetIDFromObject(caller);
+  internals.PendingProgress.store(
+    vtkInternals::PackProgress(id, static_cast<int>(progress * 100.0)), std::memory_order_relaxed);
+
+  // Progress events may be fired from worker threads and, on satellites, are
+  // never reported: both only accumulate.
+  if (!internals.ReportProgress || std::this_thread::get_id() != internals.MainThread)
+  {
+    return;
+  }
+
+  // Try to clamp frequent progress events.
+  if (std::chrono::steady_clock::now() < internals.NextReportTime)
+  {
+    return;
+  }
+  this->FlushProgress(caller);
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVProgressHandler::FlushProgress(vtkObject* caller)
+{
+  auto& internals = *this->Internals;
+  const vtkTypeUInt64 pending =
+    internals.PendingProgress.exchange(vtkInternals::NO_PROGRESS, std::memory_order_relaxed);
+  if (pending == vtkInternals::NO_PROGRESS || pending == internals.ReportedProgress)
+  {
+    // If the progress hasn't changed, we don't need to update.
+    return false;
+  }
+
+  internals.ReportedProgress = pending;
+  internals.NextReportTime = std::chrono::steady_clock::now() +
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(this->ProgressInterval));
+  internals.NumberOfReportedProgressEvents.fetch_add(1, std::memory_order_relaxed);
+
+  const auto id = static_cast<vtkTypeUInt32>(pending >> 32);
+  const int percent = static_cast<int>(pending & 0xffffffff) - 1;
+
+  // The pending progress may come from another object than `caller`, e.g. one
+  // running in a worker thread. Report the text of the object it came from.
+  vtkObject* object = caller;
+  if (!caller || internals.GetIDFromObject(caller) != static_cast<int>(id))
+  {
+    object = internals.GetObjectFromID(static_cast<int>(id));
+  }
+  std::string text = object ? ::vtkGetProgressText(object) : "";
+  this->RefreshProgress(text.c_str(), percent / 100.0, id);
+  this->CheckAbort(id, object, nullptr);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVProgressHandler::GetNumberOfProgressEvents()
+{
+  return this->Internals->NumberOfProgressEvents.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVProgressHandler::GetNumberOfReportedProgressEvents()
+{
+  return this->Internals->NumberOfReportedProgressEvents.load(std::memory_order_relaxed);
 }
 
 //----------------------------------------------------------------------------
@@ -397,7 +491,7 @@ void vtkPVProgressHandler::RefreshProgress(
     memcpy(buffer.data(), &le_id, sizeof(vtkTypeUInt32));
 
     double le_progress = progress;
-    vtkByteSwap::SwapLE(&progress);
+    vtkByteSwap::SwapLE(&le_progress);
     memcpy(buffer.data() + sizeof(vtkTypeUInt32), &le_progress, sizeof(double));
 
     memcpy(
@@ -437,6 +531,10 @@ void vtkPVProgressHandler::RefreshProgress(
 void vtkPVProgressHandler::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ProgressInterval: " << this->ProgressInterval << endl;
+  os << indent << "NumberOfProgressEvents: " << this->GetNumberOfProgressEvents() << endl;
+  os << indent
+     << "NumberOfReportedProgressEvents: " << this->GetNumberOfReportedProgressEvents() << endl;
 }
 
 //----------------------------------------------------------------------------
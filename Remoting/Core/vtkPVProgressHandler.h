@@ -12,6 +12,11 @@
  * may not faithfully report the progress, this avoid nasty MPI issues that can
  * be painful to debug and diagnose.
  *
+ * Progress events are accumulated locally, using atomics so that they may be
+ * reported from any thread, and are only reported once per ProgressInterval.
+ * Satellites only accumulate; reporting, to the client and to local
+ * observers, is done by the root node alone.
+ *
  * This also handles abort by sending an abort flag back on each progress event.
  *
  * Progress events are currently not supported in multi-clients mode.
@@ -106,6 +111,16 @@ public:
   vtkGetMacro(ProgressInterval, double);
   ///@}
 
+  ///@{
+  /**
+   * Get the number of progress events received from registered objects and the
+   * number of them that were actually reported after throttling. These are
+   * cumulative over the lifetime of this handler.
+   */
+  vtkTypeUInt64 GetNumberOfProgressEvents();
+  vtkTypeUInt64 GetNumberOfReportedProgressEvents();
+  ///@}
+
   ///@{
   /**
    * These are only valid in handler for the vtkCommand::ProgressEvent.
@@ -180,6 +195,14 @@ private:
    */
   void OnProgressEvent(vtkObject* caller, unsigned long eventid, void* calldata);
 
+  /**
+   * Report the progress accumulated since the last report unless it matches
+   * the last reported one. `caller` is the object whose event triggered the
+   * report, if any. The progress text is taken from the object that reported
+   * the pending progress. Returns true if progress was reported.
+   */
+  bool FlushProgress(vtkObject* caller);
+
   /**
    * Callback called when events from vtkOutputWindow singleton are received.
    * This is also called when vtkCommand::MessageEvent is received from any
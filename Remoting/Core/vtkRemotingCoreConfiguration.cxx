@@ -339,6 +339,21 @@ bool vtkRemotingCoreConfiguration::PopulateConnectionOptions(
       "By default, the hostname is determined using appropriate system calls.")
     ->default_val(this->HostName);
 
+  groupConnection
+    ->add_option("--data-sockets", this->NumberOfDataSockets,
+      "Number of additional sockets used to transfer bulk data, such as geometry delivered to the "
+      "client, in parallel. The smaller of the values requested by the client and the server is "
+      "used. 0 disables the additional sockets.")
+    ->default_val(ptype == vtkProcessModule::PROCESS_CLIENT ? 0 : 8)
+    ->check(CLI::Range(0, 16));
+
+  groupConnection
+    ->add_option("--data-sockets-timeout", this->DataSocketsTimeout,
+      "Time, in seconds, to wait for each additional data socket to connect. If it expires, bulk "
+      "data uses the main connection.")
+    ->default_val(this->DataSocketsTimeout)
+    ->check(CLI::Range(1, 600));
+
   if (ptype == vtkProcessModule::PROCESS_SERVER || ptype == vtkProcessModule::PROCESS_DATA_SERVER ||
     ptype == vtkProcessModule::PROCESS_RENDER_SERVER)
   {
@@ -636,6 +651,8 @@ void vtkRemotingCoreConfiguration::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "BindAddress: " << this->BindAddress << endl;
   os << indent << "ReverseConnection: " << this->ReverseConnection << endl;
   os << indent << "ConnectID: " << this->ConnectID << endl;
+  os << indent << "NumberOfDataSockets: " << this->NumberOfDataSockets << endl;
+  os << indent << "DataSocketsTimeout: " << this->DataSocketsTimeout << endl;
   os << indent << "ServerURL: " << this->ServerURL.c_str() << endl;
   os << indent << "ServerResourceName: " << this->ServerResourceName.c_str() << endl;
   os << indent << "Timeout: " << this->Timeout << endl;
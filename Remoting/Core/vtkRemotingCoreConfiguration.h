@@ -130,6 +130,29 @@ public:
   vtkGetMacro(ConnectID, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the number of additional sockets that client-server connections
+   * use to transfer bulk data, such as geometry delivered to the client, in
+   * parallel. Both processes request a number of sockets and the smaller one
+   * is used, 0 disabling the additional sockets.
+   * Default is 0 on the client and 8 on servers.
+   */
+  vtkSetClampMacro(NumberOfDataSockets, int, 0, 16);
+  vtkGetMacro(NumberOfDataSockets, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the time, in seconds, that the process accepting a client-server
+   * connection waits for each additional data socket to connect. If it
+   * expires, the connection does not use additional data sockets.
+   * Default is 2.
+   */
+  vtkSetClampMacro(DataSocketsTimeout, int, 1, 600);
+  vtkGetMacro(DataSocketsTimeout, int);
+  ///@}
+
   ///@{
   /**
    * Set/Get the expected infrastructure imposed timeout of the server.
@@ -365,6 +388,8 @@ private:
   int ServerPort = 0;
   bool ReverseConnection = false;
   int ConnectID = 0;
+  int NumberOfDataSockets = 0;
+  int DataSocketsTimeout = 2;
   std::string ServerURL;
   std::string ServerResourceName;
   int Timeout = 0;
@@ -4,7 +4,10 @@
 
 #include "vtkClientSocket.h"
 #include "vtkCommand.h"
+#include "vtkCompositeMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkProcessModule.h"
 #include "vtkRemotingCoreConfiguration.h"
 #include "vtkServerSocket.h"
 #include "vtkSmartPointer.h"
@@ -18,11 +21,18 @@
 #include <vtksys/SystemInformation.hxx>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 // set this to 1 if you want to generate a log file with all the raw socket
@@ -31,6 +41,22 @@
 
 #define MAX_SOCKETS 256
 
+namespace
+{
+// Limits for the additional data sockets of a connection.
+constexpr int MAX_DATA_SOCKETS = 16;
+// Payloads smaller than this are sent over the main connection.
+constexpr vtkIdType MIN_STRIPED_LENGTH = 1 << 16;
+// Largest block passed to a single vtkSocket::Send/Receive call.
+constexpr vtkIdType MAX_SOCKET_BLOCK = 1 << 30;
+
+struct vtkDataChannel
+{
+  vtkWeakPointer<vtkMultiProcessController> Controller;
+  std::vector<vtkSmartPointer<vtkClientSocket>> Sockets;
+};
+}
+
 class vtkTCPNetworkAccessManager::vtkInternals
 {
 public:
@@ -38,8 +64,136 @@ public:
   VectorOfControllers Controllers;
   typedef std::map<int, vtkSmartPointer<vtkServerSocket>> MapToServerSockets;
   MapToServerSockets ServerSockets;
+
+  // Data sockets of the connections, keyed by their socket controller.
+  // Transfers may happen on other threads than the one processing events.
+  std::mutex DataChannelsMutex;
+  std::map<vtkMultiProcessController*, std::shared_ptr<vtkDataChannel>> DataChannels;
+
+  void RegisterDataChannel(vtkMultiProcessController* controller,
+    const std::vector<vtkSmartPointer<vtkClientSocket>>& sockets)
+  {
+    auto channel = std::make_shared<vtkDataChannel>();
+    channel->Controller = controller;
+    channel->Sockets = sockets;
+    std::lock_guard<std::mutex> lock(this->DataChannelsMutex);
+    this->DataChannels[controller] = channel;
+  }
+
+  void RemoveDataChannel(vtkMultiProcessController* controller)
+  {
+    std::lock_guard<std::mutex> lock(this->DataChannelsMutex);
+    this->DataChannels.erase(controller);
+  }
+
+  std::shared_ptr<vtkDataChannel> GetDataChannel(vtkMultiProcessController* controller)
+  {
+    std::lock_guard<std::mutex> lock(this->DataChannelsMutex);
+    // release channels of connections that no longer exist.
+    for (auto iter = this->DataChannels.begin(); iter != this->DataChannels.end();)
+    {
+      if (iter->second->Controller == nullptr)
+      {
+        iter = this->DataChannels.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+    auto iter = this->DataChannels.find(controller);
+    return iter != this->DataChannels.end() ? iter->second : nullptr;
+  }
+
+  // Returns the data channel of the connection `controller` communicates
+  // over, if any. On the server, sessions wrap the connections in a
+  // vtkCompositeMultiProcessController and pass it instead of the socket
+  // controller the channel was registered with, so it is resolved to the
+  // active connection first. The channels belong to the network access
+  // manager of the process module, which created the connections.
+  static std::shared_ptr<vtkDataChannel> FindDataChannel(vtkMultiProcessController* controller)
+  {
+    if (auto composite = vtkCompositeMultiProcessController::SafeDownCast(controller))
+    {
+      controller = composite->GetActiveController();
+    }
+    auto pm = vtkProcessModule::GetProcessModule();
+    auto manager =
+      vtkTCPNetworkAccessManager::SafeDownCast(pm ? pm->GetNetworkAccessManager() : nullptr);
+    return (manager && controller) ? manager->Internals->GetDataChannel(controller) : nullptr;
+  }
 };
 
+namespace
+{
+
+// Sends or receives `length` bytes split in one contiguous stripe per
+// socket, each on its own thread. Both sides compute the same stripes.
+bool TransferStripes(vtkDataChannel& channel, char* data, vtkIdType length, bool sending)
+{
+  const vtkIdType numSockets = static_cast<vtkIdType>(channel.Sockets.size());
+  const vtkIdType stripeLength = (length + numSockets - 1) / numSockets;
+  std::atomic<bool> ok(true);
+  std::vector<std::thread> threads;
+  for (vtkIdType cc = 0; cc < numSockets && cc * stripeLength < length; ++cc)
+  {
+    const vtkIdType begin = cc * stripeLength;
+    const vtkIdType end = std::min(length, begin + stripeLength);
+    vtkClientSocket* socket = channel.Sockets[cc];
+    threads.emplace_back(
+      [&ok, socket, data, begin, end, sending]()
+      {
+        for (vtkIdType offset = begin; offset < end && ok; offset += MAX_SOCKET_BLOCK)
+        {
+          const int blockLength = static_cast<int>(std::min(MAX_SOCKET_BLOCK, end - offset));
+          const bool blockOk = sending ? socket->Send(data + offset, blockLength) != 0
+                                       : socket->Receive(data + offset, blockLength) == blockLength;
+          if (!blockOk)
+          {
+            ok = false;
+          }
+        }
+      });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  return ok;
+}
+
+void EncodeUInt32(char* dest, vtkTypeUInt32 value)
+{
+  for (int cc = 0; cc < 4; ++cc)
+  {
+    dest[cc] = static_cast<char>((value >> (8 * cc)) & 0xff);
+  }
+}
+
+vtkTypeUInt32 DecodeUInt32(const char* src)
+{
+  vtkTypeUInt32 value = 0;
+  for (int cc = 0; cc < 4; ++cc)
+  {
+    value |= static_cast<vtkTypeUInt32>(static_cast<unsigned char>(src[cc])) << (8 * cc);
+  }
+  return value;
+}
+
+// Data sockets identify themselves with the cookie sent on the main
+// connection followed by their index, encoded in little-endian order.
+constexpr int DATA_SOCKET_HEADER_LENGTH = 12;
+
+void EncodeDataSocketHeader(unsigned char* header, vtkTypeUInt64 cookie, vtkTypeUInt32 index)
+{
+  for (int cc = 0; cc < 8; ++cc)
+  {
+    header[cc] = static_cast<unsigned char>((cookie >> (8 * cc)) & 0xff);
+  }
+  EncodeUInt32(reinterpret_cast<char*>(header + 8), index);
+}
+}
+
 vtkStandardNewMacro(vtkTCPNetworkAccessManager);
 //----------------------------------------------------------------------------
 vtkTCPNetworkAccessManager::vtkTCPNetworkAccessManager()
@@ -291,6 +445,7 @@ int vtkTCPNetworkAccessManager::ProcessEventsInternal(
     vtkSocketCommunicator* comm =
       vtkSocketCommunicator::SafeDownCast(controller->GetCommunicator());
     comm->CloseConnection();
+    this->Internals->RemoveDataChannel(controller);
 
     // Fire an event letting the world know that the connection was closed.
     this->InvokeEvent(vtkCommand::ConnectionClosedEvent, controller);
@@ -414,7 +569,9 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::ConnectToRemote(const cha
 #endif
   comm->SetSocket(cs);
   int errorcode = HANDSHAKE_SOCKET_COMMUNICATOR_DIFFERENT;
-  if (!comm->Handshake() || (errorcode = this->ParaViewHandshake(controller, false, handshake)))
+  int numberOfDataSockets = 0;
+  if (!comm->Handshake() ||
+    (errorcode = this->ParaViewHandshake(controller, false, handshake, numberOfDataSockets)))
   {
     controller->Delete();
     // handshake failed, must be bogus client, continue waiting (unless
@@ -423,6 +580,7 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::ConnectToRemote(const cha
     result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_HANDSHAKE_ERROR;
     return nullptr;
   }
+  this->NegotiateDataSockets(controller, false, hostname, numberOfDataSockets);
   this->Internals->Controllers.emplace_back(controller);
   result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_SUCCESS;
   return controller;
@@ -471,6 +629,7 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::WaitForConnection(int por
 
   this->AbortPendingConnectionFlag = false;
   vtkSocketController* controller = nullptr;
+  int numberOfDataSockets = 0;
 
   while (this->AbortPendingConnectionFlag == false && controller == nullptr)
   {
@@ -501,7 +660,7 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::WaitForConnection(int por
     client_socket->FastDelete();
     int errorcode = HANDSHAKE_SOCKET_COMMUNICATOR_DIFFERENT;
     if (comm->Handshake() == 0 ||
-      (errorcode = this->ParaViewHandshake(controller, true, handshake)))
+      (errorcode = this->ParaViewHandshake(controller, true, handshake, numberOfDataSockets)))
     {
       controller->Delete();
       controller = nullptr;
@@ -516,6 +675,7 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::WaitForConnection(int por
 
   if (controller)
   {
+    this->NegotiateDataSockets(controller, true, nullptr, numberOfDataSockets);
     this->Internals->Controllers.emplace_back(controller);
     result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_SUCCESS;
   }
@@ -590,44 +750,205 @@ int vtkTCPNetworkAccessManager::AnalyzeHandshakeAndGetErrorCode(
 }
 
 //----------------------------------------------------------------------------
-int vtkTCPNetworkAccessManager::ParaViewHandshake(
-  vtkMultiProcessController* controller, bool server_side, const char* _handshake)
+int vtkTCPNetworkAccessManager::ParaViewHandshake(vtkMultiProcessController* controller,
+  bool server_side, const char* _handshake, int& numberOfDataSockets)
 {
+  // A side requesting data sockets appends the number it requests, on 4
+  // bytes, after the null-terminated handshake string. The accepting side
+  // answers with the number of data sockets to set up in the upper 16 bits of
+  // the error code. Peers that do not support data sockets ignore the
+  // trailing bytes and answer 0, and nothing is appended when no data socket
+  // is requested, so the exchange is unchanged in that case.
+  auto config = vtkRemotingCoreConfiguration::GetInstance();
+  const int requested = std::min(std::max(config->GetNumberOfDataSockets(), 0), MAX_DATA_SOCKETS);
+  numberOfDataSockets = 0;
+
   const std::string handshake = _handshake ? _handshake : "";
-  int size = static_cast<int>(handshake.size() + 1);
   if (server_side)
   {
     std::string other_handshake;
+    int other_requested = 0;
     int othersize;
     controller->Receive(&othersize, 1, 1, 99991);
     if (othersize > 0)
     {
-      char* _other_handshake = new char[othersize];
-      controller->Receive(_other_handshake, othersize, 1, 99991);
-      other_handshake = _other_handshake;
-      delete[] _other_handshake;
+      std::vector<char> _other_handshake(othersize);
+      controller->Receive(_other_handshake.data(), othersize, 1, 99991);
+      _other_handshake.back() = '\0';
+      other_handshake = _other_handshake.data();
+      const size_t extra = other_handshake.size() + 1;
+      if (static_cast<size_t>(othersize) >= extra + 4)
+      {
+        other_requested = static_cast<int>(::DecodeUInt32(_other_handshake.data() + extra));
+      }
     }
     int errorCode = HANDSHAKE_NO_ERROR;
     if (handshake != other_handshake)
     {
       errorCode = this->AnalyzeHandshakeAndGetErrorCode(other_handshake.c_str(), handshake.c_str());
     }
-    controller->Send(&errorCode, 1, 1, 99990);
+    else
+    {
+      numberOfDataSockets = std::min(requested, other_requested);
+    }
+    int reply = errorCode | (numberOfDataSockets << 16);
+    controller->Send(&reply, 1, 1, 99990);
     return errorCode;
   }
   else
   {
+    std::vector<char> message(handshake.begin(), handshake.end());
+    message.push_back('\0');
+    if (requested > 0)
+    {
+      message.resize(message.size() + 4);
+      ::EncodeUInt32(message.data() + message.size() - 4, static_cast<vtkTypeUInt32>(requested));
+    }
+    int size = static_cast<int>(message.size());
     controller->Send(&size, 1, 1, 99991);
-    if (size > 0)
+    controller->Send(message.data(), size, 1, 99991);
+    int reply = HANDSHAKE_NO_ERROR;
+    controller->Receive(&reply, 1, 1, 99990);
+    const int errorCode = reply & 0xffff;
+    if (errorCode == HANDSHAKE_NO_ERROR && requested > 0)
     {
-      controller->Send(handshake.c_str(), size, 1, 99991);
+      numberOfDataSockets = std::min((reply >> 16) & 0xffff, requested);
     }
-    int errorCode = HANDSHAKE_NO_ERROR;
-    controller->Receive(&errorCode, 1, 1, 99990);
     return errorCode;
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkTCPNetworkAccessManager::NegotiateDataSockets(vtkMultiProcessController* controller,
+  bool server_side, const char* hostname, int count)
+{
+  // Both sides agreed on `count` during the handshake. Nothing is exchanged
+  // when it is 0.
+  if (count <= 0)
+  {
+    return;
+  }
+
+  // The side that accepted the main connection opens a server socket on any
+  // free port and sends the port and a random cookie that the data sockets
+  // must present.
+  auto config = vtkRemotingCoreConfiguration::GetInstance();
+  std::vector<vtkSmartPointer<vtkClientSocket>> sockets;
+  int status = 0;
+  if (server_side)
+  {
+    vtkNew<vtkServerSocket> server_socket;
+    int port = 0;
+    if (server_socket->CreateServer(0, config->GetBindAddress()) != 0)
+    {
+      vtkWarningMacro("Failed to set up server socket for data sockets.");
+    }
+    else
+    {
+      port = server_socket->GetServerPort();
+    }
+
+    std::random_device rd;
+    const vtkTypeUInt64 cookie = (static_cast<vtkTypeUInt64>(rd()) << 32) | rd();
+    controller->Send(&port, 1, 1, 99993);
+    controller->Send(&cookie, 1, 1, 99993);
+
+    // Each data socket is expected shortly after the port was sent.
+    const unsigned long timeout_msecs =
+      static_cast<unsigned long>(config->GetDataSocketsTimeout()) * 1000;
+    sockets.resize(count);
+    int accepted = 0;
+    for (; port != 0 && accepted < count; ++accepted)
+    {
+      vtkSmartPointer<vtkClientSocket> socket;
+      socket.TakeReference(server_socket->WaitForConnection(timeout_msecs));
+      unsigned char header[DATA_SOCKET_HEADER_LENGTH];
+      if (!socket ||
+        socket->Receive(header, DATA_SOCKET_HEADER_LENGTH) != DATA_SOCKET_HEADER_LENGTH)
+      {
+        break;
+      }
+      unsigned char expected[DATA_SOCKET_HEADER_LENGTH];
+      ::EncodeDataSocketHeader(expected, cookie, static_cast<vtkTypeUInt32>(accepted));
+      if (memcmp(header, expected, DATA_SOCKET_HEADER_LENGTH) != 0)
+      {
+        break;
+      }
+      sockets[accepted] = socket;
+    }
+    server_socket->CloseSocket();
+
+    int connected = 0;
+    controller->Receive(&connected, 1, 1, 99994);
+    status = (accepted == count && connected == count) ? 1 : 0;
+    controller->Send(&status, 1, 1, 99995);
+  }
+  else
+  {
+    int port = 0;
+    vtkTypeUInt64 cookie = 0;
+    controller->Receive(&port, 1, 1, 99993);
+    controller->Receive(&cookie, 1, 1, 99993);
+
+    int connected = 0;
+    for (; port != 0 && connected < count; ++connected)
+    {
+      vtkNew<vtkClientSocket> socket;
+      unsigned char header[DATA_SOCKET_HEADER_LENGTH];
+      ::EncodeDataSocketHeader(header, cookie, static_cast<vtkTypeUInt32>(connected));
+      if (socket->ConnectToServer(hostname, port) != 0 ||
+        !socket->Send(header, DATA_SOCKET_HEADER_LENGTH))
+      {
+        break;
+      }
+      sockets.emplace_back(socket);
+    }
+
+    controller->Send(&connected, 1, 1, 99994);
+    controller->Receive(&status, 1, 1, 99995);
+  }
+
+  if (status == 1)
+  {
+    this->Internals->RegisterDataChannel(controller, sockets);
+  }
+  else
+  {
+    vtkWarningMacro("Failed to connect data sockets. Bulk data will use the main connection.");
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkTCPNetworkAccessManager::SendBulkData(
+  vtkMultiProcessController* controller, const char* data, vtkIdType length, int tag)
+{
+  auto channel = vtkInternals::FindDataChannel(controller);
+  if (!channel || length < MIN_STRIPED_LENGTH)
+  {
+    return controller->Send(data, length, 1, tag);
+  }
+  return ::TransferStripes(*channel, const_cast<char*>(data), length, /*sending=*/true) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkTCPNetworkAccessManager::ReceiveBulkData(
+  vtkMultiProcessController* controller, char* data, vtkIdType length, int tag)
+{
+  auto channel = vtkInternals::FindDataChannel(controller);
+  if (!channel || length < MIN_STRIPED_LENGTH)
+  {
+    return controller->Receive(data, length, 1, tag);
+  }
+  return ::TransferStripes(*channel, data, length, /*sending=*/false) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkTCPNetworkAccessManager::GetNumberOfDataSockets(vtkMultiProcessController* controller)
+{
+  auto channel = vtkInternals::FindDataChannel(controller);
+  return channel ? static_cast<int>(channel->Sockets.size()) : 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkTCPNetworkAccessManager::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -100,6 +100,31 @@ public:
    */
   bool GetWrongConnectID() override;
 
+  ///@{
+  /**
+   * Transfer bulk data, such as marshalled geometry, over a connection created
+   * by the network access manager of the process module. `controller` is
+   * either the socket controller of the connection or a
+   * vtkCompositeMultiProcessController whose active controller it is, as
+   * returned by sessions on the server. When additional data sockets were negotiated for the
+   * connection (see vtkRemotingCoreConfiguration::GetNumberOfDataSockets),
+   * large payloads are split in stripes sent in parallel over those sockets,
+   * leaving the main connection to control messages. Otherwise, or for small
+   * payloads, this simply uses `controller` with the given `tag`.
+   * Both sides must know `length` beforehand. Returns 1 on success, 0 on failure.
+   */
+  static int SendBulkData(
+    vtkMultiProcessController* controller, const char* data, vtkIdType length, int tag);
+  static int ReceiveBulkData(
+    vtkMultiProcessController* controller, char* data, vtkIdType length, int tag);
+  ///@}
+
+  /**
+   * Returns the number of additional data sockets negotiated for the
+   * connection, 0 if none.
+   */
+  static int GetNumberOfDataSockets(vtkMultiProcessController* controller);
+
 protected:
   vtkTCPNetworkAccessManager();
   ~vtkTCPNetworkAccessManager() override;
@@ -129,8 +154,24 @@ protected:
     HANDSHAKE_UNKNOWN_ERROR
   };
 
-  int ParaViewHandshake(
-    vtkMultiProcessController* controller, bool server_side, const char* handshake);
+  /**
+   * Exchanges the handshake strings. Both sides also agree on the number of
+   * additional data sockets to set up, returned in `numberOfDataSockets`:
+   * the smaller of the numbers they request, 0 if the peer does not support
+   * data sockets.
+   */
+  int ParaViewHandshake(vtkMultiProcessController* controller, bool server_side,
+    const char* handshake, int& numberOfDataSockets);
+
+  /**
+   * Called after a successful handshake to set up the `count` additional data
+   * sockets agreed on by ParaViewHandshake(). Nothing is exchanged when
+   * `count` is 0. `hostname` is the remote host when `server_side` is false.
+   * On failure, the connection is kept and simply has no additional data
+   * sockets.
+   */
+  void NegotiateDataSockets(
+    vtkMultiProcessController* controller, bool server_side, const char* hostname, int count);
   void PrintHandshakeError(int errorcode, bool server_side);
   int AnalyzeHandshakeAndGetErrorCode(const char* clientHS, const char* serverHS);
 
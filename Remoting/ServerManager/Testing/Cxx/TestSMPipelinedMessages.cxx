@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDummyController.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkPVSessionServer.h"
+#include "vtkSMSessionClientInternals.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+std::vector<unsigned char> MakeMessage(int id)
+{
+  vtkMultiProcessStream stream;
+  stream << id;
+  std::vector<unsigned char> raw_message;
+  stream.GetRawData(raw_message);
+  return raw_message;
+}
+
+// Returns the ids of the messages in `raw_message`, unpacking batches.
+std::vector<int> GetMessageIds(const std::vector<unsigned char>& raw_message)
+{
+  vtkMultiProcessStream stream;
+  stream.SetRawData(raw_message);
+  int type;
+  stream >> type;
+  if (type != vtkPVSessionServer::PIPELINED_BATCH)
+  {
+    return { type };
+  }
+  std::vector<int> ids;
+  int count;
+  stream >> count;
+  for (int cc = 0; cc < count; ++cc)
+  {
+    unsigned char* sub_message = nullptr;
+    unsigned int size = 0;
+    stream.Pop(sub_message, size);
+    auto sub_ids = GetMessageIds(std::vector<unsigned char>(sub_message, sub_message + size));
+    ids.insert(ids.end(), sub_ids.begin(), sub_ids.end());
+    delete[] sub_message;
+  }
+  return ids;
+}
+
+using SentType = std::vector<std::pair<vtkMultiProcessController*, std::vector<int>>>;
+
+bool CheckSent(const SentType& sent, const SentType& expected, const char* what)
+{
+  if (sent != expected)
+  {
+    std::cerr << "ERROR: Unexpected messages sent " << what << ":" << std::endl;
+    for (const auto& item : sent)
+    {
+      std::cerr << "  " << item.first << ":";
+      for (int id : item.second)
+      {
+        std::cerr << " " << id;
+      }
+      std::cerr << std::endl;
+    }
+    return false;
+  }
+  return true;
+}
+}
+
+extern int TestSMPipelinedMessages(int, char*[])
+{
+  vtkNew<vtkDummyController> dataServer;
+  vtkNew<vtkDummyController> renderServer;
+  vtkMultiProcessController* ds = dataServer;
+  vtkMultiProcessController* rs = renderServer;
+
+  SentType sent;
+  vtkSMPipelinedMessages messages;
+  messages.SendFunction = [&sent](vtkMultiProcessController* controller,
+                            const std::vector<unsigned char>& raw_message) {
+    sent.emplace_back(controller, GetMessageIds(raw_message));
+  };
+
+  // Nothing is sent until the queue is flushed.
+  messages.Push(ds, MakeMessage(1));
+  messages.Push(ds, MakeMessage(2));
+  messages.Push(rs, MakeMessage(3));
+  messages.Push(ds, MakeMessage(4));
+  messages.Push(rs, MakeMessage(5));
+  messages.Push(rs, MakeMessage(6));
+  if (!CheckSent(sent, {}, "before flushing"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Both servers receive the messages in the order they were pushed, and
+  // consecutive messages for the same server are batched.
+  messages.Flush();
+  if (!CheckSent(sent, { { ds, { 1, 2 } }, { rs, { 3 } }, { ds, { 4 } }, { rs, { 5, 6 } } },
+        "on flush") ||
+    messages.NumberOfBytes != 0)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // A request followed by a read flushes messages queued for every server
+  // before it is sent.
+  sent.clear();
+  messages.Push(ds, MakeMessage(7));
+  messages.Push(rs, MakeMessage(8));
+  messages.SendNow(rs, MakeMessage(9));
+  messages.SendNow(ds, MakeMessage(10));
+  if (!CheckSent(sent, { { ds, { 7 } }, { rs, { 8 } }, { rs, { 9 } }, { ds, { 10 } } },
+        "on read"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
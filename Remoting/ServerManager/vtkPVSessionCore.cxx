@@ -31,6 +31,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define LOG(x)                                                                                     \
   if (this->LogStream)                                                                             \
@@ -556,10 +557,19 @@ void vtkPVSessionCore::ExecuteStream(
       this->ParallelController->GetLocalProcessId() == 0)
     {
       // Forward the message to the satellites if the object is expected to exist
-      // on the satellites.
-      size_t byte_size;
-      const unsigned char* raw_data;
-      stream.GetData(&raw_data, &byte_size);
+      // on the satellites. The stream is broadcast segment by segment so that
+      // arrays inserted by reference are not copied into the stream first.
+      const int num_segments = stream.GetNumberOfDataSegments();
+      std::vector<vtkIdType> header(num_segments + 2);
+      header[0] = num_segments;
+      header[1] = (ignore_errors ? 1 : 0);
+      for (int cc = 0; cc < num_segments; ++cc)
+      {
+        const unsigned char* raw_data;
+        size_t byte_size;
+        stream.GetDataSegment(cc, &raw_data, &byte_size);
+        header[cc + 2] = static_cast<vtkIdType>(byte_size);
+      }
 
       // FIXME: There's one flaw in this logic. If a object is to be created on
       // DATA_SERVER_ROOT, but on all RENDER_SERVER nodes, then in render-server
@@ -568,11 +578,20 @@ void vtkPVSessionCore::ExecuteStream(
       // and we should fix this.
       unsigned char type = EXECUTE_STREAM;
       this->ParallelController->TriggerRMIOnAllChildren(&type, 1, ROOT_SATELLITE_RMI_TAG);
-      int size[2];
-      size[0] = static_cast<int>(byte_size);
-      size[1] = (ignore_errors ? 1 : 0);
-      this->ParallelController->Broadcast(size, 2, 0);
-      this->ParallelController->Broadcast(const_cast<unsigned char*>(raw_data), size[0], 0);
+      vtkIdType header_size = static_cast<vtkIdType>(header.size());
+      this->ParallelController->Broadcast(&header_size, 1, 0);
+      this->ParallelController->Broadcast(header.data(), header_size, 0);
+      for (int cc = 0; cc < num_segments; ++cc)
+      {
+        const unsigned char* raw_data;
+        size_t byte_size;
+        stream.GetDataSegment(cc, &raw_data, &byte_size);
+        if (byte_size > 0)
+        {
+          this->ParallelController->Broadcast(
+            const_cast<unsigned char*>(raw_data), static_cast<vtkIdType>(byte_size), 0);
+        }
+      }
     }
   }
 
@@ -582,15 +601,97 @@ void vtkPVSessionCore::ExecuteStream(
 //----------------------------------------------------------------------------
 void vtkPVSessionCore::ExecuteStreamSatelliteCallback()
 {
-  int byte_size[2] = { 0, 0 };
-  this->ParallelController->Broadcast(byte_size, 2, 0);
-  unsigned char* raw_data = new unsigned char[byte_size[0] + 1];
-  this->ParallelController->Broadcast(raw_data, byte_size[0], 0);
+  vtkIdType header_size = 0;
+  this->ParallelController->Broadcast(&header_size, 1, 0);
+  std::vector<vtkIdType> header(header_size);
+  this->ParallelController->Broadcast(header.data(), header_size, 0);
+
+  // Receive all segments into one contiguous buffer.
+  vtkIdType total_size = 0;
+  for (vtkIdType cc = 0; cc < header[0]; ++cc)
+  {
+    total_size += header[cc + 2];
+  }
+  std::vector<unsigned char> raw_data(total_size + 1);
+  vtkIdType offset = 0;
+  for (vtkIdType cc = 0; cc < header[0]; ++cc)
+  {
+    if (header[cc + 2] > 0)
+    {
+      this->ParallelController->Broadcast(raw_data.data() + offset, header[cc + 2], 0);
+      offset += header[cc + 2];
+    }
+  }
 
   vtkClientServerStream stream;
-  stream.SetData(raw_data, byte_size[0]);
-  this->ExecuteStreamInternal(stream, byte_size[1] != 0);
-  delete[] raw_data;
+  stream.SetData(raw_data.data(), total_size);
+  this->ExecuteStreamInternal(stream, header[1] != 0);
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSessionCore::SendStream(
+  vtkMultiProcessController* controller, const vtkClientServerStream& stream, int remoteId, int tag)
+{
+  // Send the segment layout first, then each non-empty segment.
+  const int num_segments = stream.GetNumberOfDataSegments();
+  std::vector<vtkIdType> sizes(num_segments);
+  for (int cc = 0; cc < num_segments; ++cc)
+  {
+    const unsigned char* data;
+    size_t length;
+    stream.GetDataSegment(cc, &data, &length);
+    sizes[cc] = static_cast<vtkIdType>(length);
+  }
+  if (!controller->Send(&num_segments, 1, remoteId, tag) ||
+    (num_segments > 0 && !controller->Send(sizes.data(), num_segments, remoteId, tag)))
+  {
+    return false;
+  }
+  for (int cc = 0; cc < num_segments; ++cc)
+  {
+    const unsigned char* data;
+    size_t length;
+    stream.GetDataSegment(cc, &data, &length);
+    if (length > 0 && !controller->Send(data, sizes[cc], remoteId, tag))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSessionCore::ReceiveStream(
+  vtkMultiProcessController* controller, vtkClientServerStream& stream, int remoteId, int tag)
+{
+  int num_segments = 0;
+  if (!controller->Receive(&num_segments, 1, remoteId, tag) || num_segments < 0)
+  {
+    return false;
+  }
+  std::vector<vtkIdType> sizes(num_segments);
+  if (num_segments > 0 && !controller->Receive(sizes.data(), num_segments, remoteId, tag))
+  {
+    return false;
+  }
+
+  // Gather all segments into one contiguous buffer.
+  vtkIdType total_size = 0;
+  for (vtkIdType size : sizes)
+  {
+    total_size += size;
+  }
+  std::vector<unsigned char> raw_data(total_size + 1);
+  vtkIdType offset = 0;
+  for (vtkIdType size : sizes)
+  {
+    if (size > 0 && !controller->Receive(raw_data.data() + offset, size, remoteId, tag))
+    {
+      return false;
+    }
+    offset += size;
+  }
+  return stream.SetData(raw_data.data(), total_size) != 0;
 }
 
 //----------------------------------------------------------------------------
@@ -163,6 +163,20 @@ public:
   void RegisterSIObjectSatelliteCallback();
   void UnRegisterSIObjectSatelliteCallback();
 
+  ///@{
+  /**
+   * Send or receive a vtkClientServerStream segment by segment (see
+   * vtkClientServerStream::GetDataSegment). Arrays inserted in the stream
+   * with vtkClientServerStream::InsertArrayReference are sent directly from
+   * their source buffer. The receiving side gets a regular stream. Both ends
+   * must use these methods with the same tag.
+   */
+  static bool SendStream(vtkMultiProcessController* controller,
+    const vtkClientServerStream& stream, int remoteId, int tag);
+  static bool ReceiveStream(vtkMultiProcessController* controller, vtkClientServerStream& stream,
+    int remoteId, int tag);
+  ///@}
+
   /**
    * Allow the user to fill a vtkCollection with all RemoteObjects
    * This is useful when you want to hold a reference to them to
@@ -580,13 +580,11 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int messageLeng
 
     case vtkPVSessionServer::EXECUTE_STREAM:
     {
-      int ignoreErrors, sendReply, size;
-      stream >> ignoreErrors >> sendReply >> size;
-      unsigned char* css_data = new unsigned char[size + 1];
-      this->Internal->GetActiveController()->Receive(
-        css_data, size, 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+      int ignoreErrors, sendReply;
+      stream >> ignoreErrors >> sendReply;
       vtkClientServerStream cssStream;
-      cssStream.SetData(css_data, size);
+      vtkPVSessionCore::ReceiveStream(this->Internal->GetActiveController(), cssStream, 1,
+        vtkPVSessionServer::EXECUTE_STREAM_TAG);
       this->ExecuteStream(vtkPVSession::CLIENT_AND_SERVERS, cssStream, ignoreErrors != 0);
 
       if (sendReply)
@@ -595,7 +593,39 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int messageLeng
         this->Internal->GetActiveController()->Send(
           &dummy, 1, 1, vtkPVSessionServer::STREAM_EXECUTED);
       }
+    }
+    break;
+
+    case vtkPVSessionServer::EXECUTE_STREAM_PIPELINED:
+    {
+      // Same as EXECUTE_STREAM, with the stream embedded in the message and
+      // no reply.
+      int ignoreErrors;
+      stream >> ignoreErrors;
+      unsigned char* css_data = nullptr;
+      unsigned int size = 0;
+      stream.Pop(css_data, size);
+      vtkClientServerStream cssStream;
+      cssStream.SetData(css_data, size);
       delete[] css_data;
+      this->ExecuteStream(vtkPVSession::CLIENT_AND_SERVERS, cssStream, ignoreErrors != 0);
+    }
+    break;
+
+    case vtkPVSessionServer::PIPELINED_BATCH:
+    {
+      // Messages queued by the client while in pipelined execution mode.
+      // Process them in order, as if they had been sent one at a time.
+      int count;
+      stream >> count;
+      for (int cc = 0; cc < count; ++cc)
+      {
+        unsigned char* sub_message = nullptr;
+        unsigned int size = 0;
+        stream.Pop(sub_message, size);
+        this->OnClientServerMessageRMI(sub_message, static_cast<int>(size));
+        delete[] sub_message;
+      }
     }
     break;
 
@@ -20,6 +20,7 @@
 #include "vtkThreadedCallbackQueue.h"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <mutex>
 #include <unordered_map>
 
@@ -68,6 +69,28 @@ struct FutureWorker
 };
 
 std::atomic_int FutureWorker::Counter{ 0 };
+
+//----------------------------------------------------------------------------
+// Waits for the oldest pending writes until fewer than `maxPending` remain.
+void WaitForPendingWrites(std::size_t maxPending)
+{
+  while (true)
+  {
+    vtkThreadedCallbackQueue::SharedFutureBasePointer oldest;
+    {
+      std::lock_guard<std::mutex> lock(FutureMutex);
+      if (SharedFutures.size() < maxPending)
+      {
+        return;
+      }
+      auto iter = std::min_element(SharedFutures.begin(), SharedFutures.end(),
+        [](const FutureContainer::value_type& a, const FutureContainer::value_type& b)
+        { return a.second.first < b.second.first; });
+      oldest = iter->second.second;
+    }
+    oldest->Wait();
+  }
+}
 }
 
 //----------------------------------------------------------------------------
@@ -127,6 +150,10 @@ int vtkRemoteWriterHelper::RequestData(
         {
           return;
         }
+        // Bound the number of images waiting to be written so that memory
+        // does not grow when images are produced faster than they are written.
+        ::WaitForPendingWrites(callbackQueue->GetNumberOfThreads() + 1);
+
         ::FutureWorker worker{ imageWriter->GetFileName() };
         // We need to lock guard modifying SharedFutures because the function
         // we are pushing removes its futures from it in an asynchronous way
@@ -205,10 +232,19 @@ int vtkRemoteWriterHelper::RequestData(
 //----------------------------------------------------------------------------
 void vtkRemoteWriterHelper::Wait(const std::string& fileName)
 {
-  auto it = ::SharedFutures.find(vtksys::SystemTools::CollapseFullPath(fileName));
-  if (it != ::SharedFutures.end())
+  vtkThreadedCallbackQueue::SharedFutureBasePointer future;
+  {
+    // workers erase their entry once done, so only hold the lock for the lookup.
+    std::lock_guard<std::mutex> lock(::FutureMutex);
+    auto it = ::SharedFutures.find(vtksys::SystemTools::CollapseFullPath(fileName));
+    if (it != ::SharedFutures.end())
+    {
+      future = it->second.second;
+    }
+  }
+  if (future)
   {
-    it->second.second->Wait();
+    future->Wait();
   }
 }
 
@@ -216,9 +252,12 @@ void vtkRemoteWriterHelper::Wait(const std::string& fileName)
 void vtkRemoteWriterHelper::Wait()
 {
   std::vector<vtkThreadedCallbackQueue::SharedFutureBasePointer> filenames;
-  for (auto& item : ::SharedFutures)
   {
-    filenames.push_back(item.second.second);
+    std::lock_guard<std::mutex> lock(::FutureMutex);
+    for (auto& item : ::SharedFutures)
+    {
+      filenames.push_back(item.second.second);
+    }
   }
   vtkProcessModule::GetProcessModule()->GetCallbackQueue()->Wait(filenames);
 }
@@ -61,7 +61,10 @@ public:
   /**
    * If set to true, this helper will attempt writing the file in the background in parallel.
    * As of today, only images can go this path (.jpeg, .png, etc.). Otherwise, writing a file will
-   * happen serially in all circumstances.
+   * happen serially in all circumstances. At most one more image than the number of threads of
+   * `vtkProcessModule::GetCallbackQueue()` waits to be written: writing blocks until a previous
+   * image is written when that limit is reached. Since the writer writes in the background, it
+   * must not be modified until Wait() returns for the file.
    */
   vtkSetMacro(TryWritingInBackground, bool);
   vtkGetMacro(TryWritingInBackground, bool);
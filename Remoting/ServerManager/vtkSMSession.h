@@ -99,6 +99,25 @@ public:
    */
   virtual unsigned int GetRenderClientMode();
 
+  ///@{
+  /**
+   * Begin/end a section during which push-only requests (state pushes,
+   * SIObject registration and ExecuteStream calls that do not need a reply)
+   * may be queued and sent to the server(s) in batches instead of one
+   * network message each. Calls nest. Any request that needs a reply, and
+   * the outermost EndPipelinedExecution(), flush the queue first, so the
+   * caller only blocks when a result is actually read. The default
+   * implementation does nothing since there is no network involved.
+   */
+  virtual void BeginPipelinedExecution() {}
+  virtual void EndPipelinedExecution() {}
+  ///@}
+
+  /**
+   * Send any request queued since BeginPipelinedExecution().
+   */
+  virtual void FlushPipelinedExecution() {}
+
   //---------------------------------------------------------------------------
   // Undo/Redo related API.
   //---------------------------------------------------------------------------
@@ -314,4 +333,34 @@ private:
   void operator=(const vtkSMSession&) = delete;
 };
 
+/**
+ * Helper to call vtkSMSession::BeginPipelinedExecution() and
+ * vtkSMSession::EndPipelinedExecution() for the lifetime of the scope.
+ */
+class vtkSMPipelinedExecutionScope
+{
+public:
+  vtkSMPipelinedExecutionScope(vtkSMSession* session)
+    : Session(session)
+  {
+    if (this->Session)
+    {
+      this->Session->BeginPipelinedExecution();
+    }
+  }
+  ~vtkSMPipelinedExecutionScope()
+  {
+    if (this->Session)
+    {
+      this->Session->EndPipelinedExecution();
+    }
+  }
+
+private:
+  vtkSMPipelinedExecutionScope(const vtkSMPipelinedExecutionScope&) = delete;
+  void operator=(const vtkSMPipelinedExecutionScope&) = delete;
+
+  vtkSMSession* Session;
+};
+
 #endif
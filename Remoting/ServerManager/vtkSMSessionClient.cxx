@@ -13,6 +13,7 @@
 #include "vtkPVMultiClientsInformation.h"
 #include "vtkPVProgressHandler.h"
 #include "vtkPVServerInformation.h"
+#include "vtkPVSessionCore.h"
 #include "vtkPVSessionServer.h"
 #include "vtkPVVersionQuick.h"
 #include "vtkProcessModule.h"
@@ -26,6 +27,7 @@
 #include "vtkSMProxyManager.h"
 #include "vtkSMProxyProperty.h"
 #include "vtkSMServerStateLocator.h"
+#include "vtkSMSessionClientInternals.h"
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMSettings.h"
 #include "vtkSocketCommunicator.h"
@@ -54,6 +56,7 @@ void RMICallback(
 };
 //****************************************************************************/
 vtkStandardNewMacro(vtkSMSessionClient);
+
 vtkCxxSetObjectMacro(vtkSMSessionClient, RenderServerController, vtkMultiProcessController);
 vtkCxxSetObjectMacro(vtkSMSessionClient, DataServerController, vtkMultiProcessController);
 //----------------------------------------------------------------------------
@@ -83,6 +86,9 @@ vtkSMSessionClient::vtkSMSessionClient()
   // Default value
   this->NoMoreDelete = false;
   this->NotBusy = 0;
+  this->PipelinedExecution = true;
+  this->PipelinedExecutionCount = 0;
+  this->PipelinedMessages = new vtkSMPipelinedMessages();
 }
 
 //----------------------------------------------------------------------------
@@ -111,11 +117,16 @@ vtkSMSessionClient::~vtkSMSessionClient()
 
   delete this->ServerLastInvokeResult;
   this->ServerLastInvokeResult = nullptr;
+  delete this->PipelinedMessages;
+  this->PipelinedMessages = nullptr;
 }
 
 //----------------------------------------------------------------------------
 vtkMultiProcessController* vtkSMSessionClient::GetController(ServerFlags processType)
 {
+  // The caller may talk to the server directly. Make sure it sees all the
+  // requests issued so far.
+  this->FlushPipelinedExecution();
   switch (processType)
   {
     case CLIENT:
@@ -530,6 +541,7 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  this->FlushPipelinedExecution();
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -602,13 +614,17 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
     stream.GetRawData(raw_message);
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(raw_message.data(),
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      this->SendMessageToServer(controllers[cc], raw_message);
     }
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
   {
+    if (num_controllers > 0)
+    {
+      // Local objects may talk to their server counterparts.
+      this->FlushPipelinedExecution();
+    }
     this->Superclass::PushState(message);
 
     // For collaboration purpose we might need to share the proxy state with
@@ -640,8 +656,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         stream << msg.SerializeAsString();
         std::vector<unsigned char> raw_message;
         stream.GetRawData(raw_message);
-        this->DataServerController->TriggerRMIOnAllChildren(raw_message.data(),
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->SendMessageToServer(this->DataServerController, raw_message);
       }
       else if (!remoteObject)
       {
@@ -694,8 +709,7 @@ void vtkSMSessionClient::PullState(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    controller->TriggerRMIOnAllChildren(raw_message.data(), static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->PipelinedMessages->SendNow(controller, raw_message);
 
     // Get the reply
     vtkMultiProcessStream replyStream;
@@ -735,24 +749,43 @@ void vtkSMSessionClient::ExecuteStream(
     controllers[num_controllers++] = this->RenderServerController;
   }
 
-  if (num_controllers > 0)
+  // Streams holding arrays inserted by reference are not queued: queuing
+  // embeds a copy of the stream in the message, while the direct path below
+  // sends the arrays from their source buffers.
+  if (num_controllers > 0 && !sendReply && this->PipelinedExecutionCount > 0 &&
+    cssstream.GetNumberOfDataSegments() <= 1)
   {
+    // Queue the stream along with the other push-only requests. It is
+    // embedded in the message itself.
     const unsigned char* data;
     size_t size;
     cssstream.GetData(&data, &size);
-
+    vtkMultiProcessStream stream;
+    stream << static_cast<int>(vtkPVSessionServer::EXECUTE_STREAM_PIPELINED)
+           << static_cast<int>(ignoreErrors);
+    stream.Push(const_cast<unsigned char*>(data), static_cast<unsigned int>(size));
+    std::vector<unsigned char> raw_message;
+    stream.GetRawData(raw_message);
+    for (int cc = 0; cc < num_controllers; cc++)
+    {
+      this->SendMessageToServer(controllers[cc], raw_message);
+    }
+  }
+  else if (num_controllers > 0)
+  {
     vtkMultiProcessStream stream;
     stream << static_cast<int>(vtkPVSessionServer::EXECUTE_STREAM) << static_cast<int>(ignoreErrors)
-           << static_cast<int>(sendReply) << static_cast<int>(size);
+           << static_cast<int>(sendReply);
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
 
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(raw_message.data(),
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-      controllers[cc]->Send(
-        data, static_cast<int>(size), 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+      this->PipelinedMessages->SendNow(controllers[cc], raw_message);
+      // Send segment by segment so that arrays inserted by reference go
+      // straight from their source buffer to the socket.
+      vtkPVSessionCore::SendStream(
+        controllers[cc], cssstream, 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
       if (sendReply)
       {
         unsigned char dummy;
@@ -763,6 +796,10 @@ void vtkSMSessionClient::ExecuteStream(
 
   if ((location & vtkPVSession::CLIENT) != 0)
   {
+    if (num_controllers > 0)
+    {
+      this->FlushPipelinedExecution();
+    }
     this->Superclass::ExecuteStream(location, cssstream, ignoreErrors);
   }
 }
@@ -796,8 +833,7 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
     stream << static_cast<int>(vtkPVSessionServer::LAST_RESULT);
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    controller->TriggerRMIOnAllChildren(raw_message.data(), static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->PipelinedMessages->SendNow(controller, raw_message);
 
     // Get the reply
     int size = 0;
@@ -870,8 +906,7 @@ bool vtkSMSessionClient::GatherInformation(
 
   if (controller)
   {
-    controller->TriggerRMIOnAllChildren(raw_message.data(), static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->PipelinedMessages->SendNow(controller, raw_message);
 
     int length2 = 0;
     controller->Receive(&length2, 1, 1, vtkPVSessionServer::REPLY_GATHER_INFORMATION_TAG);
@@ -940,13 +975,16 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
     stream.GetRawData(raw_message);
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(raw_message.data(),
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      this->SendMessageToServer(controllers[cc], raw_message);
     }
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
   {
+    if (num_controllers > 0)
+    {
+      this->FlushPipelinedExecution();
+    }
     this->Superclass::UnRegisterSIObject(message);
   }
 }
@@ -983,22 +1021,69 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
     {
       if (controllers[cc] != nullptr)
       {
-        controllers[cc]->TriggerRMIOnAllChildren(raw_message.data(),
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->SendMessageToServer(controllers[cc], raw_message);
       }
     }
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
   {
+    if (num_controllers > 0)
+    {
+      this->FlushPipelinedExecution();
+    }
     this->Superclass::RegisterSIObject(message);
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::SendMessageToServer(
+  vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message)
+{
+  if (this->PipelinedExecutionCount > 0)
+  {
+    this->PipelinedMessages->Push(controller, raw_message);
+    if (this->PipelinedMessages->NumberOfBytes > vtkSMPipelinedMessages::MaximumNumberOfBytes)
+    {
+      this->PipelinedMessages->Flush();
+    }
+  }
+  else
+  {
+    controller->TriggerRMIOnAllChildren(raw_message.data(), static_cast<int>(raw_message.size()),
+      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::BeginPipelinedExecution()
+{
+  if (this->PipelinedExecution)
+  {
+    ++this->PipelinedExecutionCount;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::EndPipelinedExecution()
+{
+  if (this->PipelinedExecutionCount > 0 && --this->PipelinedExecutionCount == 0)
+  {
+    this->FlushPipelinedExecution();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushPipelinedExecution()
+{
+  this->PipelinedMessages->Flush();
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "PipelinedExecution: " << this->PipelinedExecution << endl;
 }
 //----------------------------------------------------------------------------
 vtkTypeUInt32 vtkSMSessionClient::GetNextGlobalUniqueIdentifier()
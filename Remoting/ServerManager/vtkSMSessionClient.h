@@ -14,9 +14,12 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMSession.h"
 
+#include <vector> // for std::vector
+
 class vtkMultiProcessController;
 class vtkPVServerInformation;
 class vtkSMCollaborationManager;
+class vtkSMPipelinedMessages;
 class vtkSMProxyLocator;
 class vtkSMProxyManager;
 
@@ -116,6 +119,29 @@ public:
   void ExecuteStream(vtkTypeUInt32 location, const vtkClientServerStream& stream,
     bool ignoreErrors = false, bool sendReply = false) override;
 
+  ///@{
+  /**
+   * Overridden to queue push-only requests destined to the server(s) and
+   * send them as a single network message when the queue is flushed.
+   * Requests that also execute on the client flush the queue first so that
+   * client and server stay in step.
+   */
+  void BeginPipelinedExecution() override;
+  void EndPipelinedExecution() override;
+  void FlushPipelinedExecution() override;
+  ///@}
+
+  ///@{
+  /**
+   * Enable/disable pipelined execution. When disabled,
+   * BeginPipelinedExecution() has no effect and every request is sent
+   * immediately. Enabled by default.
+   */
+  vtkSetMacro(PipelinedExecution, bool);
+  vtkGetMacro(PipelinedExecution, bool);
+  vtkBooleanMacro(PipelinedExecution, bool);
+  ///@}
+
   ///@{
   /**
    * When Connect() is waiting for a server to connect back to the client (in
@@ -281,11 +307,23 @@ protected:
    */
   virtual void OnConnectionLost(vtkObject* caller, unsigned long eventid, void* calldata);
 
+  /**
+   * Send a CLIENT_SERVER_MESSAGE_RMI to the given controller, or queue it
+   * when pipelined execution is active.
+   */
+  void SendMessageToServer(
+    vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message);
+
+  bool PipelinedExecution;
+
 private:
   vtkSMSessionClient(const vtkSMSessionClient&) = delete;
   void operator=(const vtkSMSessionClient&) = delete;
 
   int NotBusy;
+
+  int PipelinedExecutionCount;
+  vtkSMPipelinedMessages* PipelinedMessages;
   vtkTypeUInt32 LastGlobalID;
   vtkTypeUInt32 LastGlobalIDAvailable;
 };
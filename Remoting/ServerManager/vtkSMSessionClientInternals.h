@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkSMSessionClientInternals_h
+#define vtkSMSessionClientInternals_h
+
+#include "vtkMultiProcessController.h" // for vtkMultiProcessController
+#include "vtkMultiProcessStream.h"     // for vtkMultiProcessStream
+#include "vtkPVSessionServer.h"        // for vtkPVSessionServer
+
+#include <cstddef>    // for size_t
+#include <functional> // for std::function
+#include <vector>     // for std::vector
+
+/**
+ * Queue of CLIENT_SERVER_MESSAGE_RMI messages waiting to be sent to the
+ * servers while pipelined execution is active.
+ *
+ * Messages are kept in a single queue in the order they were pushed, so
+ * that the data server and the render server receive them in the same
+ * relative order as without pipelining. Consecutive messages for the same
+ * server are grouped in a PIPELINED_BATCH message.
+ */
+class vtkSMPipelinedMessages
+{
+public:
+  using SendFunctionType =
+    std::function<void(vtkMultiProcessController*, const std::vector<unsigned char>&)>;
+
+  // Flush when this many bytes are queued to bound client memory.
+  static constexpr size_t MaximumNumberOfBytes = 16 * 1024 * 1024;
+
+  size_t NumberOfBytes = 0;
+
+  // Sends a message to a server. Defaults to triggering the
+  // CLIENT_SERVER_MESSAGE_RMI on the controller.
+  SendFunctionType SendFunction =
+    [](vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message) {
+      controller->TriggerRMIOnAllChildren(raw_message.data(), static_cast<int>(raw_message.size()),
+        vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    };
+
+  void Push(vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message)
+  {
+    if (this->Batches.empty() || this->Batches.back().Controller != controller)
+    {
+      this->Batches.emplace_back();
+      this->Batches.back().Controller = controller;
+    }
+    this->Batches.back().Messages.push_back(raw_message);
+    this->NumberOfBytes += raw_message.size();
+  }
+
+  void Flush()
+  {
+    for (auto& batch : this->Batches)
+    {
+      if (batch.Messages.size() == 1)
+      {
+        this->SendFunction(batch.Controller, batch.Messages[0]);
+      }
+      else
+      {
+        vtkMultiProcessStream stream;
+        stream << static_cast<int>(vtkPVSessionServer::PIPELINED_BATCH)
+               << static_cast<int>(batch.Messages.size());
+        for (auto& message : batch.Messages)
+        {
+          stream.Push(message.data(), static_cast<unsigned int>(message.size()));
+        }
+        std::vector<unsigned char> raw_message;
+        stream.GetRawData(raw_message);
+        this->SendFunction(batch.Controller, raw_message);
+      }
+    }
+    this->Batches.clear();
+    this->NumberOfBytes = 0;
+  }
+
+  /**
+   * Flush the queue, then send `raw_message`. Used for requests that are
+   * followed by a read of the reply, since the reply may depend on any
+   * queued message, whichever server it was queued for.
+   */
+  void SendNow(vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message)
+  {
+    this->Flush();
+    this->SendFunction(controller, raw_message);
+  }
+
+private:
+  struct BatchType
+  {
+    vtkMultiProcessController* Controller = nullptr;
+    std::vector<std::vector<unsigned char>> Messages;
+  };
+  std::vector<BatchType> Batches;
+};
+
+#endif
+
+// VTK-HeaderTest-Exclude: vtkSMSessionClientInternals.h
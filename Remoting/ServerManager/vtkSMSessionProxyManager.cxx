@@ -851,6 +851,10 @@ void vtkSMSessionProxyManager::RegisterProxy(
     return;
   }
 
+  // Creating the VTK objects and pushing the registration state do not need
+  // any reply from the server.
+  vtkSMPipelinedExecutionScope pipelined(this->GetSession());
+
   // Add Tuple
   this->Internals->RegisteredProxyTuple.insert(vtkSMProxyManagerEntry(groupname, name, proxy));
 
@@ -902,6 +906,7 @@ void vtkSMSessionProxyManager::RegisterProxy(
 void vtkSMSessionProxyManager::UpdateRegisteredProxies(
   const char* groupname, int modified_only /*=1*/)
 {
+  vtkSMPipelinedExecutionScope pipelined(this->GetSession());
   vtkSMSessionProxyManagerInternals::ProxyGroupType::iterator it =
     this->Internals->RegisteredProxyMap.find(groupname);
   if (it != this->Internals->RegisteredProxyMap.end())
@@ -930,6 +935,7 @@ void vtkSMSessionProxyManager::UpdateRegisteredProxies(int modified_only /*=1*/)
 {
   vtksys::RegularExpression prototypesRe("_prototypes$");
 
+  vtkSMPipelinedExecutionScope pipelined(this->GetSession());
   vtkSMSessionProxyManagerInternals::ProxyGroupType::iterator it =
     this->Internals->RegisteredProxyMap.begin();
   for (; it != this->Internals->RegisteredProxyMap.end(); it++)
@@ -1220,6 +1226,9 @@ void vtkSMSessionProxyManager::LoadXMLState(vtkPVXMLElement* rootElement,
 
   bool prev = this->InLoadXMLState;
   this->InLoadXMLState = true;
+
+  // Queue push-only requests while loading, they are sent in batches.
+  vtkSMPipelinedExecutionScope pipelined(this->GetSession());
   vtkSmartPointer<vtkSMStateLoader> spLoader;
   if (!loader)
   {
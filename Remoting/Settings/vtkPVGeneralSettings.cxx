@@ -13,6 +13,14 @@
 #include "vtkmFilterOverrides.h"
 #endif
 
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsFiltersRendering
+#include "vtkMPIMoveData.h"
+#endif
+
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsIOCore
+#include "vtkFileSeriesReader.h"
+#endif
+
 #include <cassert>
 
 vtkSmartPointer<vtkPVGeneralSettings> vtkPVGeneralSettings::Instance;
@@ -107,6 +115,54 @@ void vtkPVGeneralSettings::SetNumberOfSMPThreads(int n)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetDeliveryCompressionCodec(int codec)
+{
+  static_cast<void>(codec);
+
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsFiltersRendering
+  if (this->GetDeliveryCompressionCodec() != codec)
+  {
+    vtkMPIMoveData::SetCompressionCodec(codec);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+int vtkPVGeneralSettings::GetDeliveryCompressionCodec()
+{
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsFiltersRendering
+  return vtkMPIMoveData::GetCompressionCodec();
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetDeliveryCompressionLevel(int level)
+{
+  static_cast<void>(level);
+
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsFiltersRendering
+  if (this->GetDeliveryCompressionLevel() != level)
+  {
+    vtkMPIMoveData::SetCompressionLevel(level);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+int vtkPVGeneralSettings::GetDeliveryCompressionLevel()
+{
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsFiltersRendering
+  return vtkMPIMoveData::GetCompressionLevel();
+#else
+  return 6;
+#endif
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -118,9 +174,35 @@ void vtkPVGeneralSettings::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "AutoApplyDelay: " << this->AutoApplyDelay << "\n";
   os << indent << "CacheGeometryForAnimation: " << this->CacheGeometryForAnimation << "\n";
   os << indent << "DefaultViewType: " << this->DefaultViewType << "\n";
+  os << indent << "DeliveryCompressionCodec: " << this->GetDeliveryCompressionCodec() << "\n";
+  os << indent << "DeliveryCompressionLevel: " << this->GetDeliveryCompressionLevel() << "\n";
   os << indent << "InterfaceLanguage: " << this->InterfaceLanguage << "\n";
   os << indent << "LockPanels: " << this->LockPanels << "\n";
   os << indent << "PreservePropertyValues: " << this->PreservePropertyValues << "\n";
   os << indent << "PropertiesPanelMode: " << this->PropertiesPanelMode << "\n";
   os << indent << "ScalarBarMode: " << this->ScalarBarMode << "\n";
 }
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetNumberOfPrefetchedFiles(int count)
+{
+  static_cast<void>(count);
+
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsIOCore
+  if (this->GetNumberOfPrefetchedFiles() != count)
+  {
+    vtkFileSeriesReader::SetNumberOfPrefetchedFiles(count);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+int vtkPVGeneralSettings::GetNumberOfPrefetchedFiles()
+{
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsIOCore
+  return vtkFileSeriesReader::GetNumberOfPrefetchedFiles();
+#else
+  return 0;
+#endif
+}
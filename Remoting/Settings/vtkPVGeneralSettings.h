@@ -371,6 +371,35 @@ public:
   static void SetNumberOfSMPThreads(int);
   ///@}
 
+  ///@{
+  /**
+   * Codec used to compress data delivered between processes, e.g. geometry
+   * sent from the data server to the client. Values are
+   * vtkMPIMoveData::CompressionCodecs: 0 for none, 1 for LZ4 and 2 for zlib.
+   * Large buffers are compressed and decompressed in parallel.
+   */
+  void SetDeliveryCompressionCodec(int);
+  int GetDeliveryCompressionCodec();
+  ///@}
+
+  ///@{
+  /**
+   * Compression level for data delivery, from 1 (fastest) to 9 (smallest).
+   */
+  void SetDeliveryCompressionLevel(int);
+  int GetDeliveryCompressionLevel();
+  ///@}
+
+  ///@{
+  /**
+   * Number of files read ahead on a background thread by file series readers
+   * during playback. 0 disables prefetching.
+   * @sa vtkFileSeriesReader::SetNumberOfPrefetchedFiles
+   */
+  void SetNumberOfPrefetchedFiles(int);
+  int GetNumberOfPrefetchedFiles();
+  ///@}
+
 protected:
   vtkPVGeneralSettings() = default;
   ~vtkPVGeneralSettings() override = default;
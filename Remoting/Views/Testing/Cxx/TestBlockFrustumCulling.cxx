@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBoundingBox.h"
+#include "vtkCamera.h"
+#include "vtkCompositeRepresentation.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDataSet.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVRenderView.h"
+#include "vtkPVRenderViewDataDeliveryManager.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMRenderViewProxy.h"
+#include "vtkSMRepresentationProxy.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkSMSourceProxy> CreateSphere(
+  vtkSMSessionProxyManager* pxm, vtkSMParaViewPipelineController* controller, double x)
+{
+  vtkSmartPointer<vtkSMSourceProxy> sphere;
+  sphere.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "SphereSource")));
+  controller->InitializeProxy(sphere);
+  const double center[3] = { x, 0, 0 };
+  vtkSMPropertyHelper(sphere, "Center").Set(center, 3);
+  sphere->UpdateVTKObjects();
+  return sphere;
+}
+
+// Returns the x coordinate of the center of each delivered leaf, rounded.
+std::vector<double> GetDeliveredCenters(vtkSMRenderViewProxy* view, vtkSMRepresentationProxy* repr)
+{
+  std::vector<double> centers;
+  auto pvview = vtkPVRenderView::SafeDownCast(view->GetClientSideObject());
+  auto dmgr = vtkPVRenderViewDataDeliveryManager::SafeDownCast(pvview->GetDeliveryManager());
+  auto compositeRepr = vtkCompositeRepresentation::SafeDownCast(repr->GetClientSideObject());
+  auto activeRepr = compositeRepr->GetActiveRepresentation();
+  auto tree = vtkDataObjectTree::SafeDownCast(dmgr->GetDeliveredPiece(activeRepr, false));
+  if (!tree)
+  {
+    return centers;
+  }
+  auto iter = vtkSmartPointer<vtkDataObjectTreeIterator>::Take(tree->NewTreeIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    if (auto ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+    {
+      centers.push_back(std::round(ds->GetCenter()[0]));
+    }
+  }
+  return centers;
+}
+
+// Looks at the point (x, 0, 0) from `distance` along z, renders and checks
+// the leaves that were delivered.
+bool CheckDelivery(vtkSMRenderViewProxy* view, vtkSMRepresentationProxy* repr, double x,
+  double distance, const std::vector<double>& expected, const char* what)
+{
+  vtkCamera* camera = view->GetActiveCamera();
+  camera->SetFocalPoint(x, 0, 0);
+  camera->SetPosition(x, 0, distance);
+  camera->SetViewUp(0, 1, 0);
+  camera->SetViewAngle(30);
+  view->StillRender();
+
+  const std::vector<double> centers = GetDeliveredCenters(view, repr);
+  if (centers != expected)
+  {
+    std::cerr << "ERROR: wrong blocks delivered " << what << ":";
+    for (double center : centers)
+    {
+      std::cerr << " " << center;
+    }
+    std::cerr << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool Check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << what << std::endl;
+  }
+  return condition;
+}
+}
+
+extern int TestBlockFrustumCulling(int, char* argv[])
+{
+  vtkInitializationHelper::SetApplicationName("TestBlockFrustumCulling");
+  vtkInitializationHelper::SetOrganizationName("Humanity");
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  int status = EXIT_SUCCESS;
+  {
+    // Box/plane test against the frustum of a camera looking at the origin.
+    vtkNew<vtkCamera> camera;
+    camera->SetPosition(0, 0, 10);
+    camera->SetViewAngle(30);
+    double planes[24];
+    camera->GetFrustumPlanes(1.0, planes);
+    if (!Check(!vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(
+                 planes, vtkBoundingBox(-1, 1, -1, 1, -1, 1)),
+          "box at the center is outside") ||
+      !Check(vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(
+               planes, vtkBoundingBox(9, 11, -1, 1, -1, 1)),
+        "box on the side is inside") ||
+      !Check(!vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(
+               planes, vtkBoundingBox(-20, 20, -1, 1, -1, 1)),
+        "box crossing the frustum is outside") ||
+      !Check(!vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(planes, vtkBoundingBox()),
+        "invalid box is outside"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+    vtkNew<vtkSMSession> session;
+    vtkProcessModule::GetProcessModule()->RegisterSession(session);
+    controller->InitializeSession(session);
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+    // Two spheres of radius 0.5 centered at x = -10 and x = 10.
+    auto left = CreateSphere(pxm, controller, -10);
+    auto right = CreateSphere(pxm, controller, 10);
+    vtkSmartPointer<vtkSMSourceProxy> group;
+    group.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "GroupDataSets")));
+    controller->PreInitializeProxy(group);
+    vtkSMProxy* inputs[2] = { left, right };
+    vtkSMPropertyHelper(group, "Input").Set(inputs, 2);
+    controller->PostInitializeProxy(group);
+    group->UpdateVTKObjects();
+    group->UpdatePipeline();
+
+    vtkSmartPointer<vtkSMRenderViewProxy> view;
+    view.TakeReference(vtkSMRenderViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+    controller->InitializeProxy(view);
+    vtkSMPropertyHelper(view, "UseBlockFrustumCulling").Set(1);
+    view->UpdateVTKObjects();
+
+    auto repr = vtkSMRepresentationProxy::SafeDownCast(controller->Show(group, 0, view));
+
+    // Only the block in view is delivered. Blocks skipped before are
+    // delivered as soon as the camera moves so that they come into view.
+    if (!CheckDelivery(view, repr, -10, 10, { -10 }, "looking at the left sphere") ||
+      !CheckDelivery(view, repr, 10, 10, { 10 }, "looking at the right sphere") ||
+      !CheckDelivery(view, repr, 0, 100, { -10, 10 }, "looking at both spheres") ||
+      !CheckDelivery(view, repr, -10, 10, { -10, 10 }, "after moving back"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    // Blocks already delivered are kept until the data changes.
+    vtkSMPropertyHelper(left, "Radius").Set(0.6);
+    left->UpdateVTKObjects();
+    if (!CheckDelivery(view, repr, -10, 10, { -10 }, "once the data changed"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    // Everything is delivered without culling.
+    vtkSMPropertyHelper(view, "UseBlockFrustumCulling").Set(0);
+    view->UpdateVTKObjects();
+    if (!CheckDelivery(view, repr, -10, 10, { -10, 10 }, "without culling"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    controller->Hide(group, 0, view);
+    vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  }
+  vtkInitializationHelper::Finalize();
+  return status;
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkGeometryRepresentation.h"
+#include "vtkNew.h"
+#include "vtkPVRenderViewDataDeliveryManager.h"
+#include "vtkPolyData.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+
+namespace
+{
+// Returns the cache keys, among 0 to 4, for which data is cached.
+std::set<double> GetCachedKeys(vtkPVDataDeliveryManager* dmgr, vtkGeometryRepresentation* repr)
+{
+  std::set<double> keys;
+  const double current = repr->GetForcedCacheKey();
+  for (double key = 0; key < 5; ++key)
+  {
+    repr->SetForcedCacheKey(key);
+    if (dmgr->HasPiece(repr))
+    {
+      keys.insert(key);
+    }
+  }
+  repr->SetForcedCacheKey(current);
+  return keys;
+}
+
+bool Check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << what << std::endl;
+  }
+  return condition;
+}
+}
+
+extern int TestDataDeliveryManagerCacheEviction(int, char*[])
+{
+  vtkNew<vtkPVRenderViewDataDeliveryManager> dmgr;
+  vtkNew<vtkGeometryRepresentation> repr;
+  repr->Initialize(1, 100);
+  repr->SetForceUseCache(true);
+  dmgr->RegisterRepresentation(repr);
+
+  // Cache 100 KiB for each of the keys 0 to 4, then use key 1 again, which
+  // is also the current key of the representation. The least recently used
+  // order is 0, 2, 3, 4, 1.
+  for (double key : { 0.0, 1.0, 2.0, 3.0, 4.0, 1.0 })
+  {
+    repr->SetForcedCacheKey(key);
+    if (!dmgr->HasPiece(repr))
+    {
+      vtkNew<vtkPolyData> data;
+      dmgr->SetPiece(repr, data, /*low_res=*/false, /*trueSize=*/100);
+    }
+    dmgr->MarkCacheKeyUsed(key);
+  }
+  if (!Check(dmgr->GetCacheSize() == 500, "wrong cache size") ||
+    !Check(dmgr->GetNumberOfCacheKeysToEvict() == 0, "nothing should be evicted without limit"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Fitting in 250 KiB requires releasing the three least recently used keys.
+  dmgr->SetCacheSizeLimit(250);
+  const vtkIdType count = dmgr->GetNumberOfCacheKeysToEvict();
+  if (!Check(count == 3, "wrong number of cache keys to evict"))
+  {
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType cc = 0; cc < count; ++cc)
+  {
+    dmgr->EvictLeastRecentlyUsedCacheKey();
+  }
+  if (!Check(GetCachedKeys(dmgr, repr) == std::set<double>{ 1.0, 4.0 },
+        "least recently used keys were not evicted first") ||
+    !Check(dmgr->GetCacheSize() <= dmgr->GetCacheSizeLimit(), "cache exceeds its limit") ||
+    !Check(dmgr->GetCacheEvictions() == 3, "wrong number of evictions"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The data for the current key is never released, even if that means the
+  // limit cannot be met.
+  dmgr->SetCacheSizeLimit(50);
+  const vtkIdType count2 = dmgr->GetNumberOfCacheKeysToEvict();
+  if (!Check(count2 == 2, "wrong number of cache keys to evict"))
+  {
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType cc = 0; cc < count2; ++cc)
+  {
+    dmgr->EvictLeastRecentlyUsedCacheKey();
+  }
+  if (!Check(GetCachedKeys(dmgr, repr) == std::set<double>{ 1.0 },
+        "data for the current key was released") ||
+    !Check(dmgr->GetCacheSize() == 100, "wrong cache size"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  dmgr->UnRegisterRepresentation(repr);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCamera.h"
+#include "vtkInitializationHelper.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPVRayCastPickingHelper.h"
+#include "vtkPVRenderView.h"
+#include "vtkProcessModule.h"
+#include "vtkRenderer.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMRenderViewProxy.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkSMSourceProxy> CreateSource(
+  vtkSMSessionProxyManager* pxm, vtkSMParaViewPipelineController* controller, const char* name)
+{
+  vtkSmartPointer<vtkSMSourceProxy> source;
+  source.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", name)));
+  controller->InitializeProxy(source);
+  return source;
+}
+
+// Returns whether the fast path of ConvertDisplayToPointOnSurface(), which
+// intersects the delivered geometry, is taken for the ray through `position`.
+bool UsesDeliveredGeometry(vtkSMRenderViewProxy* view, const int position[2])
+{
+  vtkRenderer* renderer = view->GetRenderer();
+  double points[2][3];
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    renderer->SetDisplayPoint(position[0], position[1], cc);
+    renderer->DisplayToWorld();
+    const double* world = renderer->GetWorldPoint();
+    for (int kk = 0; kk < 3; ++kk)
+    {
+      points[cc][kk] = world[kk] / world[3];
+    }
+  }
+  vtkNew<vtkPVRayCastPickingHelper> helper;
+  helper->SetPointA(points[0]);
+  helper->SetPointB(points[1]);
+  return helper->ComputeIntersectionFromView(
+    vtkPVRenderView::SafeDownCast(view->GetClientSideObject()));
+}
+
+bool CheckPick(vtkSMRenderViewProxy* view, const int position[2], const double expected[3],
+  bool fastPath, const char* what)
+{
+  double point[3], normal[3];
+  if (!view->ConvertDisplayToPointOnSurface(position, point, normal))
+  {
+    std::cerr << "ERROR: nothing picked " << what << std::endl;
+    return false;
+  }
+  if (sqrt(vtkMath::Distance2BetweenPoints(point, expected)) > 1e-3)
+  {
+    std::cerr << "ERROR: picked (" << point[0] << ", " << point[1] << ", " << point[2]
+              << ") instead of (" << expected[0] << ", " << expected[1] << ", " << expected[2]
+              << ") " << what << std::endl;
+    return false;
+  }
+  if (UsesDeliveredGeometry(view, position) != fastPath)
+  {
+    std::cerr << "ERROR: delivered geometry " << (fastPath ? "not " : "") << "used " << what
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+extern int TestPickPointOnSurface(int, char* argv[])
+{
+  vtkInitializationHelper::SetApplicationName("TestPickPointOnSurface");
+  vtkInitializationHelper::SetOrganizationName("Humanity");
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  int status = EXIT_SUCCESS;
+  {
+    vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+    vtkNew<vtkSMSession> session;
+    vtkProcessModule::GetProcessModule()->RegisterSession(session);
+    controller->InitializeSession(session);
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+    vtkSmartPointer<vtkSMRenderViewProxy> view;
+    view.TakeReference(vtkSMRenderViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+    controller->InitializeProxy(view);
+    const int size[2] = { 300, 300 };
+    vtkSMPropertyHelper(view, "ViewSize").Set(size, 2);
+    view->UpdateVTKObjects();
+
+    // A sphere of radius 1 at the origin, seen along -z, and a box around it.
+    auto sphere = CreateSource(pxm, controller, "SphereSource");
+    vtkSMPropertyHelper(sphere, "Radius").Set(1.0);
+    vtkSMPropertyHelper(sphere, "ThetaResolution").Set(64);
+    vtkSMPropertyHelper(sphere, "PhiResolution").Set(64);
+    sphere->UpdateVTKObjects();
+    controller->Show(sphere, 0, view);
+
+    auto box = CreateSource(pxm, controller, "CubeSource");
+    for (const char* name : { "XLength", "YLength", "ZLength" })
+    {
+      vtkSMPropertyHelper(box, name).Set(4.0);
+    }
+    box->UpdateVTKObjects();
+    vtkSMProxy* boxRepr = controller->Show(box, 0, view);
+    vtkSMPropertyHelper(boxRepr, "Representation").Set("Wireframe");
+    boxRepr->UpdateVTKObjects();
+
+    vtkCamera* camera = view->GetActiveCamera();
+    camera->SetFocalPoint(0, 0, 0);
+    camera->SetPosition(0, 0, 10);
+    camera->SetViewUp(0, 1, 0);
+    view->ResetCameraClippingRange();
+    view->StillRender();
+
+    // The wireframe box does not hide the sphere, but its faces, which are
+    // not rendered, are in the delivered geometry. A selection render is used
+    // and gives the reference result: the ray through the center of the view
+    // hits the sphere close to its pole, (0, 0, 1).
+    const int center[2] = { size[0] / 2, size[1] / 2 };
+    double expected[3];
+    double normal[3];
+    const double pole[3] = { 0, 0, 1 };
+    if (!view->ConvertDisplayToPointOnSurface(center, expected, normal) ||
+      sqrt(vtkMath::Distance2BetweenPoints(expected, pole)) > 0.05)
+    {
+      std::cerr << "ERROR: the sphere was not picked through the wireframe box" << std::endl;
+      status = EXIT_FAILURE;
+    }
+    else if (UsesDeliveredGeometry(view, center))
+    {
+      std::cerr << "ERROR: delivered geometry used with a wireframe" << std::endl;
+      status = EXIT_FAILURE;
+    }
+
+    // Same for an outline.
+    vtkSMPropertyHelper(boxRepr, "Representation").Set("Outline");
+    boxRepr->UpdateVTKObjects();
+    view->StillRender();
+    if (!CheckPick(view, center, expected, false, "through an outline"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    // Once the box is hidden, only surfaces are visible and are intersected
+    // directly, with the same result.
+    controller->Hide(box, 0, view);
+    view->StillRender();
+    if (!CheckPick(view, center, expected, true, "with the box hidden"))
+    {
+      status = EXIT_FAILURE;
+    }
+
+    controller->Hide(sphere, 0, view);
+    vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  }
+  vtkInitializationHelper::Finalize();
+  return status;
+}
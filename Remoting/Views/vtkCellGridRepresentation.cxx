@@ -339,6 +339,11 @@ void vtkCellGridRepresentation::SetVisibility(bool val)
   this->Superclass::SetVisibility(val);
 }
 
+bool vtkCellGridRepresentation::IsRenderedAsSurface()
+{
+  return false;
+}
+
 void vtkCellGridRepresentation::SetSidesToShow(int flags)
 {
   auto* surfaceFilter = vtkCellGridComputeSides::SafeDownCast(this->GeometryFilter);
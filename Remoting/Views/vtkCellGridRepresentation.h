@@ -41,6 +41,12 @@ public:
    */
   void SetVisibility(bool val) override;
 
+  /**
+   * Returns false since the cell grid is not intersected by
+   * IntersectWithLine().
+   */
+  bool IsRenderedAsSurface() override;
+
   /**
    * Enable/Disable LOD;
    */
@@ -33,6 +33,9 @@ public:
   std::string ActiveRepresentationKey;
 
   vtkSmartPointer<vtkStringArray> RepresentationTypes;
+
+  // True while SetUpdateTime() marks this representation modified.
+  bool SettingUpdateTime = false;
 };
 
 vtkStandardNewMacro(vtkCompositeRepresentation);
@@ -314,11 +317,16 @@ void vtkCompositeRepresentation::SetSelectionConnection(vtkAlgorithmOutput* inpu
 //----------------------------------------------------------------------------
 void vtkCompositeRepresentation::MarkModified()
 {
-  vtkInternals::RepresentationMap::iterator iter;
-  for (iter = this->Internals->Representations.begin();
-       iter != this->Internals->Representations.end(); iter++)
+  // The internal representations are given the new update time, and mark
+  // themselves modified if needed, by SetUpdateTime().
+  if (!this->Internals->SettingUpdateTime)
   {
-    iter->second.GetPointer()->MarkModified();
+    vtkInternals::RepresentationMap::iterator iter;
+    for (iter = this->Internals->Representations.begin();
+         iter != this->Internals->Representations.end(); iter++)
+    {
+      iter->second.GetPointer()->MarkModified();
+    }
   }
   this->Superclass::MarkModified();
 }
@@ -332,7 +340,9 @@ void vtkCompositeRepresentation::SetUpdateTime(double time)
   {
     iter->second.GetPointer()->SetUpdateTime(time);
   }
+  this->Internals->SettingUpdateTime = true;
   this->Superclass::SetUpdateTime(time);
+  this->Internals->SettingUpdateTime = false;
 }
 
 //----------------------------------------------------------------------------
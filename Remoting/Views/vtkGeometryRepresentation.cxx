@@ -3,6 +3,7 @@
 #include "vtkGeometryRepresentation.h"
 #include "vtkGeometryRepresentationInternal.h"
 
+#include "vtkAbstractCellLocator.h"
 #include "vtkAlgorithmOutput.h"
 #include "vtkBoundingBox.h"
 #include "vtkCallbackCommand.h"
@@ -12,8 +13,10 @@
 #include "vtkCompositePolyDataMapper.h"
 #include "vtkDataAssembly.h"
 #include "vtkDataAssemblyUtilities.h"
+#include "vtkDataObjectTree.h"
 #include "vtkDataObjectTreeRange.h"
 #include "vtkDataObjectTypes.h"
+#include "vtkDataSet.h"
 #include "vtkGeometryFilterDispatcher.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkInformation.h"
@@ -24,6 +27,7 @@
 #include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVDataDeliveryManager.h"
 #include "vtkPVLODActor.h"
 #include "vtkPVRenderView.h"
 #include "vtkPVTrivialProducer.h"
@@ -454,20 +458,29 @@ int vtkGeometryRepresentation::ProcessViewRequest(
       }
       else
       {
-        if (inInfo->Has(vtkPVRenderView::LOD_RESOLUTION()))
+        // We handle the resolution differently depending on decimator
+        // implementation.
+        const double resolution = inInfo->Has(vtkPVRenderView::LOD_RESOLUTION())
+          ? inInfo->Get(vtkPVRenderView::LOD_RESOLUTION())
+          : 0.5;
+        const int numLevels = inInfo->Has(vtkPVRenderView::NUMBER_OF_LOD_LEVELS())
+          ? std::max(inInfo->Get(vtkPVRenderView::NUMBER_OF_LOD_LEVELS()), 1)
+          : 1;
+        const int level = inInfo->Has(vtkPVRenderView::LOD_LEVEL())
+          ? vtkMath::ClampValue(inInfo->Get(vtkPVRenderView::LOD_LEVEL()), 0, numLevels - 1)
+          : 0;
+        vtkDataObject* levelData = this->UpdateLODLevels(data, resolution, numLevels)[level];
+        if (levelData != this->LODProvided)
         {
-          // We handle this number differently depending on decimator
-          // implementation.
-          const double factor = inInfo->Get(vtkPVRenderView::LOD_RESOLUTION());
-          this->Decimator->SetLODFactor(factor);
+          // Switching to another cached geometry: let the view know the LOD
+          // geometry changed even though the input data may not have.
+          levelData->Modified();
+          this->LODProvided = levelData;
         }
 
-        this->Decimator->SetInputDataObject(data);
-        this->Decimator->Update();
-
         // Pass along the LOD geometry to the view so that it can deliver it to
         // the rendering node as and when needed.
-        vtkPVView::SetPieceLOD(inInfo, this, this->Decimator->GetOutputDataObject(0));
+        vtkPVView::SetPieceLOD(inInfo, this, levelData);
       }
     }
   }
@@ -512,6 +525,68 @@ int vtkGeometryRepresentation::ProcessViewRequest(
   return 1;
 }
 
+//----------------------------------------------------------------------------
+const std::vector<vtkSmartPointer<vtkDataObject>>& vtkGeometryRepresentation::UpdateLODLevels(
+  vtkDataObject* data, double resolution, int numLevels)
+{
+  const vtkTypeUInt64 generation = this->LODDataGeneration;
+  const double time = this->UpdateTimeValid ? this->UpdateTime : 0.0;
+  auto iter = std::find_if(this->LODCache.begin(), this->LODCache.end(),
+    [&](const LODCacheEntry& entry)
+    {
+      return entry.Generation == generation && entry.Time == time &&
+        entry.Resolution == resolution && static_cast<int>(entry.Levels.size()) == numLevels;
+    });
+  if (iter != this->LODCache.end())
+  {
+    // Move the entry to the front to keep the cache in most recently used order.
+    std::rotate(this->LODCache.begin(), iter, iter + 1);
+    return this->LODCache.front().Levels;
+  }
+
+  // Entries built before the representation was last modified can never be
+  // used again.
+  this->LODCache.erase(std::remove_if(this->LODCache.begin(), this->LODCache.end(),
+                         [&](const LODCacheEntry& entry)
+                         { return entry.Generation != generation; }),
+    this->LODCache.end());
+
+  // Each level is decimated from the previous one, which is much cheaper than
+  // decimating the full resolution data again.
+  LODCacheEntry entry{ generation, time, resolution, 0, {} };
+  vtkDataObject* input = data;
+  double factor = resolution;
+  for (int cc = 0; cc < numLevels; ++cc, factor *= 0.5)
+  {
+    this->Decimator->SetLODFactor(factor);
+    this->Decimator->SetInputDataObject(input);
+    this->Decimator->Update();
+
+    vtkDataObject* output = this->Decimator->GetOutputDataObject(0);
+    auto levelData = vtk::TakeSmartPointer(output->NewInstance());
+    levelData->ShallowCopy(output);
+    entry.Levels.push_back(levelData);
+    entry.Size += levelData->GetActualMemorySize();
+    input = levelData;
+  }
+
+  // Release the least recently used entries to make room for the new one.
+  this->LODCache.insert(this->LODCache.begin(), std::move(entry));
+  vtkTypeUInt64 size = 0;
+  for (const auto& cached : this->LODCache)
+  {
+    size += cached.Size;
+  }
+  while (this->LODCache.size() > 1 &&
+    (this->LODCache.size() > vtkGeometryRepresentation::MaximumNumberOfCachedLODs ||
+      size > vtkGeometryRepresentation::MaximumCachedLODSize))
+  {
+    size -= this->LODCache.back().Size;
+    this->LODCache.pop_back();
+  }
+  return this->LODCache.front().Levels;
+}
+
 //----------------------------------------------------------------------------
 int vtkGeometryRepresentation::RequestUpdateExtent(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -611,6 +686,112 @@ vtkDataObject* vtkGeometryRepresentation::GetRenderedDataObject(int vtkNotUsed(p
   return nullptr;
 }
 
+namespace
+{
+// Adds the datasets in `dobj` that are visible according to `attrs` to
+// `leaves`, following the same visibility inheritance as the mapper.
+void GetVisibleLeaves(vtkCompositeDataDisplayAttributes* attrs, vtkDataObject* dobj,
+  bool parentVisible, std::vector<vtkDataSet*>& leaves)
+{
+  if (dobj == nullptr)
+  {
+    return;
+  }
+  const bool visible =
+    (attrs && attrs->HasBlockVisibility(dobj)) ? attrs->GetBlockVisibility(dobj) : parentVisible;
+  if (auto dtree = vtkDataObjectTree::SafeDownCast(dobj))
+  {
+    for (vtkDataObject* child : vtk::Range(dtree, vtk::DataObjectTreeOptions::None))
+    {
+      GetVisibleLeaves(attrs, child, visible, leaves);
+    }
+  }
+  else if (auto ds = vtkDataSet::SafeDownCast(dobj))
+  {
+    if (visible && ds->GetNumberOfCells() > 0)
+    {
+      leaves.push_back(ds);
+    }
+  }
+}
+}
+
+//----------------------------------------------------------------------------
+bool vtkGeometryRepresentation::IsRenderedAsSurface()
+{
+  if (this->Representation != SURFACE && this->Representation != SURFACE_WITH_EDGES)
+  {
+    return false;
+  }
+  auto geometryFilter = vtkGeometryFilterDispatcher::SafeDownCast(this->GeometryFilter);
+  return geometryFilter && !geometryFilter->GetUseOutline() &&
+    !geometryFilter->GetGenerateFeatureEdges();
+}
+
+//----------------------------------------------------------------------------
+bool vtkGeometryRepresentation::IntersectWithLine(const double p0[3], const double p1[3],
+  double tol, double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+  vtkDataSet*& dataset)
+{
+  auto view = vtkPVView::SafeDownCast(this->GetView());
+  auto dm = view ? view->GetDeliveryManager() : nullptr;
+  vtkDataObject* data = dm ? dm->GetDeliveredPiece(this, /*low_res=*/false) : nullptr;
+  if (!data || !this->GetVisibility() || !this->Actor->GetVisibility() ||
+    !this->Actor->GetPickable())
+  {
+    return false;
+  }
+
+  // The delivered geometry is in the dataset coordinates, move the segment
+  // there instead of transforming the geometry.
+  double a[4] = { p0[0], p0[1], p0[2], 1.0 };
+  double b[4] = { p1[0], p1[1], p1[2], 1.0 };
+  vtkMatrix4x4* matrix = this->Actor->GetMatrix();
+  if (!matrix->IsIdentity())
+  {
+    vtkNew<vtkMatrix4x4> inverse;
+    vtkMatrix4x4::Invert(matrix, inverse);
+    inverse->MultiplyPoint(a, a);
+    inverse->MultiplyPoint(b, b);
+    for (int cc = 0; cc < 3; ++cc)
+    {
+      a[cc] /= a[3];
+      b[cc] /= b[3];
+    }
+  }
+
+  vtkCompositeDataDisplayAttributes* attrs = nullptr;
+  if (auto cmapper = vtkCompositePolyDataMapper::SafeDownCast(this->Mapper))
+  {
+    attrs = cmapper->GetCompositeDataDisplayAttributes();
+  }
+  std::vector<vtkDataSet*> leaves;
+  GetVisibleLeaves(attrs, data, /*parentVisible=*/true, leaves);
+
+  bool hit = false;
+  t = VTK_DOUBLE_MAX;
+  for (vtkDataSet* leaf : leaves)
+  {
+    vtkAbstractCellLocator* locator = dm->GetDeliveredPieceLocator(this, leaf);
+    double leafT, leafX[3], leafPCoords[3];
+    int leafSubId;
+    vtkIdType leafCellId;
+    if (locator &&
+      locator->IntersectWithLine(a, b, tol, leafT, leafX, leafPCoords, leafSubId, leafCellId) &&
+      leafT < t)
+    {
+      hit = true;
+      t = leafT;
+      std::copy(leafX, leafX + 3, x);
+      std::copy(leafPCoords, leafPCoords + 3, pcoords);
+      subId = leafSubId;
+      cellId = leafCellId;
+      dataset = leaf;
+    }
+  }
+  return hit;
+}
+
 //----------------------------------------------------------------------------
 bool vtkGeometryRepresentation::AddToView(vtkView* view)
 {
@@ -805,6 +986,25 @@ void vtkGeometryRepresentation::SetVisibility(bool val)
   this->Superclass::SetVisibility(val);
 }
 
+//----------------------------------------------------------------------------
+void vtkGeometryRepresentation::MarkModified()
+{
+  if (!this->SettingUpdateTime)
+  {
+    ++this->LODDataGeneration;
+  }
+  this->Superclass::MarkModified();
+}
+
+//----------------------------------------------------------------------------
+void vtkGeometryRepresentation::SetUpdateTime(double time)
+{
+  // the data at the new time is a different entry of the LOD cache.
+  this->SettingUpdateTime = true;
+  this->Superclass::SetUpdateTime(time);
+  this->SettingUpdateTime = false;
+}
+
 //----------------------------------------------------------------------------
 void vtkGeometryRepresentation::SetCoordinateShiftScaleMethod(int val)
 {
@@ -20,6 +20,7 @@
 #include "vtkParaViewDeprecation.h" // for PV_DEPRECATED
 #include "vtkProperty.h"            // needed for VTK_POINTS etc.
 #include "vtkRemotingViewsModule.h" // needed for exports
+#include "vtkSmartPointer.h"        // for vtkSmartPointer
 #include "vtkVector.h"              // for vtkVector.
 
 #include <set>           // needed for std::set
@@ -28,6 +29,7 @@
 #include <vector>        // needed for std::vector
 
 class vtkCompositeDataDisplayAttributes;
+class vtkDataSet;
 class vtkGeometryFilterDispatcher;
 class vtkMapper;
 class vtkPiecewiseFunction;
@@ -66,6 +68,17 @@ public:
    */
   void SetVisibility(bool val) override;
 
+  /**
+   * Overridden to invalidate the cached LOD geometries, unless the
+   * representation is only modified because the update time changed.
+   */
+  void MarkModified() override;
+
+  /**
+   * Overridden to keep the cached LOD geometries of the other times.
+   */
+  void SetUpdateTime(double time) override;
+
   ///@{
   /**
    * Determines the number of distinct values in vtkBlockColors
@@ -143,6 +156,32 @@ public:
    */
   vtkDataObject* GetRenderedDataObject(int port) override;
 
+  /**
+   * Intersects the line segment from `p0` to `p1`, in world coordinates, with
+   * the full resolution geometry delivered to this process, skipping hidden
+   * blocks. Cells are found using the locators cached with the delivered
+   * piece (see vtkPVDataDeliveryManager::GetDeliveredPieceLocator()), so this
+   * requires neither a selection render nor building a locator for each pick.
+   *
+   * Returns false if the representation is hidden or not pickable, or if the
+   * segment does not hit any cell. Otherwise returns true and sets `t`, the
+   * parametric coordinate of the closest intersection along the segment,
+   * `dataset` and `cellId`, the cell hit, and `x`, `pcoords` and `subId` as
+   * returned by vtkCell::IntersectWithLine(). `x` is in the coordinates of
+   * `dataset`; use `GetActor()->GetMatrix()` to transform it to world
+   * coordinates.
+   */
+  bool IntersectWithLine(const double p0[3], const double p1[3], double tol, double& t,
+    double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkDataSet*& dataset);
+
+  /**
+   * Returns true if the cells intersected by IntersectWithLine() are the ones
+   * rendered: the delivered geometry is rendered with the Surface or Surface
+   * With Edges style, and is neither an outline nor feature edges. Subclasses
+   * that render something else than the delivered geometry return false.
+   */
+  virtual bool IsRenderedAsSurface();
+
   ///@{
   /**
    * Representations that use geometry representation as the internal
@@ -520,6 +559,14 @@ protected:
    */
   virtual void SetPointArrayToProcess(int p, const char* val);
 
+  /**
+   * Returns `numLevels` LOD geometries for `data`, building them unless they
+   * are already cached for the current LODDataGeneration, the update time and
+   * `resolution`. Level 0 uses `resolution` and each following level halves it.
+   */
+  const std::vector<vtkSmartPointer<vtkDataObject>>& UpdateLODLevels(
+    vtkDataObject* data, double resolution, int numLevels);
+
   /**
    * This is called whenever the texture transformation matrix changes.
    */
@@ -530,6 +577,33 @@ protected:
   vtkGeometryRepresentation_detail::DecimationFilterType* Decimator;
   vtkGeometryFilterDispatcher* LODOutlineFilter;
 
+  ///@{
+  /**
+   * LOD geometries built by UpdateLODLevels(), most recently used first. Each
+   * entry holds the levels, finest first, built for a data generation, update
+   * time and resolution, so that going back to a previous timestep does not
+   * decimate the data again. LODDataGeneration is incremented by
+   * MarkModified() unless it is called by SetUpdateTime(). At
+   * most MaximumNumberOfCachedLODs entries and MaximumCachedLODSize KiB are
+   * kept. LODProvided is the geometry last provided to the view and is only
+   * used for comparison.
+   */
+  struct LODCacheEntry
+  {
+    vtkTypeUInt64 Generation;
+    double Time;
+    double Resolution;
+    vtkTypeUInt64 Size;
+    std::vector<vtkSmartPointer<vtkDataObject>> Levels;
+  };
+  std::vector<LODCacheEntry> LODCache;
+  static constexpr std::size_t MaximumNumberOfCachedLODs = 16;
+  static constexpr vtkTypeUInt64 MaximumCachedLODSize = 256 * 1024;
+  vtkTypeUInt64 LODDataGeneration = 0;
+  bool SettingUpdateTime = false;
+  vtkDataObject* LODProvided = nullptr;
+  ///@}
+
   vtkMapper* Mapper;
   vtkMapper* LODMapper;
   vtkPVLODActor* Actor;
@@ -94,14 +94,15 @@ protected:
 };
 }
 #else // VISKORES_ENABLE_TBB
-#include "vtkQuadricClustering.h"
+#include "vtkPVQuadricClustering.h"
 namespace vtkGeometryRepresentation_detail
 {
-class DecimationFilterType : public vtkQuadricClustering
+// vtkPVQuadricClustering is the multithreaded vtkQuadricClustering.
+class DecimationFilterType : public vtkPVQuadricClustering
 {
 public:
   static DecimationFilterType* New();
-  vtkTypeMacro(DecimationFilterType, vtkQuadricClustering);
+  vtkTypeMacro(DecimationFilterType, vtkPVQuadricClustering);
 
   // This version gets slower as the grid increases, while the VISKORES version
   // scales with number of points. This means we can get away with a much finer
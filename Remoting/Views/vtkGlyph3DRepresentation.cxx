@@ -161,6 +161,12 @@ void vtkGlyph3DRepresentation::SetVisibility(bool val)
   this->Actor->SetVisibility((val && this->MeshVisibility) ? 1 : 0);
 }
 
+//----------------------------------------------------------------------------
+bool vtkGlyph3DRepresentation::IsRenderedAsSurface()
+{
+  return false;
+}
+
 //----------------------------------------------------------------------------
 void vtkGlyph3DRepresentation::SetMeshVisibility(bool val)
 {
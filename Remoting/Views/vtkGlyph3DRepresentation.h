@@ -46,6 +46,12 @@ public:
    */
   void SetVisibility(bool) override;
 
+  /**
+   * Returns false since the glyphs are not part of the delivered geometry
+   * intersected by IntersectWithLine().
+   */
+  bool IsRenderedAsSurface() override;
+
   //**************************************************************************
   // Forwarded to vtkGlyph3DMapper
   void SetMaskArray(const char* val);
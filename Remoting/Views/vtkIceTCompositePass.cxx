@@ -4,10 +4,12 @@
 
 #include "vtkBoundingBox.h"
 #include "vtkCameraPass.h"
+#include "vtkCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkFrameBufferObjectBase.h"
 #include "vtkHardwareSelector.h"
 #include "vtkIceTContext.h"
+#include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
@@ -19,6 +21,8 @@
 #include "vtkOrderedCompositingHelper.h"
 #include "vtkPVLogger.h"
 #include "vtkPixelBufferObject.h"
+#include "vtkProp.h"
+#include "vtkPropCollection.h"
 #include "vtkRenderState.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
@@ -31,6 +35,7 @@
 #include <IceT.h>
 #include <IceTGL.h>
 #include <cassert>
+#include <vector>
 
 #include "vtkCompositeZPassFS.h"
 #include "vtkOpenGLHelper.h"
@@ -70,33 +75,57 @@ void IceTDrawCallback(const IceTDouble* projection_matrix, const IceTDouble* mod
   }
 }
 
-void MergeCubeAxesBounds(double bounds[6], const vtkRenderState* rState)
+// Returns the corners of the bounds of each visible prop. IceT projects them
+// and reduces them to a single rectangle, ICET_CONTAINED_VIEWPORT, which is
+// the region of the screen this rank renders to; rendering is skipped when
+// that region is empty. Two distant props still give one rectangle around
+// both. Compared to the corners of the bounds of all props, this only drops
+// the corners of that box which are outside the bounds of every prop, so the
+// rectangle can be smaller when these corners project outside the other ones,
+// e.g. for props at different depths.
+std::vector<double> GetVisiblePropCorners(vtkRenderer* renderer)
 {
-  vtkBoundingBox bbox(bounds);
-
-  // Hande CubeAxes specifically has it wrongly implement the GetBounds()
-  for (int cc = 0; cc < rState->GetPropArrayCount(); cc++)
+  std::vector<double> corners;
+  vtkPropCollection* props = renderer->GetViewProps();
+  vtkCollectionSimpleIterator pit;
+  props->InitTraversal(pit);
+  while (vtkProp* prop = props->GetNextProp(pit))
   {
-    vtkProp* prop = rState->GetPropArray()[cc];
-    if (prop->GetVisibility() && prop->GetUseBounds())
+    if (!prop->GetVisibility() || !prop->GetUseBounds())
     {
-      if (prop->IsA("vtkGridAxesActor3D") || prop->IsA("vtkCubeAxesActor") ||
-        prop->IsA("vtkPolarAxesActor"))
-      {
-        vtkProp3D* prop3D = static_cast<vtkProp3D*>(prop);
-        vtkBoundingBox box(prop3D->GetBounds());
-        // This is the same trick used by vtkCubeAxesActor::GetRenderedBounds():
-        if (box.IsValid())
-        {
-          box.Inflate(box.GetMaxLength());
-          box.GetBounds(bounds);
-          bbox.AddBounds(bounds);
-        }
-      }
+      continue;
+    }
+
+    const double* propBounds = prop->GetBounds();
+    // skip bogus bounds, like vtkRenderer::ComputeVisiblePropBounds() does.
+    if (propBounds == nullptr || !vtkMath::AreBoundsInitialized(propBounds) ||
+      propBounds[0] < -VTK_FLOAT_MAX || propBounds[1] > VTK_FLOAT_MAX ||
+      propBounds[2] < -VTK_FLOAT_MAX || propBounds[3] > VTK_FLOAT_MAX ||
+      propBounds[4] < -VTK_FLOAT_MAX || propBounds[5] > VTK_FLOAT_MAX)
+    {
+      continue;
     }
-  }
 
-  bbox.GetBounds(bounds);
+    vtkBoundingBox box(propBounds);
+    // Cube axes actors implement GetBounds() to return the inner bounds rather
+    // than the prop bounds, see BUG# 13469. Inflate them the same way
+    // vtkCubeAxesActor::GetRenderedBounds() does.
+    if (prop->IsA("vtkGridAxesActor3D") || prop->IsA("vtkCubeAxesActor") ||
+      prop->IsA("vtkPolarAxesActor"))
+    {
+      box.Inflate(box.GetMaxLength());
+    }
+
+    double bounds[6];
+    box.GetBounds(bounds);
+    for (int cc = 0; cc < 8; ++cc)
+    {
+      corners.push_back(bounds[cc & 0x1]);
+      corners.push_back(bounds[2 + ((cc >> 1) & 0x1)]);
+      corners.push_back(bounds[4 + ((cc >> 2) & 0x1)]);
+    }
+  }
+  return corners;
 }
 
 } // end of namespace
@@ -267,31 +296,21 @@ void vtkIceTCompositePass::SetupContext(const vtkRenderState* render_state)
     icetDisable(ICET_ORDERED_COMPOSITE);
   }
 
-  // Let IceT know the data bounds. This allows IceT to make smarter compositing
-  // decisions.
-  double allBounds[6];
-  render_state->GetRenderer()->ComputeVisiblePropBounds(allBounds);
-
-  // Try to detect when bounds are empty and try to let IceT know that
-  // nothing is in bounds.
-  if (allBounds[0] > allBounds[1])
+  // Let IceT know the data bounds. IceT projects them every frame to only
+  // render, read back and composite the part of the screen covered by this
+  // rank, and does not render at all when it covers nothing.
+  const auto corners = GetVisiblePropCorners(render_state->GetRenderer());
+  if (corners.empty())
   {
+    // Try to let IceT know that nothing is in bounds.
     vtkDebugMacro("nothing visible" << endl);
     IceTFloat tmp = VTK_FLOAT_MAX;
     icetBoundingVertices(1, ICET_FLOAT, 0, 1, &tmp);
   }
   else
   {
-    // ComputeVisiblePropBounds() includes bounds from all props, however it
-    // cannot include the "real" bounds from vtkCubeAxesActor. Thanks to
-    // vtkCubeAxesActor overriding the 'GetBounds' method to return the inner
-    // bounds rather that the prop  bounds for the actor. That results in BUG#
-    // 13469. Hence, to overcome that issue, we iterate over the props to locate
-    // vtkCubeAxesActor and include the outer bounds.
-    MergeCubeAxesBounds(allBounds, render_state);
-
-    icetBoundingBoxd(
-      allBounds[0], allBounds[1], allBounds[2], allBounds[3], allBounds[4], allBounds[5]);
+    icetBoundingVertices(
+      3, ICET_DOUBLE, 0, static_cast<IceTSizeType>(corners.size() / 3), corners.data());
   }
 
   if (this->DataReplicatedOnAllProcesses)
@@ -440,6 +459,11 @@ void vtkIceTCompositePass::Render(const vtkRenderState* render_state)
   IceTDrawCallbackHandle = nullptr;
   IceTDrawCallbackState = nullptr;
 
+  IceTInt contained_viewport[4];
+  icetGetIntegerv(ICET_CONTAINED_VIEWPORT, contained_viewport);
+  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "ICET_CONTAINED_VIEWPORT: %d, %d, %d x %d",
+    contained_viewport[0], contained_viewport[1], contained_viewport[2], contained_viewport[3]);
+
   // isolate vtk from IceT OpenGL errors
   vtkOpenGLClearErrorMacro();
 
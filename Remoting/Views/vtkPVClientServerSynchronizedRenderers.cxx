@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkPVClientServerSynchronizedRenderers.h"
 
+#include "vtkDeltaImageCompressor.h"
 #include "vtkLZ4Compressor.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
@@ -14,6 +15,7 @@
 #include "vtkNvPipeCompressor.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 
@@ -34,6 +36,35 @@ vtkPVClientServerSynchronizedRenderers::~vtkPVClientServerSynchronizedRenderers(
   this->SetCompressor(nullptr);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::MasterStartRender()
+{
+  this->LastRemoteRenderTime = 0.0;
+  this->LastImageDeliveryTime = 0.0;
+  this->Superclass::MasterStartRender();
+
+  // Ask for a keyframe when the delta compressor could not decode the last
+  // image. This is always sent so that both ends stay in step.
+  auto delta = vtkDeltaImageCompressor::SafeDownCast(this->Compressor);
+  int keyFrameNeeded = (delta && delta->GetKeyFrameNeeded()) ? 1 : 0;
+  this->ParallelController->Broadcast(&keyFrameNeeded, 1, this->RootProcessId);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::SlaveStartRender()
+{
+  this->StartRenderTime = std::chrono::steady_clock::now();
+  this->Superclass::SlaveStartRender();
+
+  int keyFrameNeeded = 0;
+  this->ParallelController->Broadcast(&keyFrameNeeded, 1, this->RootProcessId);
+  auto delta = vtkDeltaImageCompressor::SafeDownCast(this->Compressor);
+  if (keyFrameNeeded && delta)
+  {
+    delta->RequestKeyFrame();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
 {
@@ -41,10 +72,13 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
   assert(this->ParallelController->IsA("vtkSocketController") ||
     this->ParallelController->IsA("vtkCompositeMultiProcessController"));
 
+  const auto start = std::chrono::steady_clock::now();
   vtkRawImage& rawImage = this->Image;
 
-  int header[4];
-  this->ParallelController->Receive(header, 4, 1, 0x023430);
+  // header[4] is the time, in microseconds, the slave took to render and
+  // composite the image.
+  int header[5];
+  this->ParallelController->Receive(header, 5, 1, 0x023430);
   if (header[0] > 0)
   {
     rawImage.Resize(header[1], header[2], header[3]);
@@ -61,6 +95,14 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
       this->ParallelController->Receive(rawImage.GetRawPtr(), 1, 0x023430);
     }
     rawImage.MarkValid();
+
+    // we start waiting for the image about when the slave starts rendering it,
+    // so whatever is left once its render time is removed is spent delivering
+    // the image.
+    const double elapsed =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    this->LastRemoteRenderTime = header[4] * 1e-6;
+    this->LastImageDeliveryTime = std::max(elapsed - this->LastRemoteRenderTime, 0.0);
   }
 }
 
@@ -71,15 +113,19 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
     this->ParallelController->IsA("vtkCompositeMultiProcessController"));
 
   vtkRawImage& rawImage = this->CaptureRenderedImage();
+  const auto renderTime = std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - this->StartRenderTime);
 
-  int header[4];
+  int header[5];
   header[0] = rawImage.IsValid() ? 1 : 0;
   header[1] = rawImage.GetWidth();
   header[2] = rawImage.GetHeight();
   header[3] = rawImage.IsValid() ? rawImage.GetRawPtr()->GetNumberOfComponents() : 0;
+  header[4] = static_cast<int>(
+    std::min<std::chrono::microseconds::rep>(renderTime.count(), VTK_INT_MAX));
 
   // send the image to the client.
-  this->ParallelController->Send(header, 4, 1, 0x023430);
+  this->ParallelController->Send(header, 5, 1, 0x023430);
 
   if (rawImage.IsValid())
   {
@@ -159,6 +205,10 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
     {
       comp = vtkLZ4Compressor::New();
     }
+    else if (className == "vtkDeltaImageCompressor")
+    {
+      comp = vtkDeltaImageCompressor::New();
+    }
     else if (className == "vtkNvPipeCompressor" && this->NVPipeSupport)
     {
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
@@ -204,4 +254,6 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
 void vtkPVClientServerSynchronizedRenderers::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "LastRemoteRenderTime: " << this->LastRemoteRenderTime << endl;
+  os << indent << "LastImageDeliveryTime: " << this->LastImageDeliveryTime << endl;
 }
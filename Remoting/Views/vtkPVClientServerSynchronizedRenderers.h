@@ -15,6 +15,8 @@
 #include "vtkRemotingViewsModule.h" //needed for exports
 #include "vtkSynchronizedRenderers.h"
 
+#include <chrono> // for std::chrono
+
 class vtkImageCompressor;
 class vtkUnsignedCharArray;
 
@@ -47,6 +49,18 @@ public:
    */
   virtual void ConfigureCompressor(const char* stream);
 
+  ///@{
+  /**
+   * Timings of the last render, only valid on the client. LastRemoteRenderTime
+   * is the time the server took to render and composite the image.
+   * LastImageDeliveryTime is the time spent compressing, transferring and
+   * decompressing the image. Both are in seconds and 0 when no image was
+   * received.
+   */
+  vtkGetMacro(LastRemoteRenderTime, double);
+  vtkGetMacro(LastImageDeliveryTime, double);
+  ///@}
+
 protected:
   vtkPVClientServerSynchronizedRenderers();
   ~vtkPVClientServerSynchronizedRenderers() override;
@@ -62,16 +76,22 @@ protected:
   vtkUnsignedCharArray* Compress(vtkUnsignedCharArray*);
   void Decompress(vtkUnsignedCharArray* input, vtkUnsignedCharArray* outputBuffer);
 
+  void MasterStartRender() override;
+  void SlaveStartRender() override;
   void MasterEndRender() override;
   void SlaveEndRender() override;
 
   vtkImageCompressor* Compressor;
   bool LossLessCompression;
   bool NVPipeSupport;
+  double LastRemoteRenderTime = 0.0;
+  double LastImageDeliveryTime = 0.0;
 
 private:
   vtkPVClientServerSynchronizedRenderers(const vtkPVClientServerSynchronizedRenderers&) = delete;
   void operator=(const vtkPVClientServerSynchronizedRenderers&) = delete;
+
+  std::chrono::steady_clock::time_point StartRenderTime;
 };
 
 #endif
@@ -4,6 +4,7 @@
 #include "vtkPVDataDeliveryManagerInternals.h"
 
 #include "vtkAlgorithmOutput.h"
+#include "vtkDataSet.h"
 #include "vtkInformation.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
@@ -13,6 +14,10 @@
 #include "vtkSmartPointer.h"
 #include "vtkWeakPointer.h"
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 //*****************************************************************************
 //----------------------------------------------------------------------------
 vtkPVDataDeliveryManager::vtkPVDataDeliveryManager()
@@ -98,8 +103,11 @@ void vtkPVDataDeliveryManager::SetPiece(vtkPVDataRepresentation* repr, vtkDataOb
   if (item)
   {
     const auto cacheKey = this->GetCacheKey(repr);
+    // low-res data may also change without the pipeline data changing, for
+    // example when a representation switches between LOD levels.
     if (item->GetDataObject(cacheKey) == nullptr ||
-      repr->GetPipelineDataTime() > item->GetTimeStamp())
+      repr->GetPipelineDataTime() > item->GetTimeStamp() ||
+      (low_res && data && data->GetMTime() > item->GetTimeStamp()))
     {
       vtkLogF(
         TRACE, "SetDataObject %s (key=%g) : %p", repr->GetLogName().c_str(), cacheKey, (void*)data);
@@ -156,6 +164,30 @@ vtkDataObject* vtkPVDataDeliveryManager::GetDeliveredPiece(
   return item ? item->GetDeliveredDataObject(dataKey, cacheKey) : nullptr;
 }
 
+//----------------------------------------------------------------------------
+vtkAbstractCellLocator* vtkPVDataDeliveryManager::GetDeliveredPieceLocator(
+  vtkPVDataRepresentation* repr, vtkDataSet* dataset, bool low_res, int port)
+{
+  vtkInternals::vtkItem* item =
+    this->Internals->GetItem(repr, low_res, port, /*create_if_needed=*/false);
+  if (!item || !dataset || !this->GetDeliveredPiece(repr, low_res, port))
+  {
+    return nullptr;
+  }
+
+  const auto cacheKey = this->GetCacheKey(repr);
+  auto locator = item->GetLocator(dataset, cacheKey);
+  if (locator)
+  {
+    // vtkStaticCellLocator builds its buckets with vtkSMPTools and skips the
+    // build if neither the locator nor the dataset was modified since.
+    vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "build locator (%lld cells)",
+      static_cast<long long>(dataset->GetNumberOfCells()));
+    locator->BuildLocator();
+  }
+  return locator;
+}
+
 //----------------------------------------------------------------------------
 vtkAlgorithmOutput* vtkPVDataDeliveryManager::GetProducer(
   vtkPVDataRepresentation* repr, bool low_res, int port)
@@ -254,6 +286,24 @@ void vtkPVDataDeliveryManager::Deliver(int low_res, unsigned int size, unsigned
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::GetDeliverySizes(
+  int low_res, unsigned int size, unsigned int* values, std::vector<vtkTypeUInt64>& sizes)
+{
+  assert(size % 2 == 0);
+  sizes.assign(size / 2, 0);
+  for (unsigned int cc = 0; cc < size; cc += 2)
+  {
+    const unsigned int id = values[cc];
+    const int port = static_cast<int>(values[cc + 1]);
+    auto repr = this->GetRepresentation(id);
+    if (auto item = repr ? this->Internals->GetItem(id, low_res != 0, port) : nullptr)
+    {
+      sizes[cc / 2] = item->GetActualMemorySize(this->GetCacheKey(repr));
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkPVDataDeliveryManager::GetSynchronizationMagicNumber()
 {
@@ -285,8 +335,97 @@ void vtkPVDataDeliveryManager::ClearCache(vtkPVDataRepresentation* repr)
   this->Internals->ClearCache(repr);
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVDataDeliveryManager::IsCached(vtkPVDataRepresentation* repr)
+{
+  if (this->HasPiece(repr))
+  {
+    ++this->CacheHits;
+    return true;
+  }
+  ++this->CacheMisses;
+  return false;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::GetCacheSize()
+{
+  return this->Internals->GetCacheSize();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::MarkCacheKeyUsed(double cacheKey)
+{
+  this->Internals->CacheKeyLastUse[cacheKey] = ++this->Internals->CacheKeyUseCounter;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkPVDataDeliveryManager::GetNumberOfCacheKeysToEvict()
+{
+  vtkTypeUInt64 size = this->GetCacheSize();
+  if (this->CacheSizeLimit == 0 || size <= this->CacheSizeLimit)
+  {
+    return 0;
+  }
+
+  // Walk the cache keys in the order EvictLeastRecentlyUsedCacheKey() would
+  // release them.
+  std::vector<std::pair<vtkTypeUInt64, double>> order;
+  order.reserve(this->Internals->CacheKeyLastUse.size());
+  for (const auto& pair : this->Internals->CacheKeyLastUse)
+  {
+    order.emplace_back(pair.second, pair.first);
+  }
+  std::sort(order.begin(), order.end());
+
+  vtkIdType count = 0;
+  for (const auto& pair : order)
+  {
+    if (size <= this->CacheSizeLimit)
+    {
+      break;
+    }
+    size -= std::min(size, this->Internals->GetEvictableCacheSize(pair.second, this));
+    ++count;
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataDeliveryManager::EvictLeastRecentlyUsedCacheKey()
+{
+  auto& lastUse = this->Internals->CacheKeyLastUse;
+  if (lastUse.empty())
+  {
+    return false;
+  }
+
+  auto lru = std::min_element(lastUse.begin(), lastUse.end(),
+    [](const std::pair<const double, vtkTypeUInt64>& a,
+      const std::pair<const double, vtkTypeUInt64>& b) { return a.second < b.second; });
+  const double cacheKey = lru->first;
+  lastUse.erase(lru);
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "evict cache key %g", cacheKey);
+  this->Internals->EvictCacheKey(cacheKey, this);
+  ++this->CacheEvictions;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::ResetCacheStatistics()
+{
+  this->CacheHits = 0;
+  this->CacheMisses = 0;
+  this->CacheEvictions = 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataDeliveryManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheSizeLimit: " << this->CacheSizeLimit << endl;
+  os << indent << "CacheHits: " << this->CacheHits << endl;
+  os << indent << "CacheMisses: " << this->CacheMisses << endl;
+  os << indent << "CacheEvictions: " << this->CacheEvictions << endl;
 }
@@ -23,8 +23,10 @@
 #include "vtkTuple.h"               // needed for vtkTuple.
 #include "vtkWeakPointer.h"         // needed for iVar.
 
+class vtkAbstractCellLocator;
 class vtkAlgorithmOutput;
 class vtkDataObject;
+class vtkDataSet;
 class vtkExtentTranslator;
 class vtkInformation;
 class vtkPVDataRepresentation;
@@ -90,11 +92,83 @@ public:
    */
   vtkDataObject* GetDeliveredPiece(vtkPVDataRepresentation* repr, bool low_res, int port = 0);
 
+  /**
+   * Returns a cell locator for `dataset`, which must be the data object
+   * returned by GetDeliveredPiece() or one of its leaves. The locator is
+   * cached with the delivered piece and discarded when the piece is replaced.
+   * It is built on first use, using multiple threads, and rebuilt if `dataset`
+   * is modified. This lets representations pick on the delivered geometry
+   * without building a locator for each pick. Returns nullptr if no data was
+   * delivered for the representation.
+   */
+  vtkAbstractCellLocator* GetDeliveredPieceLocator(
+    vtkPVDataRepresentation* repr, vtkDataSet* dataset, bool low_res = false, int port = 0);
+
   /**
    * Clear all cached data objects for the given representation.
    */
   void ClearCache(vtkPVDataRepresentation* repr);
 
+  /**
+   * Returns true if data for the current cache key of the representation is
+   * available, in which case the representation does not need to update.
+   * This also updates the cache hit and miss counts.
+   */
+  bool IsCached(vtkPVDataRepresentation* repr);
+
+  ///@{
+  /**
+   * Get/Set the maximum memory, in KiB, that data stored for all cache keys
+   * may use on any rank, e.g. geometry cached for animation playback. When
+   * it is exceeded, views release the data for the least recently used cache
+   * keys first (see vtkPVView::EnforceCacheSizeLimit). The data currently
+   * used by representations is never released. 0 (default) means no limit.
+   */
+  vtkSetMacro(CacheSizeLimit, vtkTypeUInt64);
+  vtkGetMacro(CacheSizeLimit, vtkTypeUInt64);
+  ///@}
+
+  /**
+   * Returns the memory, in KiB, used by data stored on this rank for all
+   * cache keys, full and low resolution, including delivered data.
+   */
+  vtkTypeUInt64 GetCacheSize();
+
+  /**
+   * Marks `cacheKey` as the most recently used cache key.
+   */
+  void MarkCacheKeyUsed(double cacheKey);
+
+  /**
+   * Returns how many cache keys EvictLeastRecentlyUsedCacheKey() must release
+   * on this rank, in least recently used order, for the data cached on this
+   * rank to fit CacheSizeLimit. This does not communicate, so views can
+   * reduce this number across ranks and then release the same keys
+   * everywhere.
+   */
+  vtkIdType GetNumberOfCacheKeysToEvict();
+
+  /**
+   * Releases the data stored for the least recently used cache key, other
+   * than for representations for which it is the current key. Returns false
+   * if there is no cache key left to release. Since whether a representation
+   * is cached decides whether its pipeline executes, this must be called
+   * identically on all ranks.
+   */
+  bool EvictLeastRecentlyUsedCacheKey();
+
+  ///@{
+  /**
+   * Cache statistics: number of times IsCached() found or did not find the
+   * data for a representation, and number of cache keys released by
+   * EvictLeastRecentlyUsedCacheKey().
+   */
+  vtkGetMacro(CacheHits, vtkTypeUInt64);
+  vtkGetMacro(CacheMisses, vtkTypeUInt64);
+  vtkGetMacro(CacheEvictions, vtkTypeUInt64);
+  void ResetCacheStatistics();
+  ///@}
+
   ///@{
   /**
    * Provides access to the producer port for the geometry of a registered
@@ -142,6 +216,13 @@ public:
    */
   void Deliver(int use_low_res, unsigned int size, unsigned int* keys);
 
+  /**
+   * Returns, in `sizes`, the local size in kibibytes of the data Deliver()
+   * would move for each (representation, port) pair in `keys`.
+   */
+  void GetDeliverySizes(
+    int use_low_res, unsigned int size, unsigned int* keys, std::vector<vtkTypeUInt64>& sizes);
+
   /**
    * Views that support changing of which ranks do the rendering at runtime
    * based on things like data sizes, etc. may override this method to provide a
@@ -177,6 +258,11 @@ private:
   void operator=(const vtkPVDataDeliveryManager&) = delete;
 
   vtkWeakPointer<vtkPVView> View;
+
+  vtkTypeUInt64 CacheSizeLimit = 0;
+  vtkTypeUInt64 CacheHits = 0;
+  vtkTypeUInt64 CacheMisses = 0;
+  vtkTypeUInt64 CacheEvictions = 0;
 };
 
 #endif
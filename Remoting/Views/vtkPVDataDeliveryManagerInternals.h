@@ -11,11 +11,13 @@
 #include "vtkPVDataRepresentation.h" // for vtkPVDataRepresentation
 #include "vtkPVTrivialProducer.h"    // for vtkPVTrivialProducer
 #include "vtkSmartPointer.h"         // for vtkSmartPointer
+#include "vtkStaticCellLocator.h"    // for vtkStaticCellLocator
 #include "vtkWeakPointer.h"          // for vtkWeakPointer
 
 #include <cassert> // for assert
 #include <map>     // for std::map
 #include <numeric> // for std::accumulate
+#include <set>     // for std::set
 #include <utility> // for std::pair
 
 class vtkPVDataDeliveryManager::vtkInternals
@@ -60,6 +62,10 @@ public:
 
     // Arbitrary meta-data container.
     vtkSmartPointer<vtkInformation> Information;
+
+    // Cell locators for the delivered data objects or their leaves, built
+    // on demand for picking. Cleared whenever delivered data changes.
+    std::map<vtkDataObject*, vtkSmartPointer<vtkStaticCellLocator>> Locators;
   };
 
   class vtkItem
@@ -78,6 +84,47 @@ public:
 
     void ClearCache() { this->Data.clear(); }
 
+    void ClearCache(double cacheKey) { this->Data.erase(cacheKey); }
+
+    // Returns the memory used by the data stored for all cache keys, in KiB.
+    // Delivered data objects are counted once even if stored under several
+    // data keys.
+    vtkTypeUInt64 GetCacheSize() const
+    {
+      vtkTypeUInt64 size = 0;
+      for (const auto& dpair : this->Data)
+      {
+        size += vtkItem::GetStoreSize(dpair.second);
+      }
+      return size;
+    }
+
+    // Returns the memory used by the data stored for `cacheKey`, in KiB.
+    vtkTypeUInt64 GetCacheSize(double cacheKey) const
+    {
+      auto iter = this->Data.find(cacheKey);
+      return iter != this->Data.end() ? vtkItem::GetStoreSize(iter->second) : 0;
+    }
+
+    static vtkTypeUInt64 GetStoreSize(const vtkRepresentedData& store)
+    {
+      vtkTypeUInt64 size = 0;
+      if (store.DataObject)
+      {
+        size += store.ActualMemorySize;
+      }
+      std::set<vtkDataObject*> delivered;
+      for (const auto& delivered_pair : store.DeliveredDataObjects)
+      {
+        vtkDataObject* dobj = delivered_pair.second;
+        if (dobj && delivered.insert(dobj).second)
+        {
+          size += dobj->GetActualMemorySize();
+        }
+      }
+      return size;
+    }
+
     void SetDataObject(vtkDataObject* data, vtkInternals* helper, double cacheKey)
     {
       auto& store = this->Data[cacheKey];
@@ -92,6 +139,7 @@ public:
       }
 
       store.DeliveredDataObjects.clear();
+      store.Locators.clear();
       store.ActualMemorySize = data ? data->GetActualMemorySize() : 0;
       // This method gets called when data is entirely changed. That means that any
       // data we may have delivered or redistributed would also be obsolete.
@@ -140,6 +188,25 @@ public:
     {
       auto& store = this->Data[cacheKey];
       store.DeliveredDataObjects[dataKey] = data;
+      store.Locators.clear();
+    }
+
+    // Returns the locator for `dataset`, a delivered data object or one of its
+    // leaves, creating it if needed. The locator is not built here.
+    vtkStaticCellLocator* GetLocator(vtkDataSet* dataset, double cacheKey)
+    {
+      auto iter = this->Data.find(cacheKey);
+      if (iter == this->Data.end() || dataset == nullptr)
+      {
+        return nullptr;
+      }
+      auto& locator = iter->second.Locators[dataset];
+      if (locator == nullptr)
+      {
+        locator = vtkSmartPointer<vtkStaticCellLocator>::New();
+        locator->SetDataSet(dataset);
+      }
+      return locator;
     }
 
     vtkPVTrivialProducer* GetProducer(int dataKey, double cacheKey)
@@ -275,8 +342,62 @@ public:
     }
   }
 
+  // Returns true if `cacheKey` is the current cache key of the representation
+  // the item belongs to, in which case its data must be kept.
+  bool IsCurrentCacheKey(
+    const ReprPortType& key, double cacheKey, const vtkPVDataDeliveryManager* dmgr) const
+  {
+    auto riter = this->RepresentationsMap.find(key.first);
+    return riter != this->RepresentationsMap.end() && riter->second != nullptr &&
+      dmgr->GetCacheKey(riter->second) == cacheKey;
+  }
+
+  // Releases data stored for `cacheKey` except for representations for which
+  // it is the current cache key.
+  void EvictCacheKey(double cacheKey, vtkPVDataDeliveryManager* dmgr)
+  {
+    for (auto& ipair : this->ItemsMap)
+    {
+      if (!this->IsCurrentCacheKey(ipair.first, cacheKey, dmgr))
+      {
+        ipair.second.first.ClearCache(cacheKey);
+        ipair.second.second.ClearCache(cacheKey);
+      }
+    }
+  }
+
+  // Returns the memory, in KiB, that EvictCacheKey() would release.
+  vtkTypeUInt64 GetEvictableCacheSize(double cacheKey, const vtkPVDataDeliveryManager* dmgr) const
+  {
+    vtkTypeUInt64 size = 0;
+    for (const auto& ipair : this->ItemsMap)
+    {
+      if (!this->IsCurrentCacheKey(ipair.first, cacheKey, dmgr))
+      {
+        size += ipair.second.first.GetCacheSize(cacheKey) +
+          ipair.second.second.GetCacheSize(cacheKey);
+      }
+    }
+    return size;
+  }
+
+  vtkTypeUInt64 GetCacheSize() const
+  {
+    vtkTypeUInt64 size = 0;
+    for (const auto& ipair : this->ItemsMap)
+    {
+      size += ipair.second.first.GetCacheSize() + ipair.second.second.GetCacheSize();
+    }
+    return size;
+  }
+
   ItemsMapType ItemsMap;
   RepresentationsMapType RepresentationsMap;
+
+  // Cache keys in use, with the value of CacheKeyUseCounter when they were
+  // last used. This is used to release the least recently used ones first.
+  std::map<double, vtkTypeUInt64> CacheKeyLastUse;
+  vtkTypeUInt64 CacheKeyUseCounter = 0;
 };
 
 #endif // __WRAP__
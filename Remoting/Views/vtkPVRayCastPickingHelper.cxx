@@ -9,21 +9,31 @@
 #include "vtkCell.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkCompositeRepresentation.h"
 #include "vtkDataArray.h"
 #include "vtkDataSet.h"
+#include "vtkGenericCell.h"
+#include "vtkGeometryRepresentation.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVExtractSelection.h"
+#include "vtkPVLODActor.h"
+#include "vtkPVRenderView.h"
 #include "vtkPointData.h"
 #include "vtkPolygon.h"
 #include "vtkSelection.h"
+#include "vtkSelectionRepresentation.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTransform.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 vtkStandardNewMacro(vtkPVRayCastPickingHelper);
 vtkCxxSetObjectMacro(vtkPVRayCastPickingHelper, Input, vtkAlgorithm);
@@ -269,3 +279,144 @@ void vtkPVRayCastPickingHelper::ComputeIntersectionFromDataSet(vtkDataSet* ds)
     }
   }
 }
+
+//----------------------------------------------------------------------------
+bool vtkPVRayCastPickingHelper::ComputeIntersectionFromView(vtkPVRenderView* view)
+{
+  // Need valid view and ray.
+  if (!view || !vtkMath::Distance2BetweenPoints(this->PointA, this->PointB))
+  {
+    return false;
+  }
+
+  // The cells hit are the ones rendered, and nothing else can hide them, only
+  // if all the visible representations render the surface of their delivered
+  // geometry. Otherwise, e.g. with wireframes, glyphs, volumes or image
+  // slices, the caller has to use a selection render instead. Composite
+  // representations are skipped since their parts are in the view as well.
+  for (int cc = 0, max = view->GetNumberOfRepresentations(); cc < max; ++cc)
+  {
+    auto repr = vtkPVDataRepresentation::SafeDownCast(view->GetRepresentation(cc));
+    if (!repr || !repr->GetVisibility() || vtkCompositeRepresentation::SafeDownCast(repr) ||
+      vtkSelectionRepresentation::SafeDownCast(repr))
+    {
+      continue;
+    }
+    auto geometryRepr = vtkGeometryRepresentation::SafeDownCast(repr);
+    if (geometryRepr &&
+      (!geometryRepr->GetActor()->GetVisibility() || !geometryRepr->GetActor()->GetPickable()))
+    {
+      // neither rendered nor selectable.
+      continue;
+    }
+    if (!geometryRepr || !geometryRepr->IsRenderedAsSurface())
+    {
+      return false;
+    }
+  }
+
+  // Find the closest cell hit by the ray among all geometry representations.
+  vtkGeometryRepresentation* hitRepr = nullptr;
+  vtkDataSet* hitDataSet = nullptr;
+  vtkIdType hitCellId = -1;
+  int hitSubId = 0;
+  double hitT = VTK_DOUBLE_MAX;
+  double hitX[3], hitPCoords[3];
+  for (int cc = 0, max = view->GetNumberOfRepresentations(); cc < max; ++cc)
+  {
+    auto repr = vtkGeometryRepresentation::SafeDownCast(view->GetRepresentation(cc));
+    vtkDataSet* ds = nullptr;
+    vtkIdType cellId;
+    int subId;
+    double t, x[3], pcoords[3];
+    if (repr &&
+      repr->IntersectWithLine(this->PointA, this->PointB, IntersectionTolerance, t, x, pcoords,
+        subId, cellId, ds) &&
+      t < hitT)
+    {
+      hitRepr = repr;
+      hitDataSet = ds;
+      hitCellId = cellId;
+      hitSubId = subId;
+      hitT = t;
+      std::copy(x, x + 3, hitX);
+      std::copy(pcoords, pcoords + 3, hitPCoords);
+    }
+  }
+  if (!hitRepr)
+  {
+    return false;
+  }
+
+  // The geometry is in the dataset coordinates, which ComputeSurfaceNormal()
+  // expects for the ray and the intersection as well.
+  double pointA[3], pointB[3];
+  std::copy(this->PointA, this->PointA + 3, pointA);
+  std::copy(this->PointB, this->PointB + 3, pointB);
+  vtkMatrix4x4* matrix = hitRepr->GetActor()->GetMatrix();
+  vtkNew<vtkTransform> transform;
+  transform->SetMatrix(matrix);
+  if (!matrix->IsIdentity())
+  {
+    vtkNew<vtkTransform> inverse;
+    inverse->DeepCopy(transform);
+    inverse->Inverse();
+    inverse->TransformPoint(pointA, this->PointA);
+    inverse->TransformPoint(pointB, this->PointB);
+  }
+
+  vtkNew<vtkGenericCell> cell;
+  hitDataSet->GetCell(hitCellId, cell);
+  std::vector<double> weights(cell->GetNumberOfPoints());
+  double closest[3];
+  cell->EvaluateLocation(hitSubId, hitPCoords, closest, weights.data());
+  std::copy(hitX, hitX + 3, this->Intersection);
+
+  vtkDataArray* normals = hitDataSet->GetPointData()->GetNormals();
+  if (this->SnapOnMeshPoint)
+  {
+    // Snap to the closest point of the cell hit.
+    vtkIdType closestPointId = -1;
+    double minDist2 = VTK_DOUBLE_MAX;
+    for (vtkIdType cc = 0; cc < cell->GetNumberOfPoints(); ++cc)
+    {
+      double point[3];
+      hitDataSet->GetPoint(cell->GetPointId(cc), point);
+      const double dist2 = vtkMath::Distance2BetweenPoints(point, hitX);
+      if (dist2 < minDist2)
+      {
+        minDist2 = dist2;
+        closestPointId = cell->GetPointId(cc);
+      }
+    }
+    if (closestPointId >= 0)
+    {
+      hitDataSet->GetPoint(closestPointId, this->Intersection);
+    }
+    if (normals && closestPointId >= 0)
+    {
+      normals->GetTuple(closestPointId, this->IntersectionNormal);
+    }
+    else if (!this->ComputeSurfaceNormal(hitDataSet, cell, hitSubId, weights.data()))
+    {
+      this->IntersectionNormal[0] = this->IntersectionNormal[1] = this->IntersectionNormal[2] =
+        std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  else if (!this->ComputeSurfaceNormal(hitDataSet, cell, hitSubId, weights.data()))
+  {
+    this->IntersectionNormal[0] = this->IntersectionNormal[1] = this->IntersectionNormal[2] =
+      std::numeric_limits<double>::quiet_NaN();
+  }
+
+  // Back to world coordinates.
+  std::copy(pointA, pointA + 3, this->PointA);
+  std::copy(pointB, pointB + 3, this->PointB);
+  if (!matrix->IsIdentity())
+  {
+    transform->TransformPoint(this->Intersection, this->Intersection);
+    transform->TransformNormal(this->IntersectionNormal, this->IntersectionNormal);
+    vtkMath::Normalize(this->IntersectionNormal);
+  }
+  return true;
+}
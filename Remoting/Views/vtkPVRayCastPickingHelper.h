@@ -17,6 +17,7 @@
 class vtkAlgorithm;
 class vtkCell;
 class vtkDataSet;
+class vtkPVRenderView;
 
 class VTKREMOTINGVIEWS_EXPORT vtkPVRayCastPickingHelper : public vtkObject
 {
@@ -64,6 +65,21 @@ public:
    */
   void ComputeIntersection();
 
+  /**
+   * Compute the intersection with the full resolution geometry delivered to
+   * `view` on this process instead of the cells extracted using the Selection.
+   * The closest cell along the ray is found with the locators cached with the
+   * delivered geometry (see vtkGeometryRepresentation::IntersectWithLine()),
+   * so no selection render is needed. When SnapOnMeshPoint is set, the
+   * intersection is moved to the closest point of that cell. This does not
+   * reduce the result across processes, so it is only meaningful when all the
+   * geometry is rendered locally. Returns false if nothing was hit, or if a
+   * visible representation does not render the surface of its delivered
+   * geometry (see vtkGeometryRepresentation::IsRenderedAsSurface()), e.g. a
+   * wireframe or a volume, since its rendering may differ from the cells hit.
+   */
+  bool ComputeIntersectionFromView(vtkPVRenderView* view);
+
   // Provide access to the resulting intersection
   vtkGetVector3Macro(Intersection, double);
 
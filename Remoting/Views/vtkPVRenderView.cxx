@@ -119,7 +119,9 @@
 #include <anari/frontend/anari_enums.h>
 #endif
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <map>
 #include <set>
 #include <sstream>
@@ -174,6 +176,21 @@ public:
 
   bool actorSyncEnabled;
 
+  // Interactive render times measured for each LOD level since the LOD
+  // geometries were last rebuilt; negative when not measured yet.
+  std::vector<double> LODRenderTimes;
+  // LOD level requested by the most recent UpdateLOD().
+  int LastUpdatedLODLevel = -1;
+
+  // Timings of the last interactive frame, used by adaptive interactive
+  // rendering; FrameTime is negative when no frame was measured yet.
+  double FrameTime = -1.0;
+  double FrameRenderTime = 0.0;
+  double FrameImageDeliveryTime = 0.0;
+  bool FrameHadRemoteImage = false;
+  // Unrounded image reduction factor picked by the adaptive controller.
+  double AdaptiveImageReductionFactor = 1.0;
+
   void EnableActorSync(vtkPVSynchronizedRenderer* syncRen, bool enable)
   {
     vtkProcessModule* pm = vtkProcessModule::GetProcessModule();
@@ -378,6 +395,8 @@ vtkObjectFactoryNewMacro(vtkPVRenderView);
 vtkInformationKeyMacro(vtkPVRenderView, USE_LOD, Integer);
 vtkInformationKeyMacro(vtkPVRenderView, USE_OUTLINE_FOR_LOD, Integer);
 vtkInformationKeyMacro(vtkPVRenderView, LOD_RESOLUTION, Double);
+vtkInformationKeyMacro(vtkPVRenderView, NUMBER_OF_LOD_LEVELS, Integer);
+vtkInformationKeyMacro(vtkPVRenderView, LOD_LEVEL, Integer);
 vtkInformationKeyMacro(vtkPVRenderView, NEED_ORDERED_COMPOSITING, Integer);
 vtkInformationKeyMacro(vtkPVRenderView, RENDER_EMPTY_IMAGES, Integer);
 vtkInformationKeyMacro(vtkPVRenderView, REQUEST_STREAMING_UPDATE, Request);
@@ -1544,6 +1563,9 @@ void vtkPVRenderView::Update()
 
   this->Superclass::Update();
 
+  // Keep the geometry cached for animation playback within its memory budget.
+  this->EnforceCacheSizeLimit();
+
   // Update camera zoom manipulators based on whether we have discrete position.
   vtkUpdateTrackballZoomManipulators(this->TwoDInteractorStyle, this->DiscreteCameras == nullptr);
   vtkUpdateTrackballZoomManipulators(this->ThreeDInteractorStyle, this->DiscreteCameras == nullptr);
@@ -1627,6 +1649,21 @@ void vtkPVRenderView::UpdateLOD()
   // Update LOD geometry.
 
   this->RequestInformation->Set(LOD_RESOLUTION(), this->LODResolution);
+
+  const int numLevels = this->GetEffectiveLODTargetFrameTime() > 0 ? this->NumberOfLODLevels : 1;
+  const int level = vtkMath::ClampValue(this->LODLevel, 0, numLevels - 1);
+  this->RequestInformation->Set(NUMBER_OF_LOD_LEVELS(), numLevels);
+  this->RequestInformation->Set(LOD_LEVEL(), level);
+
+  // Unless we are only switching to another level, representations rebuild
+  // their LOD geometries and previously measured render times are obsolete.
+  auto& internals = *this->Internals;
+  if (level == internals.LastUpdatedLODLevel ||
+    static_cast<int>(internals.LODRenderTimes.size()) != numLevels)
+  {
+    internals.LODRenderTimes.assign(numLevels, -1.0);
+  }
+  internals.LastUpdatedLODLevel = level;
   if (this->UseOutlineForLODRendering)
   {
     this->RequestInformation->Set(USE_OUTLINE_FOR_LOD(), 1);
@@ -1658,6 +1695,138 @@ void vtkPVRenderView::UpdateLOD()
   vtkTimerLog::MarkEndEvent("RenderView::UpdateLOD");
 }
 
+//----------------------------------------------------------------------------
+void vtkPVRenderView::RecordLODRenderTime(double elapsed)
+{
+  auto& internals = *this->Internals;
+  const int level = internals.LastUpdatedLODLevel;
+  if (level < 0 || level >= static_cast<int>(internals.LODRenderTimes.size()))
+  {
+    return;
+  }
+
+  // smooth out variations between frames.
+  double& time = internals.LODRenderTimes[level];
+  time = time < 0 ? elapsed : 0.7 * time + 0.3 * elapsed;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVRenderView::ComputeLODLevel()
+{
+  const auto& internals = *this->Internals;
+  const auto& times = internals.LODRenderTimes;
+  const int level = internals.LastUpdatedLODLevel;
+  const double target = this->GetEffectiveLODTargetFrameTime();
+  if (target <= 0)
+  {
+    return 0;
+  }
+  if (level < 0 || level >= static_cast<int>(times.size()) || times[level] < 0)
+  {
+    return this->LODLevel;
+  }
+
+  if (times[level] > target && level + 1 < static_cast<int>(times.size()))
+  {
+    return level + 1;
+  }
+
+  // Only go back to a finer level when it is expected to fit the target with
+  // some margin, to avoid oscillating between two levels. Each level has about
+  // a fourth of the triangles of the previous one, but render time does not
+  // scale linearly, so assume it halves when the finer level was not measured.
+  if (level > 0)
+  {
+    const double finer = times[level - 1] >= 0 ? times[level - 1] : 2.0 * times[level];
+    if (finer < 0.8 * target)
+    {
+      return level - 1;
+    }
+  }
+  return level;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVRenderView::GetEffectiveLODTargetFrameTime() const
+{
+  if (this->LODTargetFrameTime > 0)
+  {
+    return this->LODTargetFrameTime;
+  }
+  return this->UseAdaptiveInteractiveRendering ? 1.0 / this->TargetInteractiveFrameRate : 0.0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderView::RecordInteractiveFrame(double frameTime, bool remoteImage)
+{
+  auto& internals = *this->Internals;
+  internals.FrameTime = frameTime;
+  internals.FrameHadRemoteImage = remoteImage;
+  if (remoteImage)
+  {
+    internals.FrameRenderTime = this->SynchronizedRenderers->GetLastRemoteRenderTime();
+    internals.FrameImageDeliveryTime = this->SynchronizedRenderers->GetLastImageDeliveryTime();
+  }
+  else
+  {
+    internals.FrameRenderTime = frameTime;
+    internals.FrameImageDeliveryTime = 0.0;
+  }
+}
+
+//----------------------------------------------------------------------------
+double vtkPVRenderView::GetLastInteractiveFrameTime()
+{
+  return std::max(this->Internals->FrameTime, 0.0);
+}
+
+//----------------------------------------------------------------------------
+double vtkPVRenderView::GetLastInteractiveRenderTime()
+{
+  return this->Internals->FrameRenderTime;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVRenderView::GetLastInteractiveImageDeliveryTime()
+{
+  return this->Internals->FrameImageDeliveryTime;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVRenderView::ComputeAdaptiveImageReductionFactor()
+{
+  auto& internals = *this->Internals;
+  if (internals.FrameTime < 0)
+  {
+    return this->AdaptiveImageReductionFactor;
+  }
+  if (!internals.FrameHadRemoteImage)
+  {
+    internals.AdaptiveImageReductionFactor = 1.0;
+    return 1;
+  }
+
+  // Leave the factor alone while the frame time is within the band, to avoid
+  // changing the image resolution every frame.
+  const double target = 1.0 / this->TargetInteractiveFrameRate;
+  const double frameTime = internals.FrameTime;
+  double& factor = internals.AdaptiveImageReductionFactor;
+  if (frameTime <= target && frameTime >= 0.7 * target)
+  {
+    return vtkMath::Round(factor);
+  }
+
+  // The delivery time scales with the number of pixels, i.e. with the inverse
+  // of the square of the reduction factor. Aim slightly below the target and
+  // only move half way to the ideal factor to damp oscillations.
+  const double delivery = internals.FrameImageDeliveryTime;
+  const double budget = 0.9 * target - (frameTime - delivery);
+  const double ideal =
+    (budget > 0 && delivery > 0) ? factor * std::sqrt(delivery / budget) : factor * 2.0;
+  factor = vtkMath::ClampValue(factor + 0.5 * (ideal - factor), 1.0, 20.0);
+  return vtkMath::Round(factor);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVRenderView::StillRender()
 {
@@ -1823,9 +1992,19 @@ void vtkPVRenderView::Render(bool interactive, bool skip_rendering)
     vtkPVView::REQUEST_RENDER(), this->RequestInformation, this->ReplyInformationVector);
 
   // set the image reduction factor.
-  this->SynchronizedRenderers->SetImageReductionFactor(
-    (interactive ? this->InteractiveRenderImageReductionFactor
-                 : this->StillRenderImageReductionFactor));
+  if (!interactive)
+  {
+    this->SynchronizedRenderers->SetImageReductionFactor(this->StillRenderImageReductionFactor);
+  }
+  else if (this->UseAdaptiveInteractiveRendering)
+  {
+    this->SynchronizedRenderers->SetImageReductionFactor(this->AdaptiveImageReductionFactor);
+  }
+  else
+  {
+    this->SynchronizedRenderers->SetImageReductionFactor(
+      this->InteractiveRenderImageReductionFactor);
+  }
 
   this->UsedLODForLastRender = use_lod_rendering;
 
@@ -1896,6 +2075,11 @@ void vtkPVRenderView::Render(bool interactive, bool skip_rendering)
     stream << "Mode: " << (interactive ? "interactive" : "still") << "\n"
            << "Level-of-detail: " << (use_lod_rendering ? "yes" : "no") << "\n"
            << "Remote/parallel rendering: " << (use_distributed_rendering ? "yes" : "no") << "\n";
+    if (interactive && this->UseAdaptiveInteractiveRendering)
+    {
+      stream << "Image reduction factor: " << this->AdaptiveImageReductionFactor << "\n"
+             << "LOD level: " << (use_lod_rendering ? this->LODLevel : 0) << "\n";
+    }
     this->Annotation->SetText(stream.str().c_str());
   }
 
@@ -1915,6 +2099,20 @@ void vtkPVRenderView::Render(bool interactive, bool skip_rendering)
   if (!this->MakingSelection)
   {
     this->Timer->StopTimer();
+    if (interactive)
+    {
+      // the image comes from remote processes when the client-server
+      // synchronizer is active on this process.
+      const bool remoteImage = this->SynchronizedRenderers->GetEnabled() &&
+        vtkProcessModule::GetProcessType() == vtkProcessModule::PROCESS_CLIENT;
+      this->RecordInteractiveFrame(this->Timer->GetElapsedTime(), remoteImage);
+    }
+    if (use_lod_rendering)
+    {
+      // only the rendering part of the frame depends on the LOD geometry.
+      this->RecordLODRenderTime(
+        interactive ? this->Internals->FrameRenderTime : this->Timer->GetElapsedTime());
+    }
   }
 
   if (!this->MakingSelection)
@@ -1942,6 +2140,73 @@ void vtkPVRenderView::Deliver(int use_lod, unsigned int size, unsigned int* repr
   this->SynchronizeForCollaboration();
 
   this->Superclass::Deliver(use_lod, size, representation_ids);
+
+  if (!use_lod)
+  {
+    this->SynchronizeCulledBounds(size, representation_ids);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderView::SynchronizeCulledBounds(unsigned int size, unsigned int* representation_ids)
+{
+  auto dm = vtkPVRenderViewDataDeliveryManager::SafeDownCast(this->GetDeliveryManager());
+  if (!dm)
+  {
+    return;
+  }
+
+  // Each process only knows about the blocks it skipped. Share the bounds of
+  // all skipped blocks with all processes, including the client, which uses
+  // them to decide when to deliver the data again.
+  const unsigned int numItems = size / 2;
+  std::vector<vtkTypeUInt64> culled(numItems, 0);
+  if (this->UseBlockFrustumCulling)
+  {
+    std::vector<vtkTypeUInt64> local_culled(numItems, 0);
+    for (unsigned int cc = 0; cc < numItems; ++cc)
+    {
+      auto repr = dm->GetRepresentation(representation_ids[2 * cc]);
+      const int port = static_cast<int>(representation_ids[2 * cc + 1]);
+      local_culled[cc] = (repr && dm->GetCulledBounds(repr, port).IsValid()) ? 1 : 0;
+    }
+    this->AllReduce(local_culled, culled, vtkCommunicator::MAX_OP);
+  }
+
+  double view_planes[24] = { 0.0 };
+  this->GetDeliveryViewPlanes(view_planes);
+  for (unsigned int cc = 0; cc < numItems; ++cc)
+  {
+    auto repr = dm->GetRepresentation(representation_ids[2 * cc]);
+    const int port = static_cast<int>(representation_ids[2 * cc + 1]);
+    vtkBoundingBox bbox;
+    if (culled[cc] != 0)
+    {
+      // this is done on all processes since `culled` is the same everywhere.
+      this->AllReduce(repr ? dm->GetCulledBounds(repr, port) : vtkBoundingBox(), bbox);
+    }
+    if (repr)
+    {
+      dm->SetCulledBounds(repr, bbox, view_planes, port);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderView::SetDeliveryViewPlanes(const double view_planes[24])
+{
+  std::copy(view_planes, view_planes + 24, this->DeliveryViewPlanes);
+  this->HasDeliveryViewPlanes = true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVRenderView::GetDeliveryViewPlanes(double view_planes[24]) const
+{
+  if (this->HasDeliveryViewPlanes)
+  {
+    std::copy(this->DeliveryViewPlanes, this->DeliveryViewPlanes + 24, view_planes);
+  }
+  return this->HasDeliveryViewPlanes;
 }
 
 //----------------------------------------------------------------------------
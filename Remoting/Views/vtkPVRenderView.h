@@ -259,6 +259,59 @@ public:
   vtkGetMacro(LODRenderingThreshold, double);
   ///@}
 
+  ///@{
+  /**
+   * When on, still renders deliver geometry progressively: data is moved in
+   * batches, smallest representations first, and the view is rendered after
+   * each batch. Representations whose data has not arrived yet keep showing
+   * their previously delivered data. This avoids a single large dataset
+   * holding back the display of all others in the view. Off by default.
+   * This is used on the client by vtkSMDataDeliveryManagerProxy.
+   */
+  vtkSetMacro(UseProgressiveDelivery, bool);
+  vtkGetMacro(UseProgressiveDelivery, bool);
+  vtkBooleanMacro(UseProgressiveDelivery, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the amount of data, in megabytes, delivered in each batch when
+   * UseProgressiveDelivery is on. Representations are added to a batch, in
+   * increasing size order, until this size is reached; larger
+   * representations are delivered in their own batch. Default is 10.
+   */
+  vtkSetClampMacro(ProgressiveDeliveryBatchSize, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(ProgressiveDeliveryBatchSize, double);
+  ///@}
+
+  ///@{
+  /**
+   * When on, blocks of multiblock and partitioned dataset collection geometry
+   * whose bounds are completely outside the view frustum are neither
+   * delivered nor rendered. Such representations are delivered again when
+   * the camera moves so that skipped blocks may become visible. This only
+   * applies to full resolution geometry delivered for local or remote
+   * rendering, not to tile-display or CAVE modes. Off by default.
+   * \note CallOnAllProcesses
+   */
+  vtkSetMacro(UseBlockFrustumCulling, bool);
+  vtkGetMacro(UseBlockFrustumCulling, bool);
+  vtkBooleanMacro(UseBlockFrustumCulling, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set the view planes, as returned by vtkCamera::GetFrustumPlanes(), used to
+   * cull blocks by the next Deliver() call when UseBlockFrustumCulling is on.
+   * The client passes its camera frustum to all processes before delivering,
+   * since the camera on the other processes is only updated when rendering.
+   * GetDeliveryViewPlanes() returns false if no planes were set.
+   * \note CallOnAllProcesses
+   */
+  void SetDeliveryViewPlanes(const double view_planes[24]);
+  bool GetDeliveryViewPlanes(double view_planes[24]) const;
+  ///@}
+
   ///@{
   /**
    * Get/Set the LOD resolution. This affects the size of the grid used for
@@ -281,6 +334,110 @@ public:
   vtkGetMacro(UseOutlineForLODRendering, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the target time, in seconds, for interactive renders that use LOD.
+   * When greater than 0, representations build a pyramid of NumberOfLODLevels
+   * LOD geometries, each at half the resolution of the previous one starting at
+   * LODResolution, and ComputeLODLevel() picks the level to use based on the
+   * render times measured for each level. 0 (default) disables this and only
+   * the LOD at LODResolution is used.
+   * \note CallOnAllProcesses
+   */
+  vtkSetClampMacro(LODTargetFrameTime, double, 0.0, 10.0);
+  vtkGetMacro(LODTargetFrameTime, double);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the number of LOD levels built when LODTargetFrameTime is set.
+   * Default is 4.
+   * \note CallOnAllProcesses
+   */
+  vtkSetClampMacro(NumberOfLODLevels, int, 1, 8);
+  vtkGetMacro(NumberOfLODLevels, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the LOD level, 0 being the finest, that the next UpdateLOD()
+   * requests from the representations. This is typically set to the value
+   * returned by ComputeLODLevel() on the client.
+   * \note CallOnAllProcesses
+   */
+  vtkSetMacro(LODLevel, int);
+  vtkGetMacro(LODLevel, int);
+  ///@}
+
+  /**
+   * Returns the LOD level best suited to reach LODTargetFrameTime, based on
+   * the interactive render times measured for each level since the last time
+   * the LOD geometries were rebuilt. Moves at most one level at a time and
+   * returns 0 when there is no target frame time. When LODTargetFrameTime is 0
+   * and UseAdaptiveInteractiveRendering is on, the frame time matching
+   * TargetInteractiveFrameRate is used as target.
+   */
+  int ComputeLODLevel();
+
+  ///@{
+  /**
+   * When on, the image reduction factor and the LOD level used for
+   * interactive renders are adjusted after every interactive frame to hold
+   * TargetInteractiveFrameRate, based on the measured render, composite and
+   * image delivery times. InteractiveRenderImageReductionFactor is ignored in
+   * that case. Still renders are not affected, so full quality is restored as
+   * soon as the interaction ends. Off by default.
+   * \note CallOnAllProcesses
+   */
+  vtkSetMacro(UseAdaptiveInteractiveRendering, bool);
+  vtkGetMacro(UseAdaptiveInteractiveRendering, bool);
+  vtkBooleanMacro(UseAdaptiveInteractiveRendering, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the frame rate, in frames per second, that adaptive interactive
+   * rendering tries to hold. Default is 15.
+   * \note CallOnAllProcesses
+   */
+  vtkSetClampMacro(TargetInteractiveFrameRate, double, 1.0, 120.0);
+  vtkGetMacro(TargetInteractiveFrameRate, double);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the image reduction factor used for interactive renders when
+   * UseAdaptiveInteractiveRendering is on. This is typically set to the value
+   * returned by ComputeAdaptiveImageReductionFactor() on the client.
+   * \note CallOnAllProcesses
+   */
+  vtkSetClampMacro(AdaptiveImageReductionFactor, int, 1, 20);
+  vtkGetMacro(AdaptiveImageReductionFactor, int);
+  ///@}
+
+  /**
+   * Returns the image reduction factor best suited to hold
+   * TargetInteractiveFrameRate, based on the timings of the last interactive
+   * frame. Only the time spent delivering the image is assumed to scale with
+   * the number of pixels; the rest is left to the LOD level. Returns 1 when the
+   * last frame did not deliver an image from remote processes, since image
+   * reduction has no effect then.
+   */
+  int ComputeAdaptiveImageReductionFactor();
+
+  ///@{
+  /**
+   * Timings of the last interactive frame, in seconds. FrameTime is the
+   * wall-clock time of the whole frame; RenderTime is the part spent
+   * rendering and compositing, on the remote processes when remote rendering
+   * is used; ImageDeliveryTime is the part spent compressing, transferring and
+   * decompressing the image, 0 unless remote rendering is used.
+   */
+  double GetLastInteractiveFrameTime();
+  double GetLastInteractiveRenderTime();
+  double GetLastInteractiveImageDeliveryTime();
+  ///@}
+
   /**
    * Passes the compressor configuration to the client-server synchronizer, if
    * any. This affects the image compression used to relay images back to the
@@ -322,6 +479,14 @@ public:
    */
   static vtkInformationDoubleKey* LOD_RESOLUTION();
 
+  /**
+   * Indicates the number of LOD levels to build and the level to provide to
+   * the view in REQUEST_UPDATE_LOD() pass. Level 0 uses LOD_RESOLUTION() and
+   * each following level halves it.
+   */
+  static vtkInformationIntegerKey* NUMBER_OF_LOD_LEVELS();
+  static vtkInformationIntegerKey* LOD_LEVEL();
+
   /**
    * Indicates the LOD must use outline if possible in REQUEST_UPDATE_LOD()
    * pass.
@@ -1225,6 +1390,25 @@ protected:
    */
   bool ShouldUseDistributedRendering(double geometry_size, bool using_lod);
 
+  /**
+   * Accumulates the time of an interactive render using LOD for the current
+   * LOD level. Used by ComputeLODLevel().
+   */
+  void RecordLODRenderTime(double elapsed);
+
+  /**
+   * Records the timings of an interactive frame. Used by
+   * ComputeAdaptiveImageReductionFactor().
+   */
+  void RecordInteractiveFrame(double frameTime, bool remoteImage);
+
+  /**
+   * Returns the target time of LOD renders: LODTargetFrameTime if set, else
+   * the frame time matching TargetInteractiveFrameRate when
+   * UseAdaptiveInteractiveRendering is on, else 0.
+   */
+  double GetEffectiveLODTargetFrameTime() const;
+
   /**
    * Returns true if LOD rendering should be used based on the geometry size.
    */
@@ -1265,6 +1449,13 @@ protected:
    */
   void SynchronizeForCollaboration();
 
+  /**
+   * Called after delivering full resolution data to share the bounds of the
+   * blocks skipped by frustum culling with all processes. See
+   * UseBlockFrustumCulling.
+   */
+  void SynchronizeCulledBounds(unsigned int size, unsigned int* representation_ids);
+
   /**
    * Method to build annotation text to annotate the view with runtime
    * information.
@@ -1386,6 +1577,17 @@ protected:
   bool Blur;
 
   double LODResolution;
+  double LODTargetFrameTime = 0.0;
+  int NumberOfLODLevels = 4;
+  int LODLevel = 0;
+  bool UseAdaptiveInteractiveRendering = false;
+  double TargetInteractiveFrameRate = 15.0;
+  int AdaptiveImageReductionFactor = 1;
+  bool UseProgressiveDelivery = false;
+  double ProgressiveDeliveryBatchSize = 10.0;
+  bool UseBlockFrustumCulling = false;
+  double DeliveryViewPlanes[24];
+  bool HasDeliveryViewPlanes = false;
   bool UseLightKit;
 
   bool UsedLODForLastRender;
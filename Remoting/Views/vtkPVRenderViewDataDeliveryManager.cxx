@@ -4,8 +4,13 @@
 #include "vtkPVDataDeliveryManagerInternals.h"
 
 #include "vtkDIYKdTreeUtilities.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDataSet.h"
+#include "vtkFieldData.h"
 #include "vtkInformation.h"
 #include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationIdTypeKey.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkMPIMoveData.h"
 #include "vtkMath.h"
@@ -15,11 +20,13 @@
 #include "vtkObjectFactory.h"
 #include "vtkOrderedCompositeDistributor.h"
 #include "vtkPVLogger.h"
+#include "vtkPartitionedDataSetCollection.h"
 #include "vtkPVRenderView.h"
 
 #include <algorithm>
 #include <cassert>
 #include <map>
+#include <set>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -44,6 +51,10 @@ public:
   static vtkInformationDoubleVectorKey* TRANSFORMED_GEOMETRY_BOUNDS();
   static vtkInformationIntegerKey* ORDERED_COMPOSITING_CONFIGURATION();
   static vtkInformationDoubleVectorKey* ORDERED_COMPOSITING_BOUNDS();
+  static vtkInformationDoubleVectorKey* BLOCK_BOUNDS();
+  static vtkInformationIdTypeKey* BLOCK_BOUNDS_MTIME();
+  static vtkInformationDoubleVectorKey* CULLED_BOUNDS();
+  static vtkInformationDoubleVectorKey* CULLING_VIEW_PLANES();
 
   static int GetOrderedCompositingConfiguration(vtkInformation* info)
   {
@@ -69,6 +80,10 @@ vtkInformationKeyMacro(vtkPVRVDMKeys, ORDERED_COMPOSITING_CONFIGURATION, Integer
 vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, ORDERED_COMPOSITING_BOUNDS, DoubleVector, 6);
 vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, GEOMETRY_BOUNDS, DoubleVector, 6);
 vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, TRANSFORMED_GEOMETRY_BOUNDS, DoubleVector, 6);
+vtkInformationKeyMacro(vtkPVRVDMKeys, BLOCK_BOUNDS, DoubleVector);
+vtkInformationKeyMacro(vtkPVRVDMKeys, BLOCK_BOUNDS_MTIME, IdType);
+vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, CULLED_BOUNDS, DoubleVector, 6);
+vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, CULLING_VIEW_PLANES, DoubleVector, 24);
 } // end of namespace
 
 //*****************************************************************************
@@ -251,6 +266,190 @@ vtkBoundingBox vtkPVRenderViewDataDeliveryManager::GetTransformedGeometryBounds(
   return bbox;
 }
 
+//----------------------------------------------------------------------------
+vtkBoundingBox vtkPVRenderViewDataDeliveryManager::GetCulledBounds(
+  vtkPVDataRepresentation* repr, int port)
+{
+  vtkBoundingBox bbox;
+  if (auto info = this->GetPieceInformation(repr, /*low_res=*/false, port))
+  {
+    if (info->Has(vtkPVRVDMKeys::CULLED_BOUNDS()))
+    {
+      double bds[6];
+      info->Get(vtkPVRVDMKeys::CULLED_BOUNDS(), bds);
+      bbox.AddBounds(bds);
+    }
+  }
+  return bbox;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderViewDataDeliveryManager::SetCulledBounds(vtkPVDataRepresentation* repr,
+  const vtkBoundingBox& bbox, const double view_planes[24], int port)
+{
+  if (auto info = this->GetPieceInformation(repr, /*low_res=*/false, port))
+  {
+    if (bbox.IsValid())
+    {
+      double bds[6];
+      bbox.GetBounds(bds);
+      info->Set(vtkPVRVDMKeys::CULLED_BOUNDS(), bds, 6);
+      info->Set(vtkPVRVDMKeys::CULLING_VIEW_PLANES(), view_planes, 24);
+    }
+    else
+    {
+      info->Remove(vtkPVRVDMKeys::CULLED_BOUNDS());
+      info->Remove(vtkPVRVDMKeys::CULLING_VIEW_PLANES());
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVRenderViewDataDeliveryManager::GetCulledRepresentationsToDeliver(
+  const double* view_planes, std::vector<unsigned int>& keys)
+{
+  for (auto& ipair : this->Internals->ItemsMap)
+  {
+    const unsigned int id = ipair.first.first;
+    if (!this->Internals->IsRepresentationVisible(id))
+    {
+      continue;
+    }
+    auto repr = this->GetRepresentation(id);
+    auto info = ipair.second.first.GetPieceInformation(this->GetCacheKey(repr));
+    if (!info->Has(vtkPVRVDMKeys::CULLED_BOUNDS()))
+    {
+      continue;
+    }
+
+    if (view_planes)
+    {
+      const double* used_planes = info->Get(vtkPVRVDMKeys::CULLING_VIEW_PLANES());
+      if (used_planes && std::equal(view_planes, view_planes + 24, used_planes))
+      {
+        continue;
+      }
+
+      double bds[6];
+      info->Get(vtkPVRVDMKeys::CULLED_BOUNDS(), bds);
+      if (vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(view_planes, vtkBoundingBox(bds)))
+      {
+        continue;
+      }
+    }
+
+    vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "culled blocks may be visible: %s",
+      repr->GetLogName().c_str());
+    keys.push_back(id);
+    keys.push_back(static_cast<unsigned int>(ipair.first.second));
+  }
+  return !keys.empty();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(
+  const double view_planes[24], const vtkBoundingBox& bbox)
+{
+  if (!bbox.IsValid())
+  {
+    return false;
+  }
+
+  const double* minPoint = bbox.GetMinPoint();
+  const double* maxPoint = bbox.GetMaxPoint();
+  for (int plane = 0; plane < 4; ++plane)
+  {
+    // the corner of the box furthest along the plane normal is outside the
+    // plane only if the whole box is.
+    const double* normal = view_planes + 4 * plane;
+    double distance = normal[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      distance += normal[axis] * (normal[axis] >= 0 ? maxPoint[axis] : minPoint[axis]);
+    }
+    if (distance < 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkPVRenderViewDataDeliveryManager::CullBlocks(
+  vtkInformation* info, vtkDataObject* data, const double view_planes[24],
+  vtkBoundingBox& culledBounds)
+{
+  culledBounds.Reset();
+  auto tree = vtkDataObjectTree::SafeDownCast(data);
+  if (!tree)
+  {
+    return data;
+  }
+
+  // Bounds of the leaves, as (flat index, bounds) tuples, are cached in the
+  // piece information until the data changes.
+  const vtkIdType dataMTime = static_cast<vtkIdType>(data->GetMTime());
+  if (!info->Has(vtkPVRVDMKeys::BLOCK_BOUNDS()) ||
+    info->Get(vtkPVRVDMKeys::BLOCK_BOUNDS_MTIME()) != dataMTime)
+  {
+    std::vector<double> blockBounds;
+    auto iter = vtkSmartPointer<vtkDataObjectTreeIterator>::Take(tree->NewTreeIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      if (auto ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+      {
+        double bds[6];
+        ds->GetBounds(bds);
+        blockBounds.push_back(iter->GetCurrentFlatIndex());
+        blockBounds.insert(blockBounds.end(), bds, bds + 6);
+      }
+    }
+    info->Set(vtkPVRVDMKeys::BLOCK_BOUNDS(), blockBounds.data(),
+      static_cast<int>(blockBounds.size()));
+    info->Set(vtkPVRVDMKeys::BLOCK_BOUNDS_MTIME(), dataMTime);
+  }
+
+  const double* blockBounds = info->Get(vtkPVRVDMKeys::BLOCK_BOUNDS());
+  const int numBlocks = info->Length(vtkPVRVDMKeys::BLOCK_BOUNDS()) / 7;
+  std::set<unsigned int> culledBlocks;
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    const double* tuple = blockBounds + 7 * cc;
+    const vtkBoundingBox bbox(tuple + 1);
+    if (vtkPVRenderViewDataDeliveryManager::IsOutsideFrustum(view_planes, bbox))
+    {
+      culledBlocks.insert(static_cast<unsigned int>(tuple[0]));
+      culledBounds.AddBox(bbox);
+    }
+  }
+  if (culledBlocks.empty())
+  {
+    return data;
+  }
+
+  vtkSmartPointer<vtkDataObjectTree> culled;
+  culled.TakeReference(tree->NewInstance());
+  culled->CopyStructure(tree);
+  culled->GetFieldData()->ShallowCopy(tree->GetFieldData());
+  if (auto pdc = vtkPartitionedDataSetCollection::SafeDownCast(tree))
+  {
+    vtkPartitionedDataSetCollection::SafeDownCast(culled)->SetDataAssembly(
+      pdc->GetDataAssembly());
+  }
+  auto iter = vtkSmartPointer<vtkDataObjectTreeIterator>::Take(tree->NewTreeIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    if (culledBlocks.find(iter->GetCurrentFlatIndex()) == culledBlocks.end())
+    {
+      culled->SetDataSet(iter, iter->GetCurrentDataObject());
+    }
+  }
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "culled %d of %d blocks",
+    static_cast<int>(culledBlocks.size()), numBlocks);
+  return culled;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVRenderViewDataDeliveryManager::RedistributeDataForOrderedCompositing(bool low_res)
 {
@@ -607,9 +806,29 @@ void vtkPVRenderViewDataDeliveryManager::MoveData(
   const int viewMode = this->GetViewDataDistributionMode(low_res);
   const int moveMode = this->GetMoveMode(info, viewMode);
 
-  auto dataObj = item->GetDataObject(cacheKey);
+  vtkSmartPointer<vtkDataObject> dataObj = item->GetDataObject(cacheKey);
   assert(dataObj != nullptr);
 
+  // Skip blocks outside the view frustum. This is only done for full
+  // resolution data delivered to the processes doing the rendering, with the
+  // view planes passed to the view for this delivery, and when the geometry
+  // is not transformed since block bounds are in data coordinates.
+  auto renderView = vtkPVRenderView::SafeDownCast(this->GetView());
+  double view_planes[24] = { 0.0 };
+  vtkBoundingBox culledBounds;
+  if (!low_res && renderView && renderView->GetUseBlockFrustumCulling() &&
+    renderView->GetDeliveryViewPlanes(view_planes) && moveMode == viewMode &&
+    (viewMode == vtkMPIMoveData::COLLECT || viewMode == vtkMPIMoveData::PASS_THROUGH) &&
+    this->GetGeometryBounds(repr, port).IsValid() &&
+    this->GetGeometryBounds(repr, port) == this->GetTransformedGeometryBounds(repr, port))
+  {
+    dataObj = this->CullBlocks(info, dataObj, view_planes, culledBounds);
+  }
+  if (!low_res)
+  {
+    this->SetCulledBounds(repr, culledBounds, view_planes, port);
+  }
+
   vtkNew<vtkMPIMoveData> dataMover;
   dataMover->InitializeForCommunicationForParaView();
   dataMover->SetOutputDataType(dataObj->GetDataObjectType());
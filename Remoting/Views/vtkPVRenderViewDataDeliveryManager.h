@@ -104,6 +104,38 @@ public:
   vtkBoundingBox GetTransformedGeometryBounds(vtkPVDataRepresentation* repr, int port = 0);
   ///@}
 
+  ///@{
+  /**
+   * When vtkPVRenderView::GetUseBlockFrustumCulling() is on, blocks of
+   * composite datasets whose bounds are completely outside the view frustum
+   * are not delivered. These methods give access to the bounds of all blocks
+   * that were skipped during the last delivery of a representation. The
+   * view synchronizes them on all processes after each delivery, together
+   * with the view planes that were used.
+   */
+  vtkBoundingBox GetCulledBounds(vtkPVDataRepresentation* repr, int port = 0);
+  void SetCulledBounds(vtkPVDataRepresentation* repr, const vtkBoundingBox& bbox,
+    const double view_planes[24], int port = 0);
+  ///@}
+
+  /**
+   * Fills `keys` with the (representation, port) pairs for which some blocks
+   * were skipped by frustum culling and that may now be visible: the view
+   * planes changed since the last delivery and the bounds of the skipped
+   * blocks are not outside the new frustum. When `view_planes` is nullptr,
+   * i.e. culling is off, all representations with skipped blocks are
+   * returned. Returns true if `keys` is not empty.
+   */
+  bool GetCulledRepresentationsToDeliver(
+    const double* view_planes, std::vector<unsigned int>& keys);
+
+  /**
+   * Returns true if the box is completely outside the frustum defined by the
+   * first 4 planes returned by vtkCamera::GetFrustumPlanes(). The near and far
+   * planes are ignored since the clipping range is adjusted to the data.
+   */
+  static bool IsOutsideFrustum(const double view_planes[24], const vtkBoundingBox& bbox);
+
   // *******************************************************************
   // UNDER CONSTRUCTION STREAMING API
   // *******************************************************************
@@ -184,6 +216,15 @@ protected:
   int GetViewDataDistributionMode(bool low_res) const;
   int GetMoveMode(vtkInformation* info, int viewMode) const;
 
+  /**
+   * Returns a copy of the composite dataset `data` in which leaves that are
+   * outside the frustum are replaced by nullptr, or `data` itself if nothing
+   * is culled or `data` is not composite. Bounds of the leaves are cached in
+   * `info`. `culledBounds` is set to the bounds of the culled leaves.
+   */
+  vtkSmartPointer<vtkDataObject> CullBlocks(vtkInformation* info, vtkDataObject* data,
+    const double view_planes[24], vtkBoundingBox& culledBounds);
+
   std::vector<vtkBoundingBox> Cuts;
   std::vector<vtkBoundingBox> RawCuts;
   std::vector<int> RawCutsRankAssignments;
@@ -229,6 +229,22 @@ void vtkPVSynchronizedRenderer::SetLossLessCompression(bool val)
   }
 }
 
+//----------------------------------------------------------------------------
+double vtkPVSynchronizedRenderer::GetLastRemoteRenderTime()
+{
+  vtkPVClientServerSynchronizedRenderers* cssync =
+    vtkPVClientServerSynchronizedRenderers::SafeDownCast(this->CSSynchronizer);
+  return cssync ? cssync->GetLastRemoteRenderTime() : 0.0;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVSynchronizedRenderer::GetLastImageDeliveryTime()
+{
+  vtkPVClientServerSynchronizedRenderers* cssync =
+    vtkPVClientServerSynchronizedRenderers::SafeDownCast(this->CSSynchronizer);
+  return cssync ? cssync->GetLastImageDeliveryTime() : 0.0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSynchronizedRenderer::ConfigureCompressor(const char* configuration)
 {
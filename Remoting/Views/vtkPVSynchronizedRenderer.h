@@ -130,6 +130,18 @@ public:
   void SetLossLessCompression(bool);
   ///@}
 
+  ///@{
+  /**
+   * Returns the timings of the last render from the client-server
+   * synchronizer, if any. See
+   * vtkPVClientServerSynchronizedRenderers::GetLastRemoteRenderTime() and
+   * vtkPVClientServerSynchronizedRenderers::GetLastImageDeliveryTime().
+   * Returns 0 when not applicable.
+   */
+  double GetLastRemoteRenderTime();
+  double GetLastImageDeliveryTime();
+  ///@}
+
   /**
    * Activates or de-activated the use of Depth Buffer in an ImageProcessingPass
    */
@@ -31,6 +31,7 @@
 #include "vtkTimerLog.h"
 #include "vtkViewLayout.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <sstream>
@@ -766,9 +767,20 @@ void vtkPVView::AllReduce(const vtkBoundingBox& arg_source, vtkBoundingBox& dest
 //-----------------------------------------------------------------------------
 void vtkPVView::AllReduce(
   const vtkTypeUInt64 arg_source, vtkTypeUInt64& dest, int operation, bool skip_data_server)
+{
+  std::vector<vtkTypeUInt64> result;
+  this->AllReduce(std::vector<vtkTypeUInt64>(1, arg_source), result, operation, skip_data_server);
+  dest = result[0];
+  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "source=%llu, result=%llu", arg_source, dest);
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVView::AllReduce(const std::vector<vtkTypeUInt64>& arg_source,
+  std::vector<vtkTypeUInt64>& dest, int operation, bool skip_data_server)
 {
   assert(this->Session);
-  vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "all-reduce (op=%d)", operation);
+  vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "all-reduce (op=%d, size=%d)", operation,
+    static_cast<int>(arg_source.size()));
 
   auto evaluator = [operation](vtkTypeUInt64 a, vtkTypeUInt64 b)
   {
@@ -785,11 +797,18 @@ void vtkPVView::AllReduce(
     }
   };
 
-  vtkTypeUInt64 source = arg_source;
+  std::vector<vtkTypeUInt64> source = arg_source;
+  dest.resize(source.size());
+  if (source.empty())
+  {
+    return;
+  }
+
+  const vtkIdType length = static_cast<vtkIdType>(source.size());
   auto pController = vtkMultiProcessController::GetGlobalController();
   if (pController)
   {
-    pController->Reduce(&source, &dest, 1, operation, 0);
+    pController->Reduce(source.data(), dest.data(), length, operation, 0);
     source = dest;
   }
 
@@ -797,8 +816,8 @@ void vtkPVView::AllReduce(
   if (cController)
   {
     assert(pController == nullptr || pController->GetLocalProcessId() == 0);
-    cController->Send(&source, 1, 1, 41234);
-    cController->Receive(&source, 1, 1, 41235);
+    cController->Send(source.data(), length, 1, 41234);
+    cController->Receive(source.data(), length, 1, 41235);
   }
 
   auto crController = this->Session->GetController(vtkPVSession::RENDER_SERVER_ROOT);
@@ -808,37 +827,49 @@ void vtkPVView::AllReduce(
     cdController = nullptr;
   }
 
+  std::vector<vtkTypeUInt64> val(source.size());
   if (crController)
   {
-    vtkTypeUInt64 val;
-    crController->Receive(&val, 1, 1, 41234);
-    source = evaluator(source, val);
+    crController->Receive(val.data(), length, 1, 41234);
+    std::transform(source.begin(), source.end(), val.begin(), source.begin(), evaluator);
   }
 
   if (cdController)
   {
-    vtkTypeUInt64 val;
-    cdController->Receive(&val, 1, 1, 41234);
-    source = evaluator(source, val);
+    cdController->Receive(val.data(), length, 1, 41234);
+    std::transform(source.begin(), source.end(), val.begin(), source.begin(), evaluator);
   }
 
   if (crController)
   {
-    crController->Send(&source, 1, 1, 41235);
+    crController->Send(source.data(), length, 1, 41235);
   }
 
   if (cdController)
   {
-    cdController->Send(&source, 1, 1, 41235);
+    cdController->Send(source.data(), length, 1, 41235);
   }
 
   if (pController)
   {
-    pController->Broadcast(&source, 1, 0);
+    pController->Broadcast(source.data(), length, 0);
   }
 
   dest = source;
-  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "source=%llu, result=%llu", arg_source, dest);
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVView::ComputeDeliverySizes(
+  int use_lod, unsigned int size, unsigned int* representation_ids)
+{
+  std::vector<vtkTypeUInt64> local;
+  if (auto dm = this->GetDeliveryManager())
+  {
+    dm->GetDeliverySizes(use_lod, size, representation_ids, local);
+  }
+  // every process must contribute the same number of values.
+  local.resize(size / 2, 0);
+  this->AllReduce(local, this->DeliverySizes, vtkCommunicator::SUM_OP);
 }
 
 //-----------------------------------------------------------------------------
@@ -870,7 +901,7 @@ vtkPVSession* vtkPVView::GetSession()
 //----------------------------------------------------------------------------
 bool vtkPVView::IsCached(vtkPVDataRepresentation* repr)
 {
-  if (this->DeliveryManager && this->DeliveryManager->HasPiece(repr))
+  if (this->DeliveryManager && this->DeliveryManager->IsCached(repr))
   {
     vtkLogF(TRACE, "cached %s", repr->GetLogName().c_str());
     return true;
@@ -878,6 +909,39 @@ bool vtkPVView::IsCached(vtkPVDataRepresentation* repr)
   return false;
 }
 
+//----------------------------------------------------------------------------
+void vtkPVView::EnforceCacheSizeLimit()
+{
+  if (!this->UseCache || this->DeliveryManager == nullptr)
+  {
+    return;
+  }
+
+  auto dmgr = this->DeliveryManager;
+  dmgr->MarkCacheKeyUsed(this->CacheKey);
+  dmgr->SetCacheSizeLimit(vtkPVGeneralSettings::GetInstance()->GetAnimationGeometryCacheLimit());
+  const vtkTypeUInt64 limit = dmgr->GetCacheSizeLimit();
+  if (limit == 0)
+  {
+    return;
+  }
+
+  // Whether a representation is cached decides whether its pipeline executes,
+  // so all ranks must release the same cache keys. Each rank works out how
+  // many keys it needs to release, in least recently used order, which is the
+  // same on all ranks. The largest count is then released everywhere.
+  vtkTypeUInt64 count = 0;
+  this->AllReduce(static_cast<vtkTypeUInt64>(dmgr->GetNumberOfCacheKeysToEvict()), count,
+    vtkCommunicator::MAX_OP);
+  for (vtkTypeUInt64 cc = 0; cc < count; ++cc)
+  {
+    if (!dmgr->EvictLeastRecentlyUsedCacheKey())
+    {
+      break;
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkPVView::ClearCache(vtkPVDataRepresentation* repr)
 {
@@ -18,6 +18,8 @@
 #include "vtkView.h"
 #include "vtkWeakPointer.h" // for vtkWeakPointer
 
+#include <vector> // for std::vector
+
 class vtkBoundingBox;
 class vtkInformation;
 class vtkInformationObjectBaseKey;
@@ -267,6 +269,22 @@ public:
    */
   virtual void Deliver(int use_lod, unsigned int size, unsigned int* representation_ids);
 
+  /**
+   * Called on all processes to compute the size of the data that Deliver()
+   * would move for the list of representations, summed over all processes.
+   * `representation_ids` has the same layout as for Deliver(). The result,
+   * in kibibytes with one value per (representation, port) pair, can then be
+   * obtained with GetDeliverySizes(). This is used to deliver data
+   * progressively, smallest first. Note this method has to be called on all
+   * processes or it may lead to deadlock.
+   */
+  void ComputeDeliverySizes(int use_lod, unsigned int size, unsigned int* representation_ids);
+
+  /**
+   * Returns the sizes computed by the last call to ComputeDeliverySizes().
+   */
+  const std::vector<vtkTypeUInt64>& GetDeliverySizes() const { return this->DeliverySizes; }
+
   /**
    * Called in `vtkPVDataRepresentation::ProcessViewRequest` to check if the
    * representation already has cached data. If so, the representation may
@@ -311,6 +329,22 @@ protected:
   void AllReduce(
     vtkTypeUInt64 source, vtkTypeUInt64& dest, int operation, bool skip_data_server = false);
 
+  /**
+   * Same as above for an array of values, reduced element-wise. `source` must
+   * have the same size on all participating processes.
+   */
+  void AllReduce(const std::vector<vtkTypeUInt64>& source, std::vector<vtkTypeUInt64>& dest,
+    int operation, bool skip_data_server = false);
+
+  /**
+   * When caching is enabled, releases the data cached for the least
+   * recently used cache keys until the largest cache size among all
+   * participating processes is within
+   * vtkPVGeneralSettings::GetAnimationGeometryCacheLimit(). This has to be
+   * called on all processes or it may lead to deadlock.
+   */
+  void EnforceCacheSizeLimit();
+
   ///@{
   /**
    * Overridden to assign IDs to each representation. This assumes that
@@ -387,6 +421,8 @@ private:
   bool InCaptureScreenshot;
 
   vtkPVDataDeliveryManager* DeliveryManager;
+
+  std::vector<vtkTypeUInt64> DeliverySizes;
 };
 
 #endif
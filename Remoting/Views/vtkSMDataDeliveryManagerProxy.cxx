@@ -9,12 +9,15 @@
 #include "vtkPVDataDeliveryManager.h"
 #include "vtkPVLogger.h"
 #include "vtkPVRenderView.h"
+#include "vtkPVRenderViewDataDeliveryManager.h"
 #include "vtkPVStreamingPiecesInformation.h"
 #include "vtkRenderer.h"
 #include "vtkSMSession.h"
 #include "vtkSMViewProxy.h"
 
+#include <algorithm>
 #include <cassert>
+#include <numeric>
 
 vtkStandardNewMacro(vtkSMDataDeliveryManagerProxy);
 //----------------------------------------------------------------------------
@@ -52,33 +55,170 @@ void vtkSMDataDeliveryManagerProxy::Deliver(bool interactive)
 
   vtkMTimeType update_ts = view->GetUpdateTimeStamp();
 
+  // a new delivery request supersedes any pending progressive delivery.
+  this->PendingBatches.clear();
+
   // note: this will create new vtkTimeStamp, if needed.
   vtkTimeStamp& timeStamp =
     use_lod ? this->DeliveryTimestampsLOD[dataKey] : this->DeliveryTimestamps[dataKey];
 
-  if (timeStamp > update_ts)
+  // Get a list of representations for which we need to delivery data. If we
+  // have delivered the data since the last update on this view for the
+  // chosen data delivery mode, no delivery needs to be done at this time.
+  std::vector<unsigned int> keys_to_deliver;
+  if (timeStamp <= update_ts &&
+    !view->GetDeliveryManager()->NeedsDelivery(timeStamp, keys_to_deliver, use_lod))
+  {
+    timeStamp.Modified();
+  }
+
+  // Representations for which some blocks were skipped by frustum culling
+  // need to be delivered again if these blocks may now be visible.
+  auto rvdmanager = vtkPVRenderViewDataDeliveryManager::SafeDownCast(view->GetDeliveryManager());
+  if (!use_lod && rvdmanager)
+  {
+    double planes[24];
+    const bool culling = this->GetViewPlanes(planes);
+    std::vector<unsigned int> culled_keys;
+    rvdmanager->GetCulledRepresentationsToDeliver(culling ? planes : nullptr, culled_keys);
+    for (size_t cc = 0; cc < culled_keys.size(); cc += 2)
+    {
+      bool found = false;
+      for (size_t kk = 0; kk < keys_to_deliver.size() && !found; kk += 2)
+      {
+        found = keys_to_deliver[kk] == culled_keys[cc] &&
+          keys_to_deliver[kk + 1] == culled_keys[cc + 1];
+      }
+      if (!found)
+      {
+        keys_to_deliver.push_back(culled_keys[cc]);
+        keys_to_deliver.push_back(culled_keys[cc + 1]);
+      }
+    }
+  }
+
+  if (keys_to_deliver.empty())
   {
-    // we have delivered the data since the last update on this view for the
-    // chosen data delivery mode. No delivery needs to be done at this time.
     return;
   }
 
-  // Get a list of representations for which we need to delivery data.
-  std::vector<unsigned int> keys_to_deliver;
-  if (!view->GetDeliveryManager()->NeedsDelivery(timeStamp, keys_to_deliver, use_lod))
+  // With progressive delivery, only the first batch is delivered now; the
+  // others are delivered by DeliverNextBatch(). The timestamp is only updated
+  // once all batches have been delivered.
+  if (!interactive && renderview && renderview->GetUseProgressiveDelivery() &&
+    keys_to_deliver.size() > 2)
   {
-    timeStamp.Modified();
+    this->PendingBatches = this->SplitInBatches(
+      use_lod, keys_to_deliver, renderview->GetProgressiveDeliveryBatchSize());
+    this->PendingUseLOD = use_lod;
+    this->PendingDataKey = dataKey;
+    this->DeliverNextBatch();
     return;
   }
 
+  this->DeliverKeys(use_lod, keys_to_deliver);
+  timeStamp.Modified();
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMDataDeliveryManagerProxy::DeliverNextBatch()
+{
+  if (this->PendingBatches.empty())
+  {
+    return false;
+  }
+
+  const std::vector<unsigned int> keys = std::move(this->PendingBatches.front());
+  this->PendingBatches.erase(this->PendingBatches.begin());
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "deliver batch (%d left)",
+    static_cast<int>(this->PendingBatches.size()));
+  this->DeliverKeys(this->PendingUseLOD, keys);
+  if (this->PendingBatches.empty())
+  {
+    vtkTimeStamp& timeStamp = this->PendingUseLOD ? this->DeliveryTimestampsLOD[this->PendingDataKey]
+                                                  : this->DeliveryTimestamps[this->PendingDataKey];
+    timeStamp.Modified();
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMDataDeliveryManagerProxy::DeliverKeys(
+  bool use_lod, const std::vector<unsigned int>& keys)
+{
   vtkClientServerStream stream;
+  double planes[24];
+  if (!use_lod && this->GetViewPlanes(planes))
+  {
+    // pass the current camera frustum for culling blocks.
+    stream << vtkClientServerStream::Invoke << VTKOBJECT(this->ViewProxy)
+           << "SetDeliveryViewPlanes" << vtkClientServerStream::InsertArray(planes, 24)
+           << vtkClientServerStream::End;
+  }
   stream << vtkClientServerStream::Invoke << VTKOBJECT(this->ViewProxy) << "Deliver"
-         << static_cast<int>(use_lod) << static_cast<unsigned int>(keys_to_deliver.size())
-         << vtkClientServerStream::InsertArray(
-              keys_to_deliver.data(), static_cast<int>(keys_to_deliver.size()))
+         << static_cast<int>(use_lod) << static_cast<unsigned int>(keys.size())
+         << vtkClientServerStream::InsertArray(keys.data(), static_cast<int>(keys.size()))
          << vtkClientServerStream::End;
   this->ViewProxy->GetSession()->ExecuteStream(this->ViewProxy->GetLocation(), stream, false);
-  timeStamp.Modified();
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMDataDeliveryManagerProxy::GetViewPlanes(double planes[24])
+{
+  auto renderview = vtkPVRenderView::SafeDownCast(this->ViewProxy->GetClientSideObject());
+  if (!renderview || !renderview->GetUseBlockFrustumCulling())
+  {
+    return false;
+  }
+  vtkRenderer* ren = renderview->GetRenderer();
+  ren->GetActiveCamera()->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+std::vector<std::vector<unsigned int>> vtkSMDataDeliveryManagerProxy::SplitInBatches(
+  bool use_lod, const std::vector<unsigned int>& keys, double batchSize)
+{
+  // Sizes are only known on the processes that have the data, so gather them
+  // on all processes first.
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this->ViewProxy) << "ComputeDeliverySizes"
+         << static_cast<int>(use_lod) << static_cast<unsigned int>(keys.size())
+         << vtkClientServerStream::InsertArray(keys.data(), static_cast<int>(keys.size()))
+         << vtkClientServerStream::End;
+  this->ViewProxy->GetSession()->ExecuteStream(this->ViewProxy->GetLocation(), stream, false);
+
+  auto view = vtkPVView::SafeDownCast(this->ViewProxy->GetClientSideObject());
+  const std::vector<vtkTypeUInt64>& sizes = view->GetDeliverySizes();
+  const size_t numItems = keys.size() / 2;
+  if (sizes.size() != numItems)
+  {
+    return { keys };
+  }
+
+  std::vector<size_t> order(numItems);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(
+    order.begin(), order.end(), [&sizes](size_t a, size_t b) { return sizes[a] < sizes[b]; });
+
+  // sizes are in kibibytes, batchSize in megabytes.
+  const double maxBatchSize = batchSize * 1024.0;
+  std::vector<std::vector<unsigned int>> batches;
+  double currentSize = 0.0;
+  for (size_t item : order)
+  {
+    if (batches.empty() || currentSize + sizes[item] > maxBatchSize)
+    {
+      batches.emplace_back();
+      currentSize = 0.0;
+    }
+    batches.back().push_back(keys[2 * item]);
+    batches.back().push_back(keys[2 * item + 1]);
+    currentSize += sizes[item];
+  }
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "progressive delivery in %d batches",
+    static_cast<int>(batches.size()));
+  return batches;
 }
 
 //----------------------------------------------------------------------------
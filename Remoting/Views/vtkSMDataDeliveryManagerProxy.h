@@ -23,7 +23,8 @@
 #include "vtkSMProxy.h"
 #include "vtkWeakPointer.h" // needed for iVars
 
-#include <map> // for std::map
+#include <map>    // for std::map
+#include <vector> // for std::vector
 
 class vtkSMViewProxy;
 class VTKREMOTINGVIEWS_EXPORT vtkSMDataDeliveryManagerProxy : public vtkSMProxy
@@ -45,6 +46,21 @@ public:
    */
   void Deliver(bool interactive);
 
+  /**
+   * When vtkPVRenderView::GetUseProgressiveDelivery() is on, Deliver() only
+   * delivers the first batch of data for still renders. This delivers the
+   * next pending batch, if any, and returns true if a batch was delivered.
+   * The view should be rendered after each call. Calling Deliver() again
+   * discards pending batches.
+   */
+  bool DeliverNextBatch();
+
+  /**
+   * Returns true if some batches are waiting to be delivered by
+   * DeliverNextBatch().
+   */
+  bool HasPendingBatches() const { return !this->PendingBatches.empty(); }
+
   /**
    * EXPERIMEMTAL: Delivery when streaming is enabled.
    * Returns true when some new data was streamed. When this returns false, it
@@ -60,6 +76,16 @@ protected:
   std::map<int, vtkTimeStamp> DeliveryTimestamps;
   std::map<int, vtkTimeStamp> DeliveryTimestampsLOD;
 
+  // Batches of keys left to deliver with progressive delivery.
+  std::vector<std::vector<unsigned int>> PendingBatches;
+  bool PendingUseLOD = false;
+  int PendingDataKey = 0;
+
+  void DeliverKeys(bool use_lod, const std::vector<unsigned int>& keys);
+  bool GetViewPlanes(double planes[24]);
+  std::vector<std::vector<unsigned int>> SplitInBatches(
+    bool use_lod, const std::vector<unsigned int>& keys, double batchSize);
+
 private:
   vtkSMDataDeliveryManagerProxy(const vtkSMDataDeliveryManagerProxy&) = delete;
   void operator=(const vtkSMDataDeliveryManagerProxy&) = delete;
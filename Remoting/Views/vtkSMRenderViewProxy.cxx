@@ -23,6 +23,7 @@
 #include "vtkPVCAVEConfigInformation.h"
 #include "vtkPVDataInformation.h"
 #include "vtkPVEncodeSelectionForServer.h"
+#include "vtkPVRayCastPickingHelper.h"
 #include "vtkPVRenderView.h"
 #include "vtkPVRenderViewSettings.h"
 #include "vtkPVRenderingCapabilitiesInformation.h"
@@ -463,6 +464,8 @@ void vtkSMRenderViewProxy::UpdateLOD()
   if (this->ObjectsCreated && this->NeedsUpdateLOD)
   {
     vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "SetLODLevel" << this->LODLevel
+           << vtkClientServerStream::End;
     stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "UpdateLOD"
            << vtkClientServerStream::End;
     this->GetSession()->PrepareProgress();
@@ -523,8 +526,34 @@ vtkTypeUInt32 vtkSMRenderViewProxy::PreRender(bool interactive)
 
   vtkPVRenderView* rv = vtkPVRenderView::SafeDownCast(this->GetClientSideObject());
   assert(rv != nullptr);
+  if (interactive && rv->GetUseAdaptiveInteractiveRendering())
+  {
+    // Adjust the image reduction factor to the timings of the previous frame.
+    // It must match on all rendering processes, so only send it when it
+    // changes.
+    const int factor = rv->ComputeAdaptiveImageReductionFactor();
+    if (factor != rv->GetAdaptiveImageReductionFactor())
+    {
+      vtkClientServerStream stream;
+      stream << vtkClientServerStream::Invoke << VTKOBJECT(this)
+             << "SetAdaptiveImageReductionFactor" << factor << vtkClientServerStream::End;
+      this->ExecuteStream(stream, false, rv->GetInteractiveRenderProcesses());
+    }
+  }
+
   if (rv->GetUseLODForInteractiveRender())
   {
+    if (interactive)
+    {
+      // Switch to the LOD level that best fits the target frame time, if any.
+      const int level = rv->ComputeLODLevel();
+      if (level != this->LODLevel)
+      {
+        this->LODLevel = level;
+        this->NeedsUpdateLOD = true;
+      }
+    }
+
     // We trigger the update of the LOD data in non interactive render to catch the moment when the
     // user updates the pipeline data.
     this->UpdateLOD();
@@ -1379,53 +1408,75 @@ bool vtkSMRenderViewProxy::ConvertDisplayToPointOnSurface(const int display_posi
   int region[4] = { display_position[0], display_position[1], display_position[0],
     display_position[1] };
 
-  vtkSMSessionProxyManager* spxm = this->GetSessionProxyManager();
-  vtkNew<vtkCollection> representations;
-  vtkNew<vtkCollection> sources;
+  // Picking info
+  // {r0, r1, 1} => We want to make sure the ray that start from the camera reach
+  // the end of the scene so it could cross any cell of the scene
+  double nearDisplayPoint[3] = { (double)region[0], (double)region[1], 0.0 };
+  double farDisplayPoint[3] = { (double)region[0], (double)region[1], 1.0 };
+  double farLinePoint[3];
+  double nearLinePoint[3];
+
+  vtkRenderer* renderer = this->GetRenderer();
 
-  if (snapOnMeshPoint)
+  // compute near line point
+  renderer->SetDisplayPoint(nearDisplayPoint);
+  renderer->DisplayToWorld();
+  const double* world = renderer->GetWorldPoint();
+  for (int i = 0; i < 3; i++)
   {
-    this->SelectSurfacePoints(region, representations, sources, false);
+    nearLinePoint[i] = world[i] / world[3];
   }
-  else
+
+  // compute far line point
+  renderer->SetDisplayPoint(farDisplayPoint);
+  renderer->DisplayToWorld();
+  world = renderer->GetWorldPoint();
+  for (int i = 0; i < 3; i++)
   {
-    this->SelectSurfaceCells(region, representations, sources, false);
+    farLinePoint[i] = world[i] / world[3];
   }
 
-  if (representations->GetNumberOfItems() > 0 && sources->GetNumberOfItems() > 0)
+  // When the geometry is rendered locally, intersect the ray with it directly
+  // using the locators cached with the delivered geometry. This avoids a
+  // selection render and extracting the selection on the data server.
+  bool found = false;
+  vtkPVRenderView* rv = vtkPVRenderView::SafeDownCast(this->GetClientSideObject());
+  if (rv && !rv->GetUseDistributedRenderingForRender())
   {
-    vtkSMRepresentationProxy* rep =
-      vtkSMRepresentationProxy::SafeDownCast(representations->GetItemAsObject(0));
-    vtkSMProxy* input = vtkSMPropertyHelper(rep, "Input").GetAsProxy(0);
-    vtkSMSourceProxy* selection = vtkSMSourceProxy::SafeDownCast(sources->GetItemAsObject(0));
-
-    // Picking info
-    // {r0, r1, 1} => We want to make sure the ray that start from the camera reach
-    // the end of the scene so it could cross any cell of the scene
-    double nearDisplayPoint[3] = { (double)region[0], (double)region[1], 0.0 };
-    double farDisplayPoint[3] = { (double)region[0], (double)region[1], 1.0 };
-    double farLinePoint[3];
-    double nearLinePoint[3];
+    vtkNew<vtkPVRayCastPickingHelper> localPickingHelper;
+    localPickingHelper->SetPointA(nearLinePoint);
+    localPickingHelper->SetPointB(farLinePoint);
+    localPickingHelper->SetSnapOnMeshPoint(snapOnMeshPoint);
+    if (localPickingHelper->ComputeIntersectionFromView(rv))
+    {
+      localPickingHelper->GetIntersection(world_position);
+      localPickingHelper->GetIntersectionNormal(world_normal);
+      found = true;
+    }
+  }
 
-    vtkRenderer* renderer = this->GetRenderer();
+  vtkSMSessionProxyManager* spxm = this->GetSessionProxyManager();
+  vtkNew<vtkCollection> representations;
+  vtkNew<vtkCollection> sources;
 
-    // compute near line point
-    renderer->SetDisplayPoint(nearDisplayPoint);
-    renderer->DisplayToWorld();
-    const double* world = renderer->GetWorldPoint();
-    for (int i = 0; i < 3; i++)
+  if (!found)
+  {
+    if (snapOnMeshPoint)
     {
-      nearLinePoint[i] = world[i] / world[3];
+      this->SelectSurfacePoints(region, representations, sources, false);
     }
-
-    // compute far line point
-    renderer->SetDisplayPoint(farDisplayPoint);
-    renderer->DisplayToWorld();
-    world = renderer->GetWorldPoint();
-    for (int i = 0; i < 3; i++)
+    else
     {
-      farLinePoint[i] = world[i] / world[3];
+      this->SelectSurfaceCells(region, representations, sources, false);
     }
+  }
+
+  if (!found && representations->GetNumberOfItems() > 0 && sources->GetNumberOfItems() > 0)
+  {
+    vtkSMRepresentationProxy* rep =
+      vtkSMRepresentationProxy::SafeDownCast(representations->GetItemAsObject(0));
+    vtkSMProxy* input = vtkSMPropertyHelper(rep, "Input").GetAsProxy(0);
+    vtkSMSourceProxy* selection = vtkSMSourceProxy::SafeDownCast(sources->GetItemAsObject(0));
 
     // Compute the  intersection...
     vtkSMProxy* pickingHelper = spxm->NewProxy("misc", "PickingHelper");
@@ -1455,7 +1506,11 @@ bool vtkSMRenderViewProxy::ConvertDisplayToPointOnSurface(const int display_posi
       vtkSMPropertyHelper(pickingHelper, "IntersectionNormal").Get(world_normal, 3);
     }
     pickingHelper->Delete();
+    found = true;
+  }
 
+  if (found)
+  {
     static constexpr double PI_2 = vtkMath::Pi() / 2.0f;
     // Note: Fix normal direction in case the orientation of the picked cell is wrong.
     // When you cast a ray to a 3d object from a specific view angle (camera normal), the angle
@@ -1485,7 +1540,6 @@ bool vtkSMRenderViewProxy::ConvertDisplayToPointOnSurface(const int display_posi
     }
     // Use camera focal point to get some Zbuffer
     double cameraFP[4];
-    vtkRenderer* renderer = this->GetRenderer();
     vtkCamera* camera = renderer->GetActiveCamera();
     camera->GetViewPlaneNormal(world_normal);
     camera->GetFocalPoint(cameraFP);
@@ -1498,7 +1552,7 @@ bool vtkSMRenderViewProxy::ConvertDisplayToPointOnSurface(const int display_posi
     double display[3] = { (double)region[0], (double)region[1], displayCoord[2] };
     renderer->SetDisplayPoint(display);
     renderer->DisplayToWorld();
-    const double* world = renderer->GetWorldPoint();
+    world = renderer->GetWorldPoint();
     for (int i = 0; i < 3; i++)
     {
       world_position[i] = world[i] / world[3];
@@ -1858,8 +1912,8 @@ bool vtkSMRenderViewProxy::SelectPolygonInternal(vtkIntArray* polygonPts,
     fieldAssociation == vtkSelectionNode::POINT ? "SelectPolygonPoints" : "SelectPolygonCells";
   vtkClientServerStream stream;
   stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << method
-         << vtkClientServerStream::InsertArray(polygonPts->GetPointer(0),
-              polygonPts->GetNumberOfTuples() * polygonPts->GetNumberOfComponents())
+         << vtkClientServerStream::InsertArrayReference(polygonPts->GetPointer(0),
+              polygonPts->GetNumberOfTuples() * polygonPts->GetNumberOfComponents(), polygonPts)
          << polygonPts->GetNumberOfTuples() * polygonPts->GetNumberOfComponents()
          << vtkClientServerStream::End;
   return this->SelectInternal(
@@ -439,7 +439,8 @@ protected:
   void RenderForImageCapture() override;
 
   /**
-   * Calls UpdateLOD() on the vtkPVRenderView.
+   * Calls UpdateLOD() on the vtkPVRenderView, requesting the LOD level picked
+   * by the last interactive PreRender().
    */
   void UpdateLOD();
 
@@ -487,6 +488,7 @@ protected:
   void UpdateAnariProperties();
 
   bool NeedsUpdateLOD;
+  int LODLevel = 0;
 
 private:
   vtkSMRenderViewProxy(const vtkSMRenderViewProxy&) = delete;
@@ -590,12 +590,11 @@ bool vtkSMSaveScreenshotProxy::WriteImage(
   vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "Save captured image to '%s'", fname);
 
   auto pxm = this->GetSessionProxyManager();
+  const bool saveInBackground = vtkSMPropertyHelper(this, "SaveInBackground").GetAsInt() != 0;
   auto remoteWriter = vtkSmartPointer<vtkSMSourceProxy>::Take(
     vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("misc", "RemoteWriterHelper")));
-  vtkSMPropertyHelper(remoteWriter, "Writer").Set(format);
   vtkSMPropertyHelper(remoteWriter, "OutputDestination").Set(static_cast<int>(location));
-  vtkSMPropertyHelper(remoteWriter, "TryWritingInBackground")
-    .Set(vtkSMPropertyHelper(this, "SaveInBackground").GetAsInt());
+  vtkSMPropertyHelper(remoteWriter, "TryWritingInBackground").Set(saveInBackground ? 1 : 0);
   remoteWriter->UpdateVTKObjects();
 
   vtkTimerLog::MarkStartEvent("Write image to disk");
@@ -612,29 +611,37 @@ bool vtkSMSaveScreenshotProxy::WriteImage(
     metadata.Set(1, stream.str().c_str());
   }
 
+  auto writeImage = [&](const std::string& imageFileName, vtkImageData* image)
+  {
+    // An image written in the background is still being encoded when the next
+    // image is written, so it needs a writer of its own.
+    vtkSmartPointer<vtkSMProxy> writer = format;
+    if (saveInBackground)
+    {
+      writer.TakeReference(pxm->NewProxy(format->GetXMLGroup(), format->GetXMLName()));
+      writer->SetLocation(format->GetLocation());
+      writer->Copy(format);
+    }
+    vtkSMPropertyHelper(writer, "FileName").Set(imageFileName.c_str());
+    writer->UpdateVTKObjects();
+    vtkSMPropertyHelper(remoteWriter, "Writer").Set(writer);
+    remoteWriter->UpdateVTKObjects();
+    remoteWriterAlgorithm->SetInputDataObject(image);
+    remoteWriter->UpdatePipeline();
+  };
+
   if (image_pair.second)
   {
     // write right-eye.
-    vtkSMPropertyHelper(format, "FileName")
-      .Set(this->GetStereoFileName(filename, /*left=*/false).c_str());
-    format->UpdateVTKObjects();
-    remoteWriterAlgorithm->SetInputDataObject(image_pair.second);
-    remoteWriter->UpdatePipeline();
+    writeImage(this->GetStereoFileName(filename, /*left=*/false), image_pair.second);
 
     // write left-eye.
-    vtkSMPropertyHelper(format, "FileName")
-      .Set(this->GetStereoFileName(filename, /*left=*/true).c_str());
-    format->UpdateVTKObjects();
-    remoteWriterAlgorithm->SetInputDataObject(image_pair.first);
-    remoteWriter->UpdatePipeline();
+    writeImage(this->GetStereoFileName(filename, /*left=*/true), image_pair.first);
   }
   else
   {
     // write left-eye.
-    vtkSMPropertyHelper(format, "FileName").Set(filename.c_str());
-    format->UpdateVTKObjects();
-    remoteWriterAlgorithm->SetInputDataObject(image_pair.first);
-    remoteWriter->UpdatePipeline();
+    writeImage(filename, image_pair.first);
   }
 
   remoteWriterAlgorithm->SetInputDataObject(nullptr);
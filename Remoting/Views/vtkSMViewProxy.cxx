@@ -395,6 +395,13 @@ void vtkSMViewProxy::StillRender()
     stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "StillRender"
            << vtkClientServerStream::End;
     this->ExecuteStream(stream, false, render_location);
+
+    // with progressive delivery, render again as each remaining batch of data
+    // is delivered.
+    while (this->DeliveryManager && this->DeliveryManager->DeliverNextBatch())
+    {
+      this->ExecuteStream(stream, false, render_location);
+    }
   }
 
   this->PostRender(interactive == 1);
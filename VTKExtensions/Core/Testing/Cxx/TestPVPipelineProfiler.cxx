@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVCompositeDataPipeline.h"
+#include "vtkPVPipelineProfiler.h"
+
+#include "vtkElevationFilter.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+
+extern int TestPVPipelineProfiler(int, char*[])
+{
+  vtkNew<vtkPVPipelineProfiler> profiler;
+  profiler->Clear();
+  profiler->SetEnabled(true);
+  profiler->SetRecordMemory(false);
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetExecutive(vtkNew<vtkPVCompositeDataPipeline>());
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetExecutive(vtkNew<vtkPVCompositeDataPipeline>());
+  elevation->SetInputConnection(sphere->GetOutputPort());
+  elevation->Update();
+
+  auto events = vtkPVPipelineProfiler::GetEvents();
+  int numData = 0;
+  for (const auto& event : events)
+  {
+    if (event.Request == vtkPVPipelineProfiler::REQUEST_DATA)
+    {
+      ++numData;
+      vtkLogIf(ERROR, event.OutputSize <= 0, "Missing output size for " << event.Algorithm);
+      vtkLogIf(ERROR, event.Duration < 0, "Invalid duration for " << event.Algorithm);
+    }
+    if (event.MemoryDelta != 0)
+    {
+      vtkLog(ERROR, "Memory recorded while disabled for " << event.Algorithm);
+      return EXIT_FAILURE;
+    }
+  }
+  if (numData != 2 || events.size() != 4)
+  {
+    vtkLog(ERROR, "Expected 4 events with 2 RequestData, got " << events.size() << " and "
+                                                               << numData);
+    return EXIT_FAILURE;
+  }
+  // upstream executes first.
+  if (events[0].Algorithm.find("vtkSphereSource") != 0 ||
+    events.back().Algorithm.find("vtkElevationFilter") != 0)
+  {
+    vtkLog(ERROR, "Unexpected event order.");
+    return EXIT_FAILURE;
+  }
+
+  // The ring buffer keeps the most recent events only.
+  profiler->SetCapacity(3);
+  events = vtkPVPipelineProfiler::GetEvents();
+  if (events.size() != 3 || events.back().Algorithm.find("vtkElevationFilter") != 0)
+  {
+    vtkLog(ERROR, "Shrinking the capacity did not keep the most recent events.");
+    return EXIT_FAILURE;
+  }
+  sphere->Modified();
+  elevation->Update();
+  events = vtkPVPipelineProfiler::GetEvents();
+  if (events.size() != 3 || events.back().Algorithm.find("vtkElevationFilter") != 0)
+  {
+    vtkLog(ERROR, "Ring buffer did not wrap around correctly.");
+    return EXIT_FAILURE;
+  }
+
+  const std::string trace = vtkPVPipelineProfiler::ToChromeTrace(events);
+  if (trace.find("\"traceEvents\"") == std::string::npos ||
+    trace.find("\"cat\":\"RequestData\"") == std::string::npos)
+  {
+    vtkLog(ERROR, "Invalid Chrome trace: " << trace);
+    return EXIT_FAILURE;
+  }
+
+  // Sampling memory is opt-in.
+  if (vtkPVPipelineProfiler::GetProcessMemoryUsed() < 0)
+  {
+    vtkLog(ERROR, "Invalid resident memory.");
+    return EXIT_FAILURE;
+  }
+  profiler->SetRecordMemory(true);
+  sphere->Modified();
+  elevation->Update();
+  profiler->SetRecordMemory(false);
+  if (vtkPVPipelineProfiler::GetEvents().size() != 3)
+  {
+    vtkLog(ERROR, "Events not recorded while recording memory.");
+    return EXIT_FAILURE;
+  }
+
+  // Nothing is recorded when disabled.
+  profiler->SetEnabled(false);
+  profiler->Clear();
+  sphere->Modified();
+  elevation->Update();
+  if (!vtkPVPipelineProfiler::GetEvents().empty())
+  {
+    vtkLog(ERROR, "Events recorded while disabled.");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
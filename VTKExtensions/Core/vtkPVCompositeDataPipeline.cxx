@@ -12,9 +12,58 @@
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVPipelineProfiler.h"
 #include "vtkPVPostFilterExecutive.h"
 
 #include <cassert>
+#include <chrono>
+#include <utility>
+
+namespace
+{
+// Records a pipeline pass of an algorithm in vtkPVPipelineProfiler.
+class vtkPipelinePassRecorder
+{
+public:
+  static double GetUniversalTime()
+  {
+    return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch())
+      .count();
+  }
+
+  vtkPipelinePassRecorder(vtkAlgorithm* algorithm, int request)
+  {
+    this->Event.Algorithm = algorithm->GetObjectDescription();
+    this->Event.Request = request;
+    this->RecordMemory = vtkPVPipelineProfiler::IsMemoryRecorded();
+    this->Memory = this->RecordMemory ? vtkPVPipelineProfiler::GetProcessMemoryUsed() : 0;
+    this->Event.StartTime = vtkPipelinePassRecorder::GetUniversalTime();
+  }
+
+  void Finish(vtkInformationVector* outInfoVec)
+  {
+    this->Event.Duration = vtkPipelinePassRecorder::GetUniversalTime() - this->Event.StartTime;
+    if (this->RecordMemory)
+    {
+      this->Event.MemoryDelta = vtkPVPipelineProfiler::GetProcessMemoryUsed() - this->Memory;
+    }
+    if (this->Event.Request == vtkPVPipelineProfiler::REQUEST_DATA)
+    {
+      for (int cc = 0; cc < outInfoVec->GetNumberOfInformationObjects(); ++cc)
+      {
+        vtkDataObject* output = vtkDataObject::GetData(outInfoVec, cc);
+        this->Event.OutputSize += output ? output->GetActualMemorySize() : 0;
+      }
+    }
+    vtkPVPipelineProfiler::Record(std::move(this->Event));
+  }
+
+private:
+  vtkPVPipelineProfiler::Event Event;
+  bool RecordMemory;
+  vtkTypeInt64 Memory;
+};
+}
 
 vtkStandardNewMacro(vtkPVCompositeDataPipeline);
 //----------------------------------------------------------------------------
@@ -67,6 +116,36 @@ void vtkPVCompositeDataPipeline::CopyDefaultInformation(vtkInformation* request,
   }
 }
 
+//----------------------------------------------------------------------------
+int vtkPVCompositeDataPipeline::ExecuteInformation(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (!vtkPVPipelineProfiler::IsEnabled())
+  {
+    return this->Superclass::ExecuteInformation(request, inInfoVec, outInfoVec);
+  }
+
+  vtkPipelinePassRecorder recorder(this->Algorithm, vtkPVPipelineProfiler::REQUEST_INFORMATION);
+  const int result = this->Superclass::ExecuteInformation(request, inInfoVec, outInfoVec);
+  recorder.Finish(outInfoVec);
+  return result;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (!vtkPVPipelineProfiler::IsEnabled())
+  {
+    return this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  }
+
+  vtkPipelinePassRecorder recorder(this->Algorithm, vtkPVPipelineProfiler::REQUEST_DATA);
+  const int result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  recorder.Finish(outInfoVec);
+  return result;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVCompositeDataPipeline::ResetPipelineInformation(int port, vtkInformation* info)
 {
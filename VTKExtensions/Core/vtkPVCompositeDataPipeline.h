@@ -12,6 +12,9 @@
  *     algorithms are passed along to the input vtkPVPostFilter, if one exists.
  *     vtkPVPostFilter is used to automatically extract components or generated
  *     derived arrays such as magnitude array for vectors.
+ * \li Profiling :- when vtkPVPipelineProfiler is enabled, RequestInformation and
+ *     RequestData passes are recorded with their duration, memory change and
+ *     output size.
  */
 
 #ifndef vtkPVCompositeDataPipeline_h
@@ -35,6 +38,12 @@ protected:
   void CopyDefaultInformation(vtkInformation* request, int direction,
     vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override;
 
+  // Record the passes in vtkPVPipelineProfiler when it is enabled.
+  int ExecuteInformation(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
   // Remove update/whole extent when resetting pipeline information.
   void ResetPipelineInformation(int port, vtkInformation*) override;
 
@@ -0,0 +1,279 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVPipelineProfiler.h"
+
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+
+#include <vtksys/SystemInformation.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+struct vtkProfilerState
+{
+  std::mutex Mutex;
+  // Ring buffer; once full, Next is the index of the oldest event.
+  std::vector<vtkPVPipelineProfiler::Event> Events;
+  size_t Next = 0;
+  size_t Capacity = 10000;
+};
+
+vtkProfilerState& GetState()
+{
+  static vtkProfilerState state;
+  return state;
+}
+
+bool InitialValue(const char* variable)
+{
+  std::string value;
+  return vtksys::SystemTools::GetEnv(variable, value) && value == "1";
+}
+
+std::atomic<bool> Enabled(InitialValue("PARAVIEW_PIPELINE_PROFILER"));
+std::atomic<bool> RecordMemory(InitialValue("PARAVIEW_PIPELINE_PROFILER_MEMORY"));
+
+void WriteJSONString(std::ostream& os, const std::string& str)
+{
+  os << '"';
+  for (char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+          os << escaped;
+        }
+        else
+        {
+          os << c;
+        }
+        break;
+    }
+  }
+  os << '"';
+}
+}
+
+vtkStandardNewMacro(vtkPVPipelineProfiler);
+//----------------------------------------------------------------------------
+vtkPVPipelineProfiler::vtkPVPipelineProfiler() = default;
+
+//----------------------------------------------------------------------------
+vtkPVPipelineProfiler::~vtkPVPipelineProfiler() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::SetEnabled(bool enabled)
+{
+  if (::Enabled.exchange(enabled) != enabled)
+  {
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineProfiler::GetEnabled()
+{
+  return vtkPVPipelineProfiler::IsEnabled();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineProfiler::IsEnabled()
+{
+  return ::Enabled.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::SetRecordMemory(bool record)
+{
+  if (::RecordMemory.exchange(record) != record)
+  {
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineProfiler::GetRecordMemory()
+{
+  return vtkPVPipelineProfiler::IsMemoryRecorded();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineProfiler::IsMemoryRecorded()
+{
+  return ::RecordMemory.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::SetCapacity(int capacity)
+{
+  auto events = vtkPVPipelineProfiler::GetEvents();
+  auto& state = ::GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Capacity = static_cast<size_t>(std::max(capacity, 1));
+
+  // keep the most recent events that still fit.
+  const size_t kept = std::min(events.size(), state.Capacity);
+  state.Events.assign(std::make_move_iterator(events.end() - kept),
+    std::make_move_iterator(events.end()));
+  state.Next = state.Events.size() % state.Capacity;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+int vtkPVPipelineProfiler::GetCapacity()
+{
+  auto& state = ::GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  return static_cast<int>(state.Capacity);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::Clear()
+{
+  auto& state = ::GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  state.Events.clear();
+  state.Next = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::Record(Event&& event)
+{
+  if (!vtkPVPipelineProfiler::IsEnabled())
+  {
+    return;
+  }
+
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  event.Rank = controller ? controller->GetLocalProcessId() : 0;
+
+  auto& state = ::GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  if (state.Events.size() < state.Capacity)
+  {
+    state.Events.push_back(std::move(event));
+  }
+  else
+  {
+    state.Events[state.Next] = std::move(event);
+  }
+  state.Next = (state.Next + 1) % state.Capacity;
+}
+
+//----------------------------------------------------------------------------
+std::vector<vtkPVPipelineProfiler::Event> vtkPVPipelineProfiler::GetEvents()
+{
+  auto& state = ::GetState();
+  std::lock_guard<std::mutex> lock(state.Mutex);
+  if (state.Events.size() < state.Capacity)
+  {
+    return state.Events;
+  }
+
+  std::vector<Event> events;
+  events.reserve(state.Events.size());
+  events.insert(events.end(), state.Events.begin() + state.Next, state.Events.end());
+  events.insert(events.end(), state.Events.begin(), state.Events.begin() + state.Next);
+  return events;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVPipelineProfiler::GetProcessMemoryUsed()
+{
+#if defined(__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info),
+        &count) != KERN_SUCCESS)
+  {
+    return 0;
+  }
+  return static_cast<vtkTypeInt64>(info.resident_size / 1024);
+#elif defined(__linux__)
+  // The second field of statm is the number of resident pages. The file is
+  // kept open and read again from the start on each call.
+  static const int fd = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+  static const long pageSize = sysconf(_SC_PAGESIZE);
+  char buffer[128];
+  const ssize_t length = fd >= 0 ? pread(fd, buffer, sizeof(buffer) - 1, 0) : -1;
+  if (length <= 0)
+  {
+    return 0;
+  }
+  buffer[length] = '\0';
+  char* end = nullptr;
+  strtoll(buffer, &end, 10);
+  const long long pages = strtoll(end, nullptr, 10);
+  return static_cast<vtkTypeInt64>(pages) * pageSize / 1024;
+#else
+  static vtksys::SystemInformation sysinfo;
+  return static_cast<vtkTypeInt64>(sysinfo.GetProcMemoryUsed());
+#endif
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVPipelineProfiler::ToChromeTrace(const std::vector<Event>& events)
+{
+  // Timestamps are made relative to the earliest event to keep them small.
+  double origin = 0.0;
+  if (!events.empty())
+  {
+    origin = std::min_element(events.begin(), events.end(),
+      [](const Event& a, const Event& b) { return a.StartTime < b.StartTime; })
+               ->StartTime;
+  }
+
+  std::ostringstream os;
+  os.precision(15);
+  os << "{\"traceEvents\":[";
+  bool first = true;
+  for (const auto& event : events)
+  {
+    os << (first ? "\n" : ",\n") << "{\"name\":";
+    ::WriteJSONString(os, event.Algorithm);
+    os << ",\"cat\":\""
+       << (event.Request == REQUEST_INFORMATION ? "RequestInformation" : "RequestData")
+       << "\",\"ph\":\"X\",\"pid\":" << event.Rank << ",\"tid\":0"
+       << ",\"ts\":" << (event.StartTime - origin) * 1e6 << ",\"dur\":" << event.Duration * 1e6
+       << ",\"args\":{\"memory_delta_kib\":" << event.MemoryDelta
+       << ",\"output_size_kib\":" << event.OutputSize << "}}";
+    first = false;
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return os.str();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << this->GetEnabled() << endl;
+  os << indent << "RecordMemory: " << this->GetRecordMemory() << endl;
+  os << indent << "Capacity: " << this->GetCapacity() << endl;
+  os << indent << "NumberOfEvents: " << vtkPVPipelineProfiler::GetEvents().size() << endl;
+}
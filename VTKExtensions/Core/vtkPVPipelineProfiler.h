@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkPVPipelineProfiler
+ * @brief records pipeline execution events on a process.
+ *
+ * vtkPVPipelineProfiler records, for each RequestInformation and RequestData
+ * pass executed by vtkPVCompositeDataPipeline, the algorithm class, start
+ * time, duration, size of the produced data and, optionally, change in
+ * resident memory of the process.
+ * Events are kept in a fixed-size ring buffer shared by all instances of this
+ * class on a process, so that a long running session keeps the most recent
+ * events only.
+ *
+ * Profiling is disabled by default. It can be enabled with SetEnabled(), which
+ * is exposed on the "PipelineProfiler" misc proxy, or by setting the
+ * `PARAVIEW_PIPELINE_PROFILER` environment variable to `1`. Recorded events
+ * are gathered from all ranks with vtkPVPipelineProfilerInformation and can be
+ * exported in the Chrome trace event format with ToChromeTrace().
+ *
+ * Sampling memory adds two queries of the resident memory to every pass, so
+ * it is enabled separately with SetRecordMemory() or by setting the
+ * `PARAVIEW_PIPELINE_PROFILER_MEMORY` environment variable to `1`.
+ */
+
+#ifndef vtkPVPipelineProfiler_h
+#define vtkPVPipelineProfiler_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVPipelineProfiler : public vtkObject
+{
+public:
+  static vtkPVPipelineProfiler* New();
+  vtkTypeMacro(vtkPVPipelineProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum RequestTypes
+  {
+    REQUEST_INFORMATION = 0,
+    REQUEST_DATA = 1
+  };
+
+  /**
+   * A single pipeline pass executed by an algorithm.
+   */
+  struct Event
+  {
+    std::string Algorithm;
+    int Request = REQUEST_DATA;
+    int Rank = 0;
+    // Universal time in seconds when the pass started, and its duration.
+    double StartTime = 0.0;
+    double Duration = 0.0;
+    // Change in resident memory of the process during the pass, in KiB. Only
+    // set when memory is recorded.
+    vtkTypeInt64 MemoryDelta = 0;
+    // Size of the data produced by the pass, in KiB. Only set for REQUEST_DATA.
+    vtkTypeInt64 OutputSize = 0;
+  };
+
+  ///@{
+  /**
+   * Enable/disable recording of pipeline events on this process.
+   */
+  void SetEnabled(bool enabled);
+  bool GetEnabled();
+  ///@}
+
+  /**
+   * Fast check used by the executive to decide whether to record events.
+   */
+  static bool IsEnabled();
+
+  ///@{
+  /**
+   * Enable/disable recording of the change in resident memory of each pass.
+   * Default is false.
+   */
+  void SetRecordMemory(bool record);
+  bool GetRecordMemory();
+  static bool IsMemoryRecorded();
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of events kept on this process. Older events
+   * are discarded first. Default is 10000.
+   */
+  void SetCapacity(int capacity);
+  int GetCapacity();
+  ///@}
+
+  /**
+   * Discard all recorded events.
+   */
+  void Clear();
+
+  /**
+   * Record an event. Does nothing when profiling is disabled.
+   */
+  static void Record(Event&& event);
+
+  /**
+   * Returns the recorded events, oldest first.
+   */
+  static std::vector<Event> GetEvents();
+
+  /**
+   * Returns the resident memory of the process, in KiB. This uses a single
+   * system call where available, 0 if it is unknown.
+   */
+  static vtkTypeInt64 GetProcessMemoryUsed();
+
+  /**
+   * Serialize events in the Chrome trace event format that can be loaded in
+   * chrome://tracing or Perfetto. Each rank is shown as a separate process.
+   */
+  static std::string ToChromeTrace(const std::vector<Event>& events);
+
+protected:
+  vtkPVPipelineProfiler();
+  ~vtkPVPipelineProfiler() override;
+
+private:
+  vtkPVPipelineProfiler(const vtkPVPipelineProfiler&) = delete;
+  void operator=(const vtkPVPipelineProfiler&) = delete;
+};
+
+#endif
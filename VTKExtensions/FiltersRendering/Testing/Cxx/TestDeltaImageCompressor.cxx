@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDeltaImageCompressor.h"
+#include "vtkNew.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstring>
+#include <iostream>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+// Fills a RGBA image with a gradient and a square at (x, y).
+void MakeFrame(vtkUnsignedCharArray* image, int width, int height, int x, int y)
+{
+  image->SetNumberOfComponents(4);
+  image->SetNumberOfTuples(width * height);
+  unsigned char* ptr = image->GetPointer(0);
+  for (int j = 0; j < height; ++j)
+  {
+    for (int i = 0; i < width; ++i, ptr += 4)
+    {
+      const bool inside = (i >= x && i < x + 20 && j >= y && j < y + 20);
+      ptr[0] = inside ? 255 : static_cast<unsigned char>(i);
+      ptr[1] = inside ? 0 : static_cast<unsigned char>(j);
+      ptr[2] = static_cast<unsigned char>(i + j);
+      ptr[3] = 255;
+    }
+  }
+}
+
+// Clears the low bits of each channel of `image` the way the lossy mode does
+// for quality 5.
+void MaskFrame(vtkUnsignedCharArray* image)
+{
+  const unsigned char mask[4] = { 0xE0, 0xF0, 0xE0, 0xE0 };
+  unsigned char* ptr = image->GetPointer(0);
+  for (vtkIdType cc = 0; cc < image->GetNumberOfValues(); ++cc)
+  {
+    ptr[cc] &= mask[cc % 4];
+  }
+}
+
+// Compresses `frame` with `encoder`, then decompresses it with `decoder` and
+// checks that the result matches when `expectMatch` is true. The decoded
+// image is returned in `decompressed` when provided.
+bool RoundTrip(vtkDeltaImageCompressor* encoder, vtkDeltaImageCompressor* decoder,
+  vtkUnsignedCharArray* frame, int width, int height, bool expectMatch, vtkIdType& compressedSize,
+  vtkUnsignedCharArray* decompressed = nullptr)
+{
+  vtkNew<vtkUnsignedCharArray> compressed;
+  encoder->SetImageResolution(width, height);
+  encoder->SetInput(frame);
+  encoder->SetOutput(compressed);
+  if (!encoder->Compress())
+  {
+    std::cerr << "Compress failed." << std::endl;
+    return false;
+  }
+  compressedSize = compressed->GetNumberOfTuples();
+
+  vtkNew<vtkUnsignedCharArray> localDecompressed;
+  if (!decompressed)
+  {
+    decompressed = localDecompressed;
+  }
+  decompressed->SetNumberOfComponents(4);
+  decompressed->SetNumberOfTuples(width * height);
+  decoder->SetImageResolution(width, height);
+  decoder->SetInput(compressed);
+  decoder->SetOutput(decompressed);
+  if (!decoder->Decompress())
+  {
+    std::cerr << "Decompress failed." << std::endl;
+    return false;
+  }
+
+  const bool match = memcmp(frame->GetPointer(0), decompressed->GetPointer(0),
+                       static_cast<size_t>(width) * height * 4) == 0;
+  if (match != expectMatch)
+  {
+    std::cerr << "Decompressed image " << (match ? "matches" : "does not match")
+              << " the input." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+extern int TestDeltaImageCompressor(int, char*[])
+{
+  const int width = 256;
+  const int height = 256;
+  vtkNew<vtkDeltaImageCompressor> encoder;
+  vtkNew<vtkDeltaImageCompressor> decoder;
+  encoder->SetLossLessMode(1);
+  decoder->SetLossLessMode(1);
+
+  vtkNew<vtkUnsignedCharArray> frame;
+  vtkIdType keyFrameSize = 0;
+  vtkIdType deltaSize = 0;
+
+  // First frame is always a keyframe.
+  MakeFrame(frame, width, height, 10, 10);
+  if (!RoundTrip(encoder, decoder, frame, width, height, true, keyFrameSize) ||
+    !encoder->GetLastFrameIsKeyFrame())
+  {
+    std::cerr << "First frame must be a keyframe." << std::endl;
+    return TEST_FAILED;
+  }
+
+  // Moving the square only touches a few tiles.
+  MakeFrame(frame, width, height, 12, 10);
+  if (!RoundTrip(encoder, decoder, frame, width, height, true, deltaSize) ||
+    encoder->GetLastFrameIsKeyFrame() || decoder->GetLastNumberOfDirtyTiles() != 1)
+  {
+    std::cerr << "Expected a delta frame with a single dirty tile, got "
+              << decoder->GetLastNumberOfDirtyTiles() << "." << std::endl;
+    return TEST_FAILED;
+  }
+  std::cout << "Keyframe size: " << keyFrameSize << ", delta frame size: " << deltaSize
+            << std::endl;
+  if (deltaSize * 4 > keyFrameSize)
+  {
+    std::cerr << "Delta frame is not much smaller than the keyframe." << std::endl;
+    return TEST_FAILED;
+  }
+
+  // An unchanged frame has no dirty tiles.
+  if (!RoundTrip(encoder, decoder, frame, width, height, true, deltaSize) ||
+    decoder->GetLastNumberOfDirtyTiles() != 0)
+  {
+    std::cerr << "Expected no dirty tiles." << std::endl;
+    return TEST_FAILED;
+  }
+
+  // A frame missed by the decoder: the next delta cannot be decoded.
+  vtkNew<vtkDeltaImageCompressor> otherDecoder;
+  MakeFrame(frame, width, height, 40, 40);
+  if (!RoundTrip(encoder, otherDecoder, frame, width, height, false, deltaSize))
+  {
+    return TEST_FAILED;
+  }
+  MakeFrame(frame, width, height, 42, 40);
+  if (!RoundTrip(encoder, decoder, frame, width, height, false, deltaSize) ||
+    !decoder->GetKeyFrameNeeded())
+  {
+    std::cerr << "Decoder should have detected it is out of sync." << std::endl;
+    return TEST_FAILED;
+  }
+
+  // Requesting a keyframe brings both ends back in sync.
+  encoder->RequestKeyFrame();
+  if (!RoundTrip(encoder, decoder, frame, width, height, true, deltaSize) ||
+    !encoder->GetLastFrameIsKeyFrame() || decoder->GetKeyFrameNeeded())
+  {
+    std::cerr << "Keyframe did not resynchronize the decoder." << std::endl;
+    return TEST_FAILED;
+  }
+
+  // Changing the image size forces a keyframe.
+  MakeFrame(frame, width / 2, height / 2, 10, 10);
+  if (!RoundTrip(encoder, decoder, frame, width / 2, height / 2, true, deltaSize) ||
+    !encoder->GetLastFrameIsKeyFrame())
+  {
+    std::cerr << "Resizing must send a keyframe." << std::endl;
+    return TEST_FAILED;
+  }
+
+  // Lossy mode: the decoder must still get exactly what the encoder kept,
+  // that is the masked frame, for keyframes and deltas alike.
+  encoder->SetLossLessMode(0);
+  encoder->SetQuality(5);
+  vtkNew<vtkUnsignedCharArray> decoded;
+  vtkNew<vtkUnsignedCharArray> expected;
+  for (int cc = 0; cc < 5; ++cc)
+  {
+    MakeFrame(frame, width / 2, height / 2, 10 + cc, 10);
+    if (!RoundTrip(encoder, decoder, frame, width / 2, height / 2, false, deltaSize, decoded) ||
+      decoder->GetKeyFrameNeeded())
+    {
+      return TEST_FAILED;
+    }
+    expected->DeepCopy(frame);
+    MaskFrame(expected);
+    if (memcmp(expected->GetPointer(0), decoded->GetPointer(0),
+          static_cast<size_t>(width / 2) * (height / 2) * 4) != 0)
+    {
+      std::cerr << "Lossy frame " << cc << " does not match the masked input." << std::endl;
+      return TEST_FAILED;
+    }
+  }
+  return TEST_SUCCESS;
+}
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkImageCompressor.h"
+#include "vtkLZ4Compressor.h"
+#include "vtkNew.h"
+#include "vtkSquirtCompressor.h"
+#include "vtkTimerLog.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+// Fills an image with bands of constant color and some noise, similar to a
+// rendered image with a background and a few objects.
+void MakeImage(vtkUnsignedCharArray* image, int width, int height, int numComps)
+{
+  image->SetNumberOfComponents(numComps);
+  image->SetNumberOfTuples(static_cast<vtkIdType>(width) * height);
+  unsigned char* ptr = image->GetPointer(0);
+  unsigned int seed = 12345;
+  for (int j = 0; j < height; ++j)
+  {
+    for (int i = 0; i < width; ++i, ptr += numComps)
+    {
+      const bool object = ((i / 64 + j / 64) % 3) == 0;
+      seed = seed * 1103515245 + 12345;
+      const unsigned char noise = object ? static_cast<unsigned char>(seed >> 24) : 0;
+      ptr[0] = static_cast<unsigned char>(object ? 200 + (noise & 0x1f) : 30);
+      ptr[1] = static_cast<unsigned char>(object ? i : 30);
+      ptr[2] = static_cast<unsigned char>(object ? j : 60);
+      if (numComps == 4)
+      {
+        ptr[3] = 255;
+      }
+    }
+  }
+}
+
+// Compresses and decompresses `input` with `compressor`, checks the round trip
+// is loss-less and prints the timings.
+bool DoTest(const char* name, vtkImageCompressor* compressor, vtkUnsignedCharArray* input,
+  int numStrips)
+{
+  compressor->SetLossLessMode(1);
+  compressor->SetNumberOfStrips(numStrips);
+
+  vtkNew<vtkUnsignedCharArray> compressed;
+  vtkNew<vtkUnsignedCharArray> decompressed;
+  decompressed->SetNumberOfComponents(input->GetNumberOfComponents());
+  decompressed->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  compressor->SetInput(input);
+  compressor->SetOutput(compressed);
+  if (!compressor->Compress())
+  {
+    std::cerr << name << ": compress failed." << std::endl;
+    return false;
+  }
+  timer->StopTimer();
+  const double compressTime = timer->GetElapsedTime();
+
+  timer->StartTimer();
+  compressor->SetInput(compressed);
+  compressor->SetOutput(decompressed);
+  if (!compressor->Decompress())
+  {
+    std::cerr << name << ": decompress failed." << std::endl;
+    return false;
+  }
+  timer->StopTimer();
+  const double decompressTime = timer->GetElapsedTime();
+
+  std::cout << name << " (" << input->GetNumberOfTuples() << " pixels, "
+            << input->GetNumberOfComponents() << " components, "
+            << (numStrips == 0 ? std::string("auto") : std::to_string(numStrips))
+            << " strips): compressed size " << compressed->GetNumberOfTuples() << ", compress "
+            << compressTime << " s, decompress " << decompressTime << " s" << std::endl;
+
+  if (memcmp(input->GetPointer(0), decompressed->GetPointer(0),
+        static_cast<size_t>(input->GetNumberOfTuples()) * input->GetNumberOfComponents()) != 0)
+  {
+    std::cerr << name << ": decompressed image does not match the input." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+extern int TestImageCompressorStrips(int, char*[])
+{
+  const int sizes[][2] = { { 1920, 1080 }, { 3840, 2160 } };
+  vtkNew<vtkLZ4Compressor> lz4;
+  vtkNew<vtkSquirtCompressor> squirt;
+  vtkNew<vtkUnsignedCharArray> image;
+
+  bool success = true;
+  for (const auto& size : sizes)
+  {
+    for (int numComps = 3; numComps <= 4; ++numComps)
+    {
+      MakeImage(image, size[0], size[1], numComps);
+      for (int numStrips : { 1, 0 })
+      {
+        success &= DoTest("LZ4", lz4, image, numStrips);
+        success &= DoTest("Squirt", squirt, image, numStrips);
+      }
+    }
+  }
+
+  // An explicit number of strips on a smaller image.
+  MakeImage(image, 640, 480, 4);
+  success &= DoTest("LZ4", lz4, image, 4);
+  success &= DoTest("Squirt", squirt, image, 4);
+
+  return success ? TEST_SUCCESS : TEST_FAILED;
+}
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkMPIMoveData.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include "vtk_zlib.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+// Exposes the marshalling of vtkMPIMoveData, without any communication.
+class vtkTestMPIMoveData : public vtkMPIMoveData
+{
+public:
+  static vtkTestMPIMoveData* New();
+  vtkTypeMacro(vtkTestMPIMoveData, vtkMPIMoveData);
+
+  // Returns the buffer that would be sent for `data`.
+  std::vector<char> Marshal(vtkDataObject* data)
+  {
+    this->ClearBuffer();
+    this->MarshalDataToBuffer(data);
+    std::vector<char> buffer(this->Buffers, this->Buffers + this->BufferTotalLength);
+    this->ClearBuffer();
+    return buffer;
+  }
+
+  // Reconstructs `data` from a received buffer.
+  void Unmarshal(const std::vector<char>& buffer, vtkDataObject* data)
+  {
+    this->ClearBuffer();
+    this->NumberOfBuffers = 1;
+    this->BufferTotalLength = static_cast<vtkIdType>(buffer.size());
+    this->BufferLengths = new vtkIdType[1];
+    this->BufferLengths[0] = this->BufferTotalLength;
+    this->BufferOffsets = new vtkIdType[1];
+    this->BufferOffsets[0] = 0;
+    this->Buffers = new char[buffer.size()];
+    memcpy(this->Buffers, buffer.data(), buffer.size());
+    this->ReconstructDataFromBuffer(data);
+    this->ClearBuffer();
+  }
+
+protected:
+  vtkTestMPIMoveData() = default;
+  ~vtkTestMPIMoveData() override = default;
+
+private:
+  vtkTestMPIMoveData(const vtkTestMPIMoveData&) = delete;
+  void operator=(const vtkTestMPIMoveData&) = delete;
+};
+vtkStandardNewMacro(vtkTestMPIMoveData);
+
+vtkTypeUInt64 ReadLittleEndian(const char* src, int numBytes)
+{
+  vtkTypeUInt64 value = 0;
+  for (int cc = 0; cc < numBytes; ++cc)
+  {
+    value = value | (static_cast<vtkTypeUInt64>(static_cast<unsigned char>(src[cc])) << (8 * cc));
+  }
+  return value;
+}
+
+bool Check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << what << std::endl;
+  }
+  return condition;
+}
+
+// Reconstructs the data from `buffer` and checks it marshals back to the
+// uncompressed buffer `expected`.
+bool CheckRoundTrip(vtkTestMPIMoveData* moveData, const std::vector<char>& buffer,
+  const std::vector<char>& expected, const char* what)
+{
+  vtkNew<vtkPolyData> output;
+  moveData->Unmarshal(buffer, output);
+  const int codec = vtkMPIMoveData::GetCompressionCodec();
+  vtkMPIMoveData::SetCompressionCodec(vtkMPIMoveData::NO_COMPRESSION);
+  const bool same = moveData->Marshal(output) == expected;
+  vtkMPIMoveData::SetCompressionCodec(codec);
+  if (!same)
+  {
+    std::cerr << "ERROR: data changed by the round trip with " << what << std::endl;
+  }
+  return same;
+}
+}
+
+extern int TestMPIMoveDataCompression(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(200);
+  sphere->SetPhiResolution(200);
+  sphere->Update();
+
+  vtkNew<vtkTestMPIMoveData> moveData;
+  vtkMPIMoveData::SetCompressionCodec(vtkMPIMoveData::NO_COMPRESSION);
+  const std::vector<char> raw = moveData->Marshal(sphere->GetOutput());
+  const vtkIdType rawLength = static_cast<vtkIdType>(raw.size());
+  if (!Check(rawLength > 4 * (1 << 16), "data is too small to be split in chunks") ||
+    !CheckRoundTrip(moveData, raw, raw, "no compression"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Many chunks with a shorter last one, one chunk of exactly the data
+  // length, two chunks with a last one of a single byte and one chunk
+  // larger than the data.
+  const vtkIdType chunkSizes[] = { 1 << 16, rawLength, rawLength - 1, 2 * rawLength };
+  for (int codec : { vtkMPIMoveData::LZ4, vtkMPIMoveData::ZLIB })
+  {
+    for (vtkIdType chunkSize : chunkSizes)
+    {
+      vtkMPIMoveData::SetCompressionCodec(codec);
+      vtkMPIMoveData::SetCompressionChunkSize(chunkSize);
+      const std::vector<char> compressed = moveData->Marshal(sphere->GetOutput());
+      const vtkIdType numChunks = (rawLength + chunkSize - 1) / chunkSize;
+      if (!Check(compressed.size() > 20 && memcmp(compressed.data(), "pvmc", 4) == 0,
+            "missing compressed buffer header") ||
+        !Check(ReadLittleEndian(compressed.data() + 4, 4) == static_cast<vtkTypeUInt64>(codec),
+          "wrong codec in the header") ||
+        !Check(ReadLittleEndian(compressed.data() + 8, 4) == static_cast<vtkTypeUInt64>(numChunks),
+          "wrong number of chunks in the header") ||
+        !Check(ReadLittleEndian(compressed.data() + 12, 8) == static_cast<vtkTypeUInt64>(rawLength),
+          "wrong uncompressed length in the header") ||
+        !CheckRoundTrip(moveData, compressed, raw, codec == vtkMPIMoveData::LZ4 ? "LZ4" : "zlib"))
+      {
+        std::cerr << "with a chunk size of " << chunkSize << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Buffers of older versions: a "zlib" tag, the uncompressed length on 4
+  // bytes and a single zlib stream.
+  uLongf zlibLength = compressBound(static_cast<uLong>(rawLength));
+  std::vector<char> legacy(8 + zlibLength);
+  memcpy(legacy.data(), "zlib", 4);
+  for (int cc = 0; cc < 4; ++cc)
+  {
+    legacy[4 + cc] = static_cast<char>((rawLength >> (8 * cc)) & 0xff);
+  }
+  if (!Check(compress2(reinterpret_cast<Bytef*>(legacy.data() + 8), &zlibLength,
+               reinterpret_cast<const Bytef*>(raw.data()), static_cast<uLong>(rawLength),
+               6) == Z_OK,
+        "failed to compress the legacy buffer"))
+  {
+    return EXIT_FAILURE;
+  }
+  legacy.resize(8 + zlibLength);
+  if (!CheckRoundTrip(moveData, legacy, raw, "legacy zlib"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkMPIMoveData::SetCompressionCodec(vtkMPIMoveData::NO_COMPRESSION);
+  vtkMPIMoveData::SetCompressionChunkSize(1 << 20);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkNew.h"
+#include "vtkPVQuadricClustering.h"
+#include "vtkPolyData.h"
+#include "vtkQuadricClustering.h"
+#include "vtkSphereSource.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool Check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << what << std::endl;
+  }
+  return condition;
+}
+
+// Returns true if `value` is within `tolerance` (relative) of `expected`.
+bool IsClose(vtkIdType value, vtkIdType expected, double tolerance)
+{
+  std::cout << "  " << value << " (expected " << expected << ")" << std::endl;
+  return std::abs(static_cast<double>(value - expected)) <= tolerance * expected;
+}
+}
+
+extern int TestPVQuadricClustering(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(200);
+  sphere->SetPhiResolution(200);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  // The divisions used by vtkGeometryRepresentation for LOD factors 0, 0.5 and 1.
+  for (int divisions : { 10, 85, 160 })
+  {
+    vtkNew<vtkPVQuadricClustering> decimator;
+    decimator->SetNumberOfDivisions(divisions, divisions, divisions);
+    decimator->SetUseInputPoints(1);
+    decimator->SetCopyCellData(1);
+    decimator->SetUseInternalTriangles(0);
+    decimator->SetInputData(input);
+    decimator->Update();
+    vtkPolyData* output = vtkPolyData::SafeDownCast(decimator->GetOutputDataObject(0));
+
+    // Reference: vtkQuadricClustering with the same settings.
+    vtkNew<vtkQuadricClustering> reference;
+    reference->SetNumberOfDivisions(decimator->GetNumberOfDivisions());
+    reference->SetAutoAdjustNumberOfDivisions(decimator->GetAutoAdjustNumberOfDivisions());
+    reference->SetUseInputPoints(decimator->GetUseInputPoints());
+    reference->SetCopyCellData(decimator->GetCopyCellData());
+    reference->SetUseInternalTriangles(decimator->GetUseInternalTriangles());
+    reference->SetInputData(input);
+    reference->Update();
+    vtkPolyData* expected = reference->GetOutput();
+
+    std::cout << divisions << " divisions:" << std::endl;
+    if (!Check(output && output->GetNumberOfPolys() > 0, "decimation produced no polygons") ||
+      !Check(output->GetNumberOfPoints() < input->GetNumberOfPoints(), "nothing was decimated"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Both use the same bins and the same representative point selection but
+    // sum quadrics in a different order, so a few bins may pick a different
+    // input point.
+    if (!Check(IsClose(output->GetNumberOfPoints(), expected->GetNumberOfPoints(), 0.01),
+          "number of points differs from vtkQuadricClustering") ||
+      !Check(IsClose(output->GetNumberOfCells(), expected->GetNumberOfCells(), 0.02),
+        "number of cells differs from vtkQuadricClustering"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    double bounds[6], expectedBounds[6], inputBounds[6];
+    output->GetBounds(bounds);
+    expected->GetBounds(expectedBounds);
+    input->GetBounds(inputBounds);
+    int divs[3];
+    decimator->GetNumberOfDivisions(divs);
+    for (int i = 0; i < 6; ++i)
+    {
+      const int axis = i / 2;
+      const double binSize = (inputBounds[2 * axis + 1] - inputBounds[2 * axis]) / divs[axis];
+      if (!Check(std::abs(bounds[i] - expectedBounds[i]) <= binSize,
+            "bounds differ from vtkQuadricClustering by more than a bin"))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
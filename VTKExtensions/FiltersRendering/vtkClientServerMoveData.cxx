@@ -4,6 +4,7 @@
 #include "vtkClientServerMoveData.h"
 
 #include "vtkCharArray.h"
+#include "vtkCommunicator.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectTypes.h"
 #include "vtkGenericDataObjectReader.h"
@@ -12,6 +13,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVSession.h"
 #include "vtkPolyData.h"
@@ -19,6 +21,7 @@
 #include "vtkSelection.h"
 #include "vtkSelectionSerializer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTCPNetworkAccessManager.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <sstream>
@@ -227,6 +230,25 @@ int vtkClientServerMoveData::SendData(vtkDataObject* input, vtkMultiProcessContr
     }
   }
 
+  if (vtkTCPNetworkAccessManager::GetNumberOfDataSockets(controller) > 0)
+  {
+    // Marshal here so that the bulk bytes can be striped across the data
+    // sockets instead of occupying the main connection.
+    vtkNew<vtkCharArray> buffer;
+    vtkIdType length = 0;
+    if (input && vtkCommunicator::MarshalDataObject(input, buffer))
+    {
+      length = buffer->GetNumberOfValues();
+    }
+    if (!controller->Send(&length, 1, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT))
+    {
+      return 0;
+    }
+    return length == 0 ||
+      vtkTCPNetworkAccessManager::SendBulkData(controller, buffer->GetPointer(0), length,
+        vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+  }
+
   return controller->Send(input, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
 }
 
@@ -254,6 +276,29 @@ vtkDataObject* vtkClientServerMoveData::ReceiveData(vtkMultiProcessController* c
     delete[] xml;
     data = sel;
   }
+  else if (vtkTCPNetworkAccessManager::GetNumberOfDataSockets(controller) > 0)
+  {
+    vtkIdType length = 0;
+    controller->Receive(&length, 1, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    if (length <= 0)
+    {
+      return nullptr;
+    }
+    vtkNew<vtkCharArray> buffer;
+    buffer->SetNumberOfValues(length);
+    if (!vtkTCPNetworkAccessManager::ReceiveBulkData(controller, buffer->GetPointer(0), length,
+          vtkClientServerMoveData::TRANSMIT_DATA_OBJECT))
+    {
+      vtkErrorMacro("Failed to receive data object from the server.");
+      return nullptr;
+    }
+    vtkSmartPointer<vtkDataObject> received = vtkCommunicator::UnMarshalDataObject(buffer);
+    if (received)
+    {
+      received->Register(nullptr);
+      data = received;
+    }
+  }
   else
   {
     data = controller->ReceiveDataObject(1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
@@ -0,0 +1,428 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDeltaImageCompressor.h"
+
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkUnsignedCharArray.h"
+
+#include "vtk_lz4.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+const vtkTypeUInt32 DeltaMagic = 0x49445650; // "PVDI"
+const vtkTypeUInt32 KeyFrameFlag = 0x1;
+
+// Header written at the start of each compressed frame. For delta frames it
+// is followed by a bitmap of the dirty tiles, then by the LZ4 payload.
+struct FrameHeader
+{
+  vtkTypeUInt32 Magic;
+  vtkTypeUInt32 Flags;
+  vtkTypeUInt32 FrameId;
+  vtkTypeUInt32 BaseFrameId;
+  vtkTypeUInt32 Width;
+  vtkTypeUInt32 Height;
+  vtkTypeUInt32 NumberOfComponents;
+  vtkTypeUInt32 TileSize;
+  vtkTypeUInt32 PayloadSize;
+  vtkTypeUInt32 CompressedPayloadSize;
+};
+
+// Calls `functor(offset, length)` for each row of the tile, where offset and
+// length are in bytes.
+template <typename Functor>
+void ForEachTileRow(int tx, int ty, int tileSize, int width, int height, int numComps,
+  Functor&& functor)
+{
+  const int x0 = tx * tileSize;
+  const int y0 = ty * tileSize;
+  const int x1 = std::min(x0 + tileSize, width);
+  const int y1 = std::min(y0 + tileSize, height);
+  const size_t length = static_cast<size_t>(x1 - x0) * numComps;
+  for (int y = y0; y < y1; ++y)
+  {
+    functor((static_cast<size_t>(y) * width + x0) * numComps, length);
+  }
+}
+}
+
+vtkStandardNewMacro(vtkDeltaImageCompressor);
+//----------------------------------------------------------------------------
+vtkDeltaImageCompressor::vtkDeltaImageCompressor()
+  : Quality(3)
+  , TileSize(32)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkDeltaImageCompressor::~vtkDeltaImageCompressor() = default;
+
+//----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::SetImageResolution(int width, int height)
+{
+  this->ImageWidth = width;
+  this->ImageHeight = height;
+}
+
+//----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::RequestKeyFrame()
+{
+  this->KeyFrameRequested = true;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaImageCompressor::Compress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  vtkUnsignedCharArray* input = this->Input;
+  const int numComps = input->GetNumberOfComponents();
+  const vtkIdType numPixels = input->GetNumberOfTuples();
+  int width = this->ImageWidth;
+  int height = this->ImageHeight;
+  if (static_cast<vtkIdType>(width) * height != numPixels)
+  {
+    // resolution was not provided, treat the image as a single row.
+    width = static_cast<int>(numPixels);
+    height = 1;
+  }
+
+  // Apply the same color masks as vtkLZ4Compressor. The frame kept for the
+  // next delta must be the masked one since that is what the other end gets.
+  unsigned char compress_masks[6][4] = { { 0xFF, 0xFF, 0xFF, 0xFF }, { 0xFE, 0xFF, 0xFE, 0xFE },
+    { 0xFC, 0xFE, 0xFC, 0xFC }, { 0xF8, 0xFC, 0xF8, 0xF8 }, { 0xF0, 0xF8, 0xF0, 0xF0 },
+    { 0xE0, 0xF0, 0xE0, 0xE0 } };
+  const int compress_level = this->LossLessMode ? 0 : this->Quality;
+  if (compress_level > 0 && numComps == 4)
+  {
+    unsigned int compress_mask;
+    memcpy(&compress_mask, &compress_masks[compress_level], 4);
+    this->TemporaryBuffer->SetNumberOfComponents(numComps);
+    this->TemporaryBuffer->SetNumberOfTuples(numPixels);
+    const unsigned int* in = reinterpret_cast<const unsigned int*>(input->GetPointer(0));
+    unsigned int* out = reinterpret_cast<unsigned int*>(this->TemporaryBuffer->GetPointer(0));
+    for (vtkIdType cc = 0; cc < numPixels; ++cc)
+    {
+      out[cc] = in[cc] & compress_mask;
+    }
+    input = this->TemporaryBuffer.Get();
+  }
+  const unsigned char* current = input->GetPointer(0);
+  const size_t imageSize = static_cast<size_t>(numPixels) * numComps;
+
+  const int tileSize = this->TileSize;
+  const int numTilesX = (width + tileSize - 1) / tileSize;
+  const int numTilesY = (height + tileSize - 1) / tileSize;
+  const int numTiles = numTilesX * numTilesY;
+
+  bool keyFrame = this->KeyFrameRequested || this->EncoderFrameId == 0 ||
+    this->EncoderWidth != width || this->EncoderHeight != height ||
+    this->EncoderFrame->GetNumberOfComponents() != numComps;
+
+  // Collect the dirty tiles, XOR-ed with the previous frame.
+  std::vector<unsigned char> bitmap;
+  int numDirtyTiles = 0;
+  if (!keyFrame)
+  {
+    bitmap.assign((numTiles + 7) / 8, 0);
+    this->Payload->SetNumberOfTuples(0);
+    const unsigned char* previous = this->EncoderFrame->GetPointer(0);
+    for (int ty = 0, tile = 0; ty < numTilesY; ++ty)
+    {
+      for (int tx = 0; tx < numTilesX; ++tx, ++tile)
+      {
+        bool dirty = false;
+        ForEachTileRow(tx, ty, tileSize, width, height, numComps,
+          [&](size_t offset, size_t length)
+          { dirty = dirty || memcmp(current + offset, previous + offset, length) != 0; });
+        if (!dirty)
+        {
+          continue;
+        }
+
+        bitmap[tile / 8] |= static_cast<unsigned char>(1 << (tile % 8));
+        ++numDirtyTiles;
+        ForEachTileRow(tx, ty, tileSize, width, height, numComps,
+          [&](size_t offset, size_t length)
+          {
+            const vtkIdType start = this->Payload->GetNumberOfTuples();
+            unsigned char* out = this->Payload->WritePointer(start, static_cast<vtkIdType>(length));
+            for (size_t cc = 0; cc < length; ++cc)
+            {
+              out[cc] = current[offset + cc] ^ previous[offset + cc];
+            }
+          });
+      }
+    }
+
+    // when most of the image changed, a keyframe is as small and does not
+    // depend on the previous frame.
+    keyFrame = numDirtyTiles * 4 > numTiles * 3;
+  }
+
+  const unsigned char* payload = keyFrame ? current : this->Payload->GetPointer(0);
+  const size_t payloadSize =
+    keyFrame ? imageSize : static_cast<size_t>(this->Payload->GetNumberOfTuples());
+  const size_t bitmapSize = keyFrame ? 0 : bitmap.size();
+
+  FrameHeader header;
+  header.Magic = DeltaMagic;
+  header.Flags = keyFrame ? KeyFrameFlag : 0;
+  header.FrameId = this->EncoderFrameId + 1;
+  header.BaseFrameId = this->EncoderFrameId;
+  header.Width = static_cast<vtkTypeUInt32>(width);
+  header.Height = static_cast<vtkTypeUInt32>(height);
+  header.NumberOfComponents = static_cast<vtkTypeUInt32>(numComps);
+  header.TileSize = static_cast<vtkTypeUInt32>(tileSize);
+  header.PayloadSize = static_cast<vtkTypeUInt32>(payloadSize);
+  header.CompressedPayloadSize = 0;
+
+  const int maxCompressedSize = LZ4_compressBound(static_cast<int>(payloadSize));
+  const vtkIdType maxOutputSize =
+    static_cast<vtkIdType>(sizeof(FrameHeader) + bitmapSize + maxCompressedSize);
+  unsigned char* output = this->Output->WritePointer(0, maxOutputSize);
+  if (payloadSize > 0)
+  {
+    const int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(payload),
+      reinterpret_cast<char*>(output + sizeof(FrameHeader) + bitmapSize),
+      static_cast<int>(payloadSize), maxCompressedSize, 16);
+    if (compressedSize <= 0)
+    {
+      vtkErrorMacro("LZ4 compression failed.");
+      return VTK_ERROR;
+    }
+    header.CompressedPayloadSize = static_cast<vtkTypeUInt32>(compressedSize);
+  }
+  memcpy(output, &header, sizeof(FrameHeader));
+  if (bitmapSize > 0)
+  {
+    memcpy(output + sizeof(FrameHeader), bitmap.data(), bitmapSize);
+  }
+  this->Output->SetNumberOfTuples(
+    static_cast<vtkIdType>(sizeof(FrameHeader) + bitmapSize + header.CompressedPayloadSize));
+
+  // Keep what the other end will have for the next frame.
+  this->EncoderFrame->SetNumberOfComponents(numComps);
+  this->EncoderFrame->SetNumberOfTuples(numPixels);
+  memcpy(this->EncoderFrame->GetPointer(0), current, imageSize);
+  this->EncoderWidth = width;
+  this->EncoderHeight = height;
+  this->EncoderFrameId = header.FrameId;
+  this->KeyFrameRequested = false;
+  this->LastFrameIsKeyFrame = keyFrame;
+  this->LastNumberOfDirtyTiles = keyFrame ? numTiles : numDirtyTiles;
+  return VTK_OK;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaImageCompressor::Decompress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  const unsigned char* input = this->Input->GetPointer(0);
+  const size_t inputSize = static_cast<size_t>(this->Input->GetNumberOfTuples()) *
+    this->Input->GetNumberOfComponents();
+  FrameHeader header;
+  if (inputSize >= sizeof(FrameHeader))
+  {
+    memcpy(&header, input, sizeof(FrameHeader));
+  }
+  if (inputSize < sizeof(FrameHeader) || header.Magic != DeltaMagic)
+  {
+    vtkErrorMacro("Input is not a frame compressed by vtkDeltaImageCompressor.");
+    return VTK_ERROR;
+  }
+
+  const int width = static_cast<int>(header.Width);
+  const int height = static_cast<int>(header.Height);
+  const int numComps = static_cast<int>(header.NumberOfComponents);
+  const int tileSize = static_cast<int>(header.TileSize);
+  const size_t imageSize = static_cast<size_t>(width) * height * numComps;
+  const bool keyFrame = (header.Flags & KeyFrameFlag) != 0;
+  const int numTilesX = tileSize > 0 ? (width + tileSize - 1) / tileSize : 0;
+  const int numTilesY = tileSize > 0 ? (height + tileSize - 1) / tileSize : 0;
+  const size_t bitmapSize = keyFrame ? 0 : (static_cast<size_t>(numTilesX) * numTilesY + 7) / 8;
+
+  const size_t outputSize = static_cast<size_t>(this->Output->GetNumberOfTuples()) *
+    this->Output->GetNumberOfComponents();
+  if (outputSize < imageSize || (keyFrame && header.PayloadSize != imageSize) ||
+    (!keyFrame && tileSize <= 0) ||
+    inputSize < sizeof(FrameHeader) + bitmapSize + header.CompressedPayloadSize)
+  {
+    vtkErrorMacro("Invalid or truncated frame.");
+    return VTK_ERROR;
+  }
+  unsigned char* output = this->Output->GetPointer(0);
+  const unsigned char* bitmap = input + sizeof(FrameHeader);
+  const char* compressed = reinterpret_cast<const char*>(bitmap + bitmapSize);
+
+  if (!keyFrame &&
+    (header.BaseFrameId != this->DecoderFrameId || this->DecoderFrameId == 0 ||
+      this->DecoderWidth != width || this->DecoderHeight != height ||
+      this->DecoderFrame->GetNumberOfComponents() != numComps))
+  {
+    // We did not decode the frame this one applies to. Show the last image we
+    // have, if it fits, until the compressing end sends a keyframe.
+    vtkDebugMacro("Delta frame " << header.FrameId << " applies to frame " << header.BaseFrameId
+                                 << " but the last decoded frame is " << this->DecoderFrameId
+                                 << ". Waiting for a keyframe.");
+    this->KeyFrameNeeded = true;
+    if (this->DecoderWidth == width && this->DecoderHeight == height &&
+      this->DecoderFrame->GetNumberOfComponents() == numComps)
+    {
+      memcpy(output, this->DecoderFrame->GetPointer(0), imageSize);
+    }
+    else
+    {
+      memset(output, 0, imageSize);
+    }
+    this->LastFrameIsKeyFrame = false;
+    this->LastNumberOfDirtyTiles = 0;
+    return VTK_OK;
+  }
+
+  if (keyFrame)
+  {
+    if (LZ4_decompress_safe(compressed, reinterpret_cast<char*>(output),
+          static_cast<int>(header.CompressedPayloadSize),
+          static_cast<int>(imageSize)) != static_cast<int>(imageSize))
+    {
+      vtkErrorMacro("LZ4 decompression failed.");
+      return VTK_ERROR;
+    }
+    this->LastNumberOfDirtyTiles = numTilesX * numTilesY;
+  }
+  else
+  {
+    this->Payload->SetNumberOfComponents(1);
+    this->Payload->SetNumberOfTuples(static_cast<vtkIdType>(header.PayloadSize));
+    unsigned char* payload = this->Payload->GetPointer(0);
+    if (header.PayloadSize > 0 &&
+      LZ4_decompress_safe(compressed, reinterpret_cast<char*>(payload),
+        static_cast<int>(header.CompressedPayloadSize),
+        static_cast<int>(header.PayloadSize)) != static_cast<int>(header.PayloadSize))
+    {
+      vtkErrorMacro("LZ4 decompression failed.");
+      return VTK_ERROR;
+    }
+
+    // Apply the dirty tiles over the previous frame.
+    memcpy(output, this->DecoderFrame->GetPointer(0), imageSize);
+    size_t position = 0;
+    int numDirtyTiles = 0;
+    for (int ty = 0, tile = 0; ty < numTilesY; ++ty)
+    {
+      for (int tx = 0; tx < numTilesX; ++tx, ++tile)
+      {
+        if ((bitmap[tile / 8] & (1 << (tile % 8))) == 0)
+        {
+          continue;
+        }
+        ++numDirtyTiles;
+        bool overflow = false;
+        ForEachTileRow(tx, ty, tileSize, width, height, numComps,
+          [&](size_t offset, size_t length)
+          {
+            if (overflow || position + length > header.PayloadSize)
+            {
+              overflow = true;
+              return;
+            }
+            for (size_t cc = 0; cc < length; ++cc)
+            {
+              output[offset + cc] ^= payload[position + cc];
+            }
+            position += length;
+          });
+        if (overflow)
+        {
+          vtkErrorMacro("Delta frame payload is truncated.");
+          this->KeyFrameNeeded = true;
+          return VTK_ERROR;
+        }
+      }
+    }
+    this->LastNumberOfDirtyTiles = numDirtyTiles;
+  }
+
+  this->DecoderFrame->SetNumberOfComponents(numComps);
+  this->DecoderFrame->SetNumberOfTuples(static_cast<vtkIdType>(width) * height);
+  memcpy(this->DecoderFrame->GetPointer(0), output, imageSize);
+  this->DecoderWidth = width;
+  this->DecoderHeight = height;
+  this->DecoderFrameId = header.FrameId;
+  this->LastFrameIsKeyFrame = keyFrame;
+  if (keyFrame)
+  {
+    this->KeyFrameNeeded = false;
+  }
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
+{
+  this->Superclass::SaveConfiguration(stream);
+  *stream << this->Quality;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkDeltaImageCompressor::RestoreConfiguration(vtkMultiProcessStream* stream)
+{
+  if (this->Superclass::RestoreConfiguration(stream))
+  {
+    int quality;
+    *stream >> quality;
+    this->SetQuality(quality);
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkDeltaImageCompressor::SaveConfiguration()
+{
+  std::ostringstream oss;
+  oss << this->Superclass::SaveConfiguration() << " " << this->Quality;
+  this->SetConfiguration(oss.str().c_str());
+  return this->Configuration;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkDeltaImageCompressor::RestoreConfiguration(const char* stream)
+{
+  stream = this->Superclass::RestoreConfiguration(stream);
+  if (stream)
+  {
+    std::istringstream iss(stream);
+    int quality;
+    iss >> quality;
+    this->SetQuality(quality);
+    return stream + iss.tellg();
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Quality: " << this->Quality << endl;
+  os << indent << "TileSize: " << this->TileSize << endl;
+  os << indent << "KeyFrameNeeded: " << this->KeyFrameNeeded << endl;
+  os << indent << "LastFrameIsKeyFrame: " << this->LastFrameIsKeyFrame << endl;
+  os << indent << "LastNumberOfDirtyTiles: " << this->LastNumberOfDirtyTiles << endl;
+}
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkDeltaImageCompressor
+ * @brief   Image compressor/decompressor
+ * that only sends the tiles that changed since the previous frame.
+ *
+ * vtkDeltaImageCompressor keeps the last frame on both ends of the connection.
+ * The image is split in square tiles of TileSize pixels. Tiles that are
+ * identical to the previous frame are skipped, the others are XOR-ed with the
+ * previous frame, which turns unchanged pixels into zeros, and the result is
+ * compressed with LZ4. This greatly reduces the amount of data sent during slow
+ * camera moves or animations where most of the image does not change.
+ *
+ * A full frame (keyframe) is sent instead when there is no previous frame, when
+ * the image size or number of components changes, when most tiles changed, or
+ * when a keyframe was requested with RequestKeyFrame(). Each frame carries its
+ * own id and the id of the frame it applies to, so the decompressor detects when
+ * it is out of sync with the compressor. It then reuses the last decoded image
+ * and sets KeyFrameNeeded, which the caller must forward to the compressor
+ * (vtkPVClientServerSynchronizedRenderers does this on the next render).
+ *
+ * Since each end keeps its own state, an instance must only be used to
+ * compress or to decompress a single sequence of frames. The compressing and
+ * decompressing states are kept separately, so a single instance can still
+ * compress and decompress the same sequence, for testing.
+ */
+
+#ifndef vtkDeltaImageCompressor_h
+#define vtkDeltaImageCompressor_h
+
+#include "vtkImageCompressor.h"
+#include "vtkNew.h"                                   // needed for vtkNew
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for exports
+
+class vtkMultiProcessStream;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkDeltaImageCompressor : public vtkImageCompressor
+{
+public:
+  static vtkDeltaImageCompressor* New();
+  vtkTypeMacro(vtkDeltaImageCompressor, vtkImageCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set the quality measure. The value can be between 0 and 5. 0 means preserve
+   * input image quality while 5 means improve compression at the cost of image
+   * quality. This uses the same color masks as vtkLZ4Compressor and is ignored
+   * in loss-less mode.
+   */
+  vtkSetClampMacro(Quality, int, 0, 5);
+  vtkGetMacro(Quality, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the width and height, in pixels, of the tiles compared with the
+   * previous frame. Only used when compressing; the tile size is sent with
+   * each frame. Default is 32.
+   */
+  vtkSetClampMacro(TileSize, int, 4, 256);
+  vtkGetMacro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Compress/Decompress data array on the objects input with results
+   * in the objects output. See also Set/GetInput/Output.
+   */
+  int Compress() override;
+  int Decompress() override;
+  ///@}
+
+  /**
+   * Communicates the next expected image resolution. This is needed to split
+   * the image in tiles when compressing.
+   */
+  void SetImageResolution(int width, int height) override;
+
+  /**
+   * Force the next compressed frame to be a keyframe.
+   */
+  void RequestKeyFrame();
+
+  /**
+   * Set by Decompress() when a frame could not be decoded because it applies
+   * to a frame this instance did not decode. RequestKeyFrame() must then be
+   * called on the compressing end. Cleared when a keyframe is decoded.
+   */
+  vtkGetMacro(KeyFrameNeeded, bool);
+
+  ///@{
+  /**
+   * Statistics about the last frame compressed or decompressed.
+   */
+  vtkGetMacro(LastFrameIsKeyFrame, bool);
+  vtkGetMacro(LastNumberOfDirtyTiles, int);
+  ///@}
+
+  ///@{
+  /**
+   * Serialize/Restore compressor configuration (but not the data) into the stream.
+   */
+  void SaveConfiguration(vtkMultiProcessStream* stream) override;
+  bool RestoreConfiguration(vtkMultiProcessStream* stream) override;
+  const char* SaveConfiguration() override;
+  const char* RestoreConfiguration(const char* stream) override;
+  ///@}
+
+protected:
+  vtkDeltaImageCompressor();
+  ~vtkDeltaImageCompressor() override;
+
+  int Quality;
+  int TileSize;
+
+private:
+  vtkDeltaImageCompressor(const vtkDeltaImageCompressor&) = delete;
+  void operator=(const vtkDeltaImageCompressor&) = delete;
+
+  int ImageWidth = 0;
+  int ImageHeight = 0;
+  bool KeyFrameRequested = false;
+  bool KeyFrameNeeded = false;
+  bool LastFrameIsKeyFrame = false;
+  int LastNumberOfDirtyTiles = 0;
+
+  // Last frame sent by the compressing end, as seen by the decompressing end.
+  vtkNew<vtkUnsignedCharArray> EncoderFrame;
+  int EncoderWidth = 0;
+  int EncoderHeight = 0;
+  vtkTypeUInt32 EncoderFrameId = 0;
+
+  // Last frame decoded by the decompressing end.
+  vtkNew<vtkUnsignedCharArray> DecoderFrame;
+  int DecoderWidth = 0;
+  int DecoderHeight = 0;
+  vtkTypeUInt32 DecoderFrameId = 0;
+
+  // Used to build the masked input and the dirty tiles.
+  vtkNew<vtkUnsignedCharArray> TemporaryBuffer;
+  vtkNew<vtkUnsignedCharArray> Payload;
+};
+
+#endif
@@ -6,10 +6,47 @@
 
 #include "vtkCommand.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <sstream>
 #include <string>
 
+namespace
+{
+// Strip container layout, all integers being little-endian:
+//   "PVIS" | number of strips (4) | number of components (4)
+//   then for each strip: number of pixels (4) | compressed size (4)
+//   then the compressed strips, in order.
+const char StripContainerMagic[4] = { 'P', 'V', 'I', 'S' };
+const size_t StripContainerHeaderSize = 12;
+const size_t StripHeaderSize = 8;
+
+// Strips smaller than this are not worth compressing on their own.
+const vtkIdType MinimumPixelsPerStrip = 65536;
+
+void WriteUInt32(unsigned char* output, vtkTypeUInt32 value)
+{
+  for (int cc = 0; cc < 4; ++cc)
+  {
+    output[cc] = static_cast<unsigned char>((value >> (8 * cc)) & 0xFF);
+  }
+}
+
+vtkTypeUInt32 ReadUInt32(const unsigned char* input)
+{
+  vtkTypeUInt32 value = 0;
+  for (int cc = 0; cc < 4; ++cc)
+  {
+    value |= static_cast<vtkTypeUInt32>(input[cc]) << (8 * cc);
+  }
+  return value;
+}
+}
+
 //-----------------------------------------------------------------------------
 vtkCxxSetObjectMacro(vtkImageCompressor, Output, vtkUnsignedCharArray);
 
@@ -21,6 +58,7 @@ vtkImageCompressor::vtkImageCompressor()
   : Output(nullptr)
   , Input(nullptr)
   , LossLessMode(0)
+  , NumberOfStrips(0)
   , Configuration(nullptr)
 {
   // Always allocate output array as a convenience.
@@ -40,6 +78,172 @@ vtkImageCompressor::~vtkImageCompressor()
 //-----------------------------------------------------------------------------
 void vtkImageCompressor::SetImageResolution(int, int) {}
 
+//-----------------------------------------------------------------------------
+bool vtkImageCompressor::CompressStrip(
+  const unsigned char*, vtkIdType, int, std::vector<unsigned char>&)
+{
+  vtkErrorMacro("Strips are not supported by " << this->GetClassName() << ".");
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkImageCompressor::DecompressStrip(
+  const unsigned char*, size_t, unsigned char*, vtkIdType, int)
+{
+  vtkErrorMacro("Strips are not supported by " << this->GetClassName() << ".");
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+int vtkImageCompressor::ComputeNumberOfStrips(vtkIdType numPixels)
+{
+  if (this->NumberOfStrips > 0)
+  {
+    return static_cast<int>(std::max<vtkIdType>(
+      1, std::min<vtkIdType>(this->NumberOfStrips, numPixels / MinimumPixelsPerStrip)));
+  }
+  const vtkIdType numThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  return static_cast<int>(
+    std::max<vtkIdType>(1, std::min(numThreads, numPixels / MinimumPixelsPerStrip)));
+}
+
+//-----------------------------------------------------------------------------
+int vtkImageCompressor::CompressStrips(int numStrips)
+{
+  vtkUnsignedCharArray* input = this->Input;
+  const int numComps = input->GetNumberOfComponents();
+  const vtkIdType numPixels = input->GetNumberOfTuples();
+  const unsigned char* inputPtr = input->GetPointer(0);
+  auto stripBegin = [&](vtkIdType strip) { return numPixels * strip / numStrips; };
+
+  std::vector<std::vector<unsigned char>> strips(numStrips);
+  std::atomic<bool> ok(true);
+  vtkSMPTools::For(0, numStrips, 1,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType cc = begin; cc < end && ok; ++cc)
+      {
+        const vtkIdType offset = stripBegin(cc);
+        if (!this->CompressStrip(inputPtr + offset * numComps, stripBegin(cc + 1) - offset,
+              numComps, strips[cc]))
+        {
+          ok = false;
+        }
+      }
+    });
+  if (!ok)
+  {
+    return VTK_ERROR;
+  }
+
+  std::vector<size_t> offsets(numStrips + 1);
+  offsets[0] = StripContainerHeaderSize + numStrips * StripHeaderSize;
+  for (int cc = 0; cc < numStrips; ++cc)
+  {
+    offsets[cc + 1] = offsets[cc] + strips[cc].size();
+  }
+
+  unsigned char* output =
+    this->Output->WritePointer(0, static_cast<vtkIdType>(offsets[numStrips]));
+  memcpy(output, StripContainerMagic, 4);
+  WriteUInt32(output + 4, static_cast<vtkTypeUInt32>(numStrips));
+  WriteUInt32(output + 8, static_cast<vtkTypeUInt32>(numComps));
+  for (int cc = 0; cc < numStrips; ++cc)
+  {
+    unsigned char* stripHeader = output + StripContainerHeaderSize + cc * StripHeaderSize;
+    WriteUInt32(stripHeader, static_cast<vtkTypeUInt32>(stripBegin(cc + 1) - stripBegin(cc)));
+    WriteUInt32(stripHeader + 4, static_cast<vtkTypeUInt32>(strips[cc].size()));
+  }
+  vtkSMPTools::For(0, numStrips, 1,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        std::copy(strips[cc].begin(), strips[cc].end(), output + offsets[cc]);
+      }
+    });
+  this->Output->SetNumberOfComponents(1);
+  this->Output->SetNumberOfTuples(static_cast<vtkIdType>(offsets[numStrips]));
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+int vtkImageCompressor::DecompressStrips()
+{
+  const unsigned char* input = this->Input->GetPointer(0);
+  const int numStrips = static_cast<int>(ReadUInt32(input + 4));
+  const int numComps = static_cast<int>(ReadUInt32(input + 8));
+  if (numComps != this->Output->GetNumberOfComponents())
+  {
+    vtkErrorMacro("Number of components mismatch: " << numComps << " compressed, "
+                                                    << this->Output->GetNumberOfComponents()
+                                                    << " expected.");
+    return VTK_ERROR;
+  }
+
+  // Locate each strip in the input and in the output.
+  std::vector<size_t> inputOffsets(numStrips + 1);
+  std::vector<vtkIdType> outputOffsets(numStrips + 1);
+  inputOffsets[0] = StripContainerHeaderSize + numStrips * StripHeaderSize;
+  outputOffsets[0] = 0;
+  for (int cc = 0; cc < numStrips; ++cc)
+  {
+    const unsigned char* stripHeader = input + StripContainerHeaderSize + cc * StripHeaderSize;
+    outputOffsets[cc + 1] = outputOffsets[cc] + ReadUInt32(stripHeader);
+    inputOffsets[cc + 1] = inputOffsets[cc] + ReadUInt32(stripHeader + 4);
+  }
+  if (outputOffsets[numStrips] != this->Output->GetNumberOfTuples())
+  {
+    vtkErrorMacro("Image size mismatch: " << outputOffsets[numStrips] << " compressed, "
+                                          << this->Output->GetNumberOfTuples() << " expected.");
+    return VTK_ERROR;
+  }
+
+  unsigned char* output = this->Output->GetPointer(0);
+  std::atomic<bool> ok(true);
+  vtkSMPTools::For(0, numStrips, 1,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType cc = begin; cc < end && ok; ++cc)
+      {
+        if (!this->DecompressStrip(input + inputOffsets[cc],
+              inputOffsets[cc + 1] - inputOffsets[cc], output + outputOffsets[cc] * numComps,
+              outputOffsets[cc + 1] - outputOffsets[cc], numComps))
+        {
+          ok = false;
+        }
+      }
+    });
+  return ok ? VTK_OK : VTK_ERROR;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkImageCompressor::IsStripContainer(vtkUnsignedCharArray* data)
+{
+  const size_t size =
+    static_cast<size_t>(data->GetNumberOfTuples()) * data->GetNumberOfComponents();
+  const unsigned char* ptr = data->GetPointer(0);
+  if (size < StripContainerHeaderSize || memcmp(ptr, StripContainerMagic, 4) != 0)
+  {
+    return false;
+  }
+
+  // The sizes in the header must add up exactly, which also rules out data
+  // from a compressor that does not use strips and happens to start with the
+  // magic number.
+  const size_t numStrips = ReadUInt32(ptr + 4);
+  if (numStrips == 0 || size < StripContainerHeaderSize + numStrips * StripHeaderSize)
+  {
+    return false;
+  }
+  size_t total = StripContainerHeaderSize + numStrips * StripHeaderSize;
+  for (size_t cc = 0; cc < numStrips; ++cc)
+  {
+    total += ReadUInt32(ptr + StripContainerHeaderSize + cc * StripHeaderSize + 4);
+  }
+  return total == size;
+}
+
 //-----------------------------------------------------------------------------
 void vtkImageCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
@@ -94,5 +298,6 @@ void vtkImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Input:          " << this->Input << endl
      << indent << "Output:         " << this->Output << endl
-     << indent << "LossLessMode: " << this->LossLessMode << endl;
+     << indent << "LossLessMode: " << this->LossLessMode << endl
+     << indent << "NumberOfStrips: " << this->NumberOfStrips << endl;
 }
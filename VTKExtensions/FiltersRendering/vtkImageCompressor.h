@@ -21,6 +21,8 @@
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 
+#include <vector> // for std::vector
+
 class vtkUnsignedCharArray;
 class vtkMultiProcessStream;
 
@@ -72,6 +74,21 @@ public:
    */
   virtual void SetImageResolution(int width, int height);
 
+  ///@{
+  /**
+   * Set/Get the number of strips the image is split into when compressing.
+   * Strips are contiguous ranges of pixels, i.e. horizontal bands of the
+   * image. They are compressed and decompressed in parallel with vtkSMPTools
+   * and stored in a container that records their layout. 0 (default) picks
+   * the number of strips from the image size and number of threads, 1
+   * disables strips and produces the same data as before. Only used by
+   * compressors that implement CompressStrip() and DecompressStrip().
+   * Decompressing handles both layouts regardless of this value.
+   */
+  vtkSetClampMacro(NumberOfStrips, int, 0, 1024);
+  vtkGetMacro(NumberOfStrips, int);
+  ///@}
+
   /**
    * Serialize compressor configuration (but not the data) into the stream.
    */
@@ -106,11 +123,46 @@ protected:
   ~vtkImageCompressor() override;
   ///@}
 
+  ///@{
+  /**
+   * Compress/decompress a single strip of `numPixels` pixels. These must be
+   * thread safe since strips are processed in parallel. Return false on
+   * failure.
+   */
+  virtual bool CompressStrip(const unsigned char* input, vtkIdType numPixels, int numComps,
+    std::vector<unsigned char>& output);
+  virtual bool DecompressStrip(const unsigned char* input, size_t inputSize, unsigned char* output,
+    vtkIdType numPixels, int numComps);
+  ///@}
+
+  /**
+   * Returns the number of strips to use for an image of `numPixels` pixels,
+   * based on NumberOfStrips.
+   */
+  int ComputeNumberOfStrips(vtkIdType numPixels);
+
+  /**
+   * Compress Input in `numStrips` strips into Output using CompressStrip().
+   */
+  int CompressStrips(int numStrips);
+
+  /**
+   * Decompress Input, which must be a strip container, into Output using
+   * DecompressStrip().
+   */
+  int DecompressStrips();
+
+  /**
+   * Returns true if `data` is a strip container produced by CompressStrips().
+   */
+  static bool IsStripContainer(vtkUnsignedCharArray* data);
+
   // This is the array which contains the compressed data.
   vtkUnsignedCharArray* Output;
   vtkUnsignedCharArray* Input;
 
   int LossLessMode;
+  int NumberOfStrips;
 
   vtkSetStringMacro(Configuration);
   char* Configuration;
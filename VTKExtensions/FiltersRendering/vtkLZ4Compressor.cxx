@@ -7,10 +7,28 @@
 #include "vtkUnsignedCharArray.h"
 
 #include "vtk_lz4.h"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
+namespace
+{
+// Returns the mask applied to RGBA colors for the given compression level.
+unsigned int GetCompressMask(int compress_level)
+{
+  unsigned char compress_masks[6][4] = { { 0xFF, 0xFF, 0xFF, 0xFF }, { 0xFE, 0xFF, 0xFE, 0xFE },
+    { 0xFC, 0xFE, 0xFC, 0xFC }, { 0xF8, 0xFC, 0xF8, 0xF8 }, { 0xF0, 0xF8, 0xF0, 0xF0 },
+    { 0xE0, 0xF0, 0xE0, 0xE0 } };
+  assert(compress_level >= 0 && compress_level <= 5);
+
+  unsigned int compress_mask;
+  memcpy(&compress_mask, &compress_masks[compress_level], 4);
+  return compress_mask;
+}
+}
+
 vtkStandardNewMacro(vtkLZ4Compressor);
 //----------------------------------------------------------------------------
 vtkLZ4Compressor::vtkLZ4Compressor()
@@ -30,17 +48,18 @@ int vtkLZ4Compressor::Compress()
     return VTK_ERROR;
   }
 
-  unsigned char compress_masks[6][4] = { { 0xFF, 0xFF, 0xFF, 0xFF }, { 0xFE, 0xFF, 0xFE, 0xFE },
-    { 0xFC, 0xFE, 0xFC, 0xFC }, { 0xF8, 0xFC, 0xF8, 0xF8 }, { 0xF0, 0xF8, 0xF0, 0xF0 },
-    { 0xE0, 0xF0, 0xE0, 0xE0 } };
+  // Large images are split in strips compressed in parallel.
+  const int numStrips = this->ComputeNumberOfStrips(this->Input->GetNumberOfTuples());
+  if (numStrips > 1)
+  {
+    return this->CompressStrips(numStrips);
+  }
 
   int compress_level = this->LossLessMode ? 0 : this->Quality;
-  assert(compress_level >= 0 && compress_level <= 5);
 
   // Set bitmask based on compress_level
-  unsigned int compress_mask;
   // I shifted the level by one so that 0 means no compression.
-  memcpy(&compress_mask, &compress_masks[compress_level], 4);
+  const unsigned int compress_mask = ::GetCompressMask(compress_level);
 
   vtkUnsignedCharArray* input = this->Input;
   int inputSize = input->GetNumberOfTuples() * input->GetNumberOfComponents();
@@ -75,6 +94,11 @@ int vtkLZ4Compressor::Decompress()
     return VTK_ERROR;
   }
 
+  if (vtkImageCompressor::IsStripContainer(this->Input))
+  {
+    return this->DecompressStrips();
+  }
+
   int maxDecompressedSize =
     this->Output->GetNumberOfComponents() * this->Output->GetNumberOfTuples();
   int decompressedSize =
@@ -91,6 +115,45 @@ int vtkLZ4Compressor::Decompress()
   return decompressedSize > 0 ? VTK_OK : VTK_ERROR;
 }
 
+//----------------------------------------------------------------------------
+bool vtkLZ4Compressor::CompressStrip(const unsigned char* input, vtkIdType numPixels,
+  int numComps, std::vector<unsigned char>& output)
+{
+  const int compress_level = this->LossLessMode ? 0 : this->Quality;
+  const int inputSize = static_cast<int>(numPixels * numComps);
+
+  std::vector<unsigned char> masked;
+  if (compress_level > 0 && numComps == 4)
+  {
+    const unsigned int compress_mask = ::GetCompressMask(compress_level);
+    masked.resize(inputSize);
+    const unsigned int* in = reinterpret_cast<const unsigned int*>(input);
+    unsigned int* out = reinterpret_cast<unsigned int*>(masked.data());
+    for (vtkIdType cc = 0; cc < numPixels; ++cc)
+    {
+      out[cc] = in[cc] & compress_mask;
+    }
+    input = masked.data();
+  }
+
+  const int maxOutputSize = LZ4_compressBound(inputSize);
+  output.resize(maxOutputSize);
+  const int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(input),
+    reinterpret_cast<char*>(output.data()), inputSize, maxOutputSize, 16);
+  output.resize(std::max(compressedSize, 0));
+  return compressedSize > 0;
+}
+
+//----------------------------------------------------------------------------
+bool vtkLZ4Compressor::DecompressStrip(const unsigned char* input, size_t inputSize,
+  unsigned char* output, vtkIdType numPixels, int numComps)
+{
+  const int outputSize = static_cast<int>(numPixels * numComps);
+  return LZ4_decompress_safe(reinterpret_cast<const char*>(input),
+           reinterpret_cast<char*>(output), static_cast<int>(inputSize),
+           outputSize) == outputSize;
+}
+
 //-----------------------------------------------------------------------------
 void vtkLZ4Compressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
@@ -59,6 +59,16 @@ protected:
   vtkLZ4Compressor();
   ~vtkLZ4Compressor() override;
 
+  ///@{
+  /**
+   * Compress/Decompress a single strip, see vtkImageCompressor::NumberOfStrips.
+   */
+  bool CompressStrip(const unsigned char* input, vtkIdType numPixels, int numComps,
+    std::vector<unsigned char>& output) override;
+  bool DecompressStrip(const unsigned char* input, size_t inputSize, unsigned char* output,
+    vtkIdType numPixels, int numComps) override;
+  ///@}
+
   int Quality;
 
 private:
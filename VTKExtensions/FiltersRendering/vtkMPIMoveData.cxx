@@ -23,21 +23,236 @@
 #include "vtkPVSession.h"
 #include "vtkPointData.h"
 #include "vtkProcessModule.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSocketCommunicator.h"
 #include "vtkSocketController.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringScanner.h"
+#include "vtkTCPNetworkAccessManager.h"
 #include "vtkTimerLog.h"
 
+#include "vtk_lz4.h"
 #include "vtk_zlib.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <sstream>
 #include <vector>
 
-bool vtkMPIMoveData::UseZLibCompression = false;
+int vtkMPIMoveData::CompressionCodec = vtkMPIMoveData::NO_COMPRESSION;
+int vtkMPIMoveData::CompressionLevel = 6;
+vtkIdType vtkMPIMoveData::CompressionChunkSize = 1 << 20;
 
 namespace
 {
+// Compressed buffers start with a header that lets the receiver detect the
+// codec and decompress chunks independently:
+//  - 4 bytes magic "pvmc",
+//  - 4 bytes codec (see vtkMPIMoveData::CompressionCodecs),
+//  - 4 bytes number of chunks,
+//  - 8 bytes total uncompressed length,
+//  - for each chunk, 4 bytes compressed length and 4 bytes uncompressed length,
+// followed by the compressed chunks. All integers are little-endian.
+constexpr char CompressedBufferMagic[4] = { 'p', 'v', 'm', 'c' };
+constexpr vtkIdType CompressedBufferHeaderSize = 20;
+constexpr vtkIdType CompressedChunkHeaderSize = 8;
+
+void WriteLittleEndian(char* dest, vtkTypeUInt64 value, int numBytes)
+{
+  for (int cc = 0; cc < numBytes; ++cc)
+  {
+    dest[cc] = static_cast<char>(value & 0xff);
+    value = value >> 8;
+  }
+}
+
+vtkTypeUInt64 ReadLittleEndian(const char* src, int numBytes)
+{
+  vtkTypeUInt64 value = 0;
+  for (int cc = 0; cc < numBytes; ++cc)
+  {
+    value = value | (static_cast<vtkTypeUInt64>(static_cast<unsigned char>(src[cc])) << (8 * cc));
+  }
+  return value;
+}
+
+bool CompressChunk(
+  int codec, int level, const char* input, vtkIdType inputLength, std::vector<char>& output)
+{
+  if (codec == vtkMPIMoveData::LZ4)
+  {
+    output.resize(LZ4_compressBound(static_cast<int>(inputLength)));
+    const int size = LZ4_compress_fast(input, output.data(), static_cast<int>(inputLength),
+      static_cast<int>(output.size()), /*acceleration*/ 10 - level);
+    output.resize(size > 0 ? size : 0);
+    return size > 0;
+  }
+  else if (codec == vtkMPIMoveData::ZLIB)
+  {
+    uLongf size = compressBound(static_cast<uLong>(inputLength));
+    output.resize(size);
+    const bool ok = compress2(reinterpret_cast<Bytef*>(output.data()), &size,
+                      reinterpret_cast<const Bytef*>(input), static_cast<uLong>(inputLength),
+                      level) == Z_OK;
+    output.resize(ok ? size : 0);
+    return ok;
+  }
+  return false;
+}
+
+bool DecompressChunk(
+  int codec, const char* input, vtkIdType inputLength, char* output, vtkIdType outputLength)
+{
+  if (codec == vtkMPIMoveData::LZ4)
+  {
+    return LZ4_decompress_safe(input, output, static_cast<int>(inputLength),
+             static_cast<int>(outputLength)) == outputLength;
+  }
+  else if (codec == vtkMPIMoveData::ZLIB)
+  {
+    uLongf size = static_cast<uLongf>(outputLength);
+    return uncompress(reinterpret_cast<Bytef*>(output), &size,
+             reinterpret_cast<const Bytef*>(input), static_cast<uLong>(inputLength)) == Z_OK &&
+      static_cast<vtkIdType>(size) == outputLength;
+  }
+  return false;
+}
+
+// Compress `input` in chunks of `chunkSize` bytes, in parallel. Returns a
+// buffer allocated with new[] or nullptr on failure.
+char* CompressBuffer(int codec, int level, vtkIdType chunkSize, const char* input,
+  vtkIdType inputLength, vtkIdType& outputLength)
+{
+  const vtkIdType numChunks = std::max<vtkIdType>(1, (inputLength + chunkSize - 1) / chunkSize);
+  std::vector<std::vector<char>> chunks(numChunks);
+  std::atomic<bool> ok(true);
+  vtkSMPTools::For(0, numChunks, 1,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType cc = begin; cc < end && ok; ++cc)
+      {
+        const vtkIdType offset = cc * chunkSize;
+        const vtkIdType length = std::min(chunkSize, inputLength - offset);
+        if (!CompressChunk(codec, level, input + offset, length, chunks[cc]))
+        {
+          ok = false;
+        }
+      }
+    });
+  if (!ok)
+  {
+    return nullptr;
+  }
+
+  outputLength = CompressedBufferHeaderSize + numChunks * CompressedChunkHeaderSize;
+  for (const auto& chunk : chunks)
+  {
+    outputLength += static_cast<vtkIdType>(chunk.size());
+  }
+
+  char* output = new char[outputLength];
+  memcpy(output, CompressedBufferMagic, 4);
+  WriteLittleEndian(output + 4, codec, 4);
+  WriteLittleEndian(output + 8, numChunks, 4);
+  WriteLittleEndian(output + 12, inputLength, 8);
+  char* chunkHeader = output + CompressedBufferHeaderSize;
+  char* chunkData = chunkHeader + numChunks * CompressedChunkHeaderSize;
+  for (vtkIdType cc = 0; cc < numChunks; ++cc)
+  {
+    const vtkIdType length = std::min(chunkSize, inputLength - cc * chunkSize);
+    WriteLittleEndian(chunkHeader, chunks[cc].size(), 4);
+    WriteLittleEndian(chunkHeader + 4, length, 4);
+    memcpy(chunkData, chunks[cc].data(), chunks[cc].size());
+    chunkHeader += CompressedChunkHeaderSize;
+    chunkData += chunks[cc].size();
+  }
+  return output;
+}
+
+bool IsCompressedBuffer(const char* input, vtkIdType inputLength)
+{
+  return inputLength >= CompressedBufferHeaderSize &&
+    memcmp(input, CompressedBufferMagic, 4) == 0;
+}
+
+// Decompress a buffer produced by CompressBuffer(), chunks in parallel.
+// Returns a buffer allocated with new[] or nullptr on failure.
+char* DecompressBuffer(const char* input, vtkIdType inputLength, vtkIdType& outputLength)
+{
+  const int codec = static_cast<int>(ReadLittleEndian(input + 4, 4));
+  const vtkIdType numChunks = static_cast<vtkIdType>(ReadLittleEndian(input + 8, 4));
+  outputLength = static_cast<vtkIdType>(ReadLittleEndian(input + 12, 8));
+  if (CompressedBufferHeaderSize + numChunks * CompressedChunkHeaderSize > inputLength)
+  {
+    return nullptr;
+  }
+
+  // Offsets of every chunk in the input and output buffers.
+  std::vector<vtkIdType> inputOffsets(numChunks + 1), outputOffsets(numChunks + 1);
+  inputOffsets[0] = CompressedBufferHeaderSize + numChunks * CompressedChunkHeaderSize;
+  outputOffsets[0] = 0;
+  const char* chunkHeader = input + CompressedBufferHeaderSize;
+  for (vtkIdType cc = 0; cc < numChunks; ++cc, chunkHeader += CompressedChunkHeaderSize)
+  {
+    inputOffsets[cc + 1] =
+      inputOffsets[cc] + static_cast<vtkIdType>(ReadLittleEndian(chunkHeader, 4));
+    outputOffsets[cc + 1] =
+      outputOffsets[cc] + static_cast<vtkIdType>(ReadLittleEndian(chunkHeader + 4, 4));
+  }
+  if (inputOffsets[numChunks] > inputLength || outputOffsets[numChunks] != outputLength)
+  {
+    return nullptr;
+  }
+
+  char* output = new char[outputLength];
+  std::atomic<bool> ok(true);
+  vtkSMPTools::For(0, numChunks, 1,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType cc = begin; cc < end && ok; ++cc)
+      {
+        if (!DecompressChunk(codec, input + inputOffsets[cc],
+              inputOffsets[cc + 1] - inputOffsets[cc], output + outputOffsets[cc],
+              outputOffsets[cc + 1] - outputOffsets[cc]))
+        {
+          ok = false;
+        }
+      }
+    });
+  if (!ok)
+  {
+    delete[] output;
+    return nullptr;
+  }
+  return output;
+}
+
+// Buffers compressed by older versions carry a "zlib" tag followed by the
+// uncompressed length on 4 bytes, then a single zlib stream.
+bool IsLegacyZLibBuffer(const char* input, vtkIdType inputLength)
+{
+  return inputLength > 8 && memcmp(input, "zlib", 4) == 0;
+}
+
+// Decompress a buffer tagged "zlib". Returns a buffer allocated with new[] or
+// nullptr on failure.
+char* DecompressLegacyZLibBuffer(const char* input, vtkIdType inputLength, vtkIdType& outputLength)
+{
+  outputLength = static_cast<vtkIdType>(ReadLittleEndian(input + 4, 4));
+  char* output = new char[outputLength];
+  uLongf destLen = static_cast<uLongf>(outputLength);
+  if (uncompress(reinterpret_cast<Bytef*>(output), &destLen,
+        reinterpret_cast<const Bytef*>(input + 8), static_cast<uLong>(inputLength - 8)) != Z_OK ||
+    static_cast<vtkIdType>(destLen) != outputLength)
+  {
+    delete[] output;
+    return nullptr;
+  }
+  return output;
+}
+
 bool vtkMPIMoveDataMerge(std::vector<vtkSmartPointer<vtkDataObject>>& pieces, vtkDataObject* result)
 {
   return vtkMultiProcessControllerHelper::MergePieces(pieces, result);
@@ -153,16 +368,55 @@ void vtkMPIMoveData::InitializeForCommunicationForParaView()
   this->SetMPIMToNSocketConnection(session->GetMPIMToNSocketConnection());
 }
 
+//----------------------------------------------------------------------------
+void vtkMPIMoveData::SetCompressionCodec(int codec)
+{
+  vtkMPIMoveData::CompressionCodec =
+    std::min(std::max(codec, static_cast<int>(NO_COMPRESSION)), static_cast<int>(ZLIB));
+}
+
+//----------------------------------------------------------------------------
+int vtkMPIMoveData::GetCompressionCodec()
+{
+  return vtkMPIMoveData::CompressionCodec;
+}
+
+//----------------------------------------------------------------------------
+void vtkMPIMoveData::SetCompressionLevel(int level)
+{
+  vtkMPIMoveData::CompressionLevel = std::min(std::max(level, 1), 9);
+}
+
+//----------------------------------------------------------------------------
+int vtkMPIMoveData::GetCompressionLevel()
+{
+  return vtkMPIMoveData::CompressionLevel;
+}
+
+//----------------------------------------------------------------------------
+void vtkMPIMoveData::SetCompressionChunkSize(vtkIdType size)
+{
+  // chunk lengths are sent as 32-bit integers.
+  vtkMPIMoveData::CompressionChunkSize =
+    std::min<vtkIdType>(std::max<vtkIdType>(size, 1 << 16), 1 << 30);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkMPIMoveData::GetCompressionChunkSize()
+{
+  return vtkMPIMoveData::CompressionChunkSize;
+}
+
 //----------------------------------------------------------------------------
 void vtkMPIMoveData::SetUseZLibCompression(bool b)
 {
-  vtkMPIMoveData::UseZLibCompression = b;
+  vtkMPIMoveData::SetCompressionCodec(b ? ZLIB : NO_COMPRESSION);
 }
 
 //----------------------------------------------------------------------------
 bool vtkMPIMoveData::GetUseZLibCompression()
 {
-  return vtkMPIMoveData::UseZLibCompression;
+  return vtkMPIMoveData::CompressionCodec == ZLIB;
 }
 
 //----------------------------------------------------------------------------
@@ -814,7 +1068,8 @@ void vtkMPIMoveData::DataServerSendToClient(vtkDataObject* output)
     this->ClientDataServerSocketController->Send(&(this->NumberOfBuffers), 1, 1, 23490);
     this->ClientDataServerSocketController->Send(
       this->BufferLengths, this->NumberOfBuffers, 1, 23491);
-    this->ClientDataServerSocketController->Send(this->Buffers, this->BufferTotalLength, 1, 23492);
+    vtkTCPNetworkAccessManager::SendBulkData(
+      this->ClientDataServerSocketController, this->Buffers, this->BufferTotalLength, 23492);
     this->ClearBuffer();
     vtkTimerLog::MarkEndEvent("Dataserver sending to client");
   }
@@ -846,7 +1101,8 @@ void vtkMPIMoveData::ClientReceiveFromDataServer(vtkDataObject* output)
     this->BufferTotalLength += this->BufferLengths[idx];
   }
   this->Buffers = new char[this->BufferTotalLength];
-  com->Receive(this->Buffers, this->BufferTotalLength, 1, 23492);
+  vtkTCPNetworkAccessManager::ReceiveBulkData(
+    this->ClientDataServerSocketController, this->Buffers, this->BufferTotalLength, 23492);
   this->ReconstructDataFromBuffer(output);
   this->ClearBuffer();
 }
@@ -963,31 +1219,19 @@ void vtkMPIMoveData::MarshalDataToBuffer(vtkDataObject* data)
   char* buffer = nullptr;
   vtkIdType buffer_length = 0;
 
-  if (vtkMPIMoveData::UseZLibCompression)
+  if (vtkMPIMoveData::CompressionCodec != NO_COMPRESSION)
   {
-    vtkTimerLog::MarkStartEvent("Zlib compress");
-    // Use z-lib compression.
-    uLongf out_size = compressBound(writer->GetOutputStringLength());
-    buffer = new char[out_size + 8];
-    memcpy(buffer, "zlib0000", 8);
-
-    compress2(reinterpret_cast<Bytef*>(buffer + 8), &out_size,
-      reinterpret_cast<const Bytef*>(writer->GetOutputString()), writer->GetOutputStringLength(),
-      /* compression_level */ Z_DEFAULT_COMPRESSION);
-    vtkTimerLog::MarkEndEvent("Zlib compress");
-    int in_size = static_cast<int>(writer->GetOutputStringLength());
-    for (int cc = 0; cc < 4; cc++)
+    vtkTimerLog::MarkStartEvent("Compress");
+    buffer = ::CompressBuffer(vtkMPIMoveData::CompressionCodec, vtkMPIMoveData::CompressionLevel,
+      vtkMPIMoveData::CompressionChunkSize, writer->GetOutputString(),
+      writer->GetOutputStringLength(), buffer_length);
+    vtkTimerLog::MarkEndEvent("Compress");
+    if (!buffer)
     {
-      // the first 4 bytes in the header are "zlib" which helps the receiver
-      // identify that zlib compression has been used.
-      // the next 4 bytes are the original length since zlib doesn't provide
-      // that to the receiver.
-      buffer[4 + cc] = (in_size & 0x0ff);
-      in_size = in_size >> 8;
+      vtkWarningMacro("Compression failed. Sending uncompressed data.");
     }
-    buffer_length = out_size + 8;
   }
-  else
+  if (!buffer)
   {
     buffer_length = writer->GetOutputStringLength();
     buffer = writer->RegisterAndGetOutputString();
@@ -1024,23 +1268,34 @@ void vtkMPIMoveData::ReconstructDataFromBuffer(vtkDataObject* data)
     vtkIdType bufferLength = this->BufferLengths[idx];
 
     char* realBuffer = nullptr;
-    if (bufferLength > 4 && strncmp(bufferArray, "zlib", 4) == 0)
+    if (::IsCompressedBuffer(bufferArray, bufferLength))
     {
-      // sender used zlib compression. Decompress it.
-      vtkIdType compressed_length = bufferLength - 8; // remove the zlib header.
+      // sender used compression. Decompress it.
       vtkIdType uncompressed_length = 0;
-      for (int cc = 0; cc < 4; cc++)
+      vtkTimerLog::MarkStartEvent("Uncompress");
+      realBuffer = ::DecompressBuffer(bufferArray, bufferLength, uncompressed_length);
+      vtkTimerLog::MarkEndEvent("Uncompress");
+      if (!realBuffer)
       {
-        uncompressed_length = uncompressed_length | ((0xff & (bufferArray[4 + cc])) << 8 * cc);
+        vtkErrorMacro("Failed to decompress received data.");
+        continue;
       }
 
-      // using zlib compression.
-      realBuffer = new char[uncompressed_length];
-      uLongf destLen = uncompressed_length;
+      bufferArray = realBuffer;
+      bufferLength = uncompressed_length;
+    }
+    else if (::IsLegacyZLibBuffer(bufferArray, bufferLength))
+    {
+      // sender used the single-stream zlib format of older versions.
+      vtkIdType uncompressed_length = 0;
       vtkTimerLog::MarkStartEvent("Zlib uncompress");
-      uncompress(reinterpret_cast<Bytef*>(realBuffer), &destLen,
-        reinterpret_cast<const Bytef*>(bufferArray + 8), compressed_length);
+      realBuffer = ::DecompressLegacyZLibBuffer(bufferArray, bufferLength, uncompressed_length);
       vtkTimerLog::MarkEndEvent("Zlib uncompress");
+      if (!realBuffer)
+      {
+        vtkErrorMacro("Failed to decompress received data.");
+        continue;
+      }
 
       bufferArray = realBuffer;
       bufferLength = uncompressed_length;
@@ -1113,6 +1368,9 @@ void vtkMPIMoveData::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Server: " << this->Server << endl;
   os << indent << "MoveMode: " << this->MoveMode << endl;
   os << indent << "SkipDataServerGatherToZero: " << this->SkipDataServerGatherToZero << endl;
+  os << indent << "CompressionCodec: " << vtkMPIMoveData::CompressionCodec << endl;
+  os << indent << "CompressionLevel: " << vtkMPIMoveData::CompressionLevel << endl;
+  os << indent << "CompressionChunkSize: " << vtkMPIMoveData::CompressionChunkSize << endl;
   os << indent << "OutputDataType: ";
   if (this->OutputDataType == VTK_POLY_DATA)
   {
@@ -92,11 +92,49 @@ public:
   vtkGetMacro(OutputDataType, int);
   ///@}
 
+  enum CompressionCodecs
+  {
+    NO_COMPRESSION = 0,
+    LZ4 = 1,
+    ZLIB = 2
+  };
+
+  ///@{
+  /**
+   * Codec used to compress the marshalled data before it is sent.
+   * NO_COMPRESSION by default. This value has any effect only on the
+   * data-sender processes. The receiver always checks the received data to
+   * see which codec, if any, was used.
+   */
+  static void SetCompressionCodec(int codec);
+  static int GetCompressionCodec();
+  ///@}
+
+  ///@{
+  /**
+   * Compression level, from 1 (fastest) to 9 (smallest). For ZLIB, this is
+   * the zlib compression level. For LZ4, lower levels use larger acceleration
+   * factors. Default is 6.
+   */
+  static void SetCompressionLevel(int level);
+  static int GetCompressionLevel();
+  ///@}
+
+  ///@{
+  /**
+   * Marshalled data larger than this many bytes is split into chunks that
+   * are compressed, and decompressed on the receiver, in parallel using
+   * vtkSMPTools. Default is 1 MiB.
+   */
+  static void SetCompressionChunkSize(vtkIdType size);
+  static vtkIdType GetCompressionChunkSize();
+  ///@}
+
   ///@{
   /**
    * When set to true, zlib compression is used. False by default.
-   * This value has any effect only on the data-sender processes. The receiver
-   * always checks the received data to see if zlib decompression is required.
+   * This is equivalent to setting the compression codec to ZLIB or
+   * NO_COMPRESSION.
    */
   static void SetUseZLibCompression(bool b);
   static bool GetUseZLibCompression();
@@ -185,7 +223,9 @@ private:
   vtkMPIMoveData(const vtkMPIMoveData&) = delete;
   void operator=(const vtkMPIMoveData&) = delete;
 
-  static bool UseZLibCompression;
+  static int CompressionCodec;
+  static int CompressionLevel;
+  static vtkIdType CompressionChunkSize;
 };
 
 #endif
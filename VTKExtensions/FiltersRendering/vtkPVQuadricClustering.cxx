@@ -0,0 +1,482 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVQuadricClustering.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Size of a quadric: the upper half of the 3x3 matrix followed by the vector
+// part, xx, xy, xz, yy, yz, zz, xd, yd, zd.
+constexpr int QuadricSize = 9;
+
+// Computes the quadric of the plane of a triangle weighted by its area.
+void ComputeTriangleQuadric(
+  const double p0[3], const double p1[3], const double p2[3], double quadric[QuadricSize])
+{
+  double e1[3], e2[3], n[3];
+  vtkMath::Subtract(p1, p0, e1);
+  vtkMath::Subtract(p2, p0, e2);
+  vtkMath::Cross(e1, e2, n);
+  const double weight = vtkMath::Normalize(n);
+  const double d = -vtkMath::Dot(n, p0);
+  quadric[0] = weight * n[0] * n[0];
+  quadric[1] = weight * n[0] * n[1];
+  quadric[2] = weight * n[0] * n[2];
+  quadric[3] = weight * n[1] * n[1];
+  quadric[4] = weight * n[1] * n[2];
+  quadric[5] = weight * n[2] * n[2];
+  quadric[6] = weight * n[0] * d;
+  quadric[7] = weight * n[1] * d;
+  quadric[8] = weight * n[2] * d;
+}
+
+// Finds the point minimizing the quadric error, starting from the bin center
+// and ignoring directions in which the quadric is (nearly) singular.
+void ComputeOptimalPoint(const double quadric[QuadricSize], const double center[3], double x[3])
+{
+  double a0[3] = { quadric[0], quadric[1], quadric[2] };
+  double a1[3] = { quadric[1], quadric[3], quadric[4] };
+  double a2[3] = { quadric[2], quadric[4], quadric[5] };
+  double* a[3] = { a0, a1, a2 };
+  double v0[3], v1[3], v2[3];
+  double* v[3] = { v0, v1, v2 };
+  double w[3];
+  // the residual must be computed before Jacobi() modifies `a`.
+  double r[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    r[i] = vtkMath::Dot(a[i], center) + quadric[6 + i];
+  }
+  vtkMath::Jacobi(a, w, v);
+
+  std::copy(center, center + 3, x);
+  for (int i = 0; i < 3; ++i)
+  {
+    // eigenvalues are sorted in decreasing order, eigenvectors are columns.
+    if (w[0] <= 0.0 || w[i] <= 1e-3 * w[0])
+    {
+      break;
+    }
+    const double s = -(v[0][i] * r[0] + v[1][i] * r[1] + v[2][i] * r[2]) / w[i];
+    for (int j = 0; j < 3; ++j)
+    {
+      x[j] += s * v[j][i];
+    }
+  }
+}
+
+// Each triangle spanning several bins adds its quadric to each of these bins,
+// in arrays local to the thread. Triangles within a single bin are ignored
+// since UseInternalTriangles is off. Polygons are split in fans of triangles,
+// like vtkQuadricClustering does.
+struct AccumulateQuadrics
+{
+  vtkCellArray* Polys;
+  vtkPoints* Points;
+  const std::vector<vtkIdType>& PointBins;
+  const vtkIdType NumberOfBins;
+
+  vtkSMPThreadLocal<vtkSmartPointer<vtkCellArrayIterator>> Iterators;
+  vtkSMPThreadLocal<std::vector<double>> Quadrics;
+  vtkSMPThreadLocal<std::vector<unsigned char>> UsedBins;
+
+  AccumulateQuadrics(vtkCellArray* polys, vtkPoints* points,
+    const std::vector<vtkIdType>& pointBins, vtkIdType numberOfBins)
+    : Polys(polys)
+    , Points(points)
+    , PointBins(pointBins)
+    , NumberOfBins(numberOfBins)
+  {
+  }
+
+  void Initialize()
+  {
+    this->Iterators.Local() = vtk::TakeSmartPointer(this->Polys->NewIterator());
+    this->Quadrics.Local().assign(QuadricSize * this->NumberOfBins, 0.0);
+    this->UsedBins.Local().assign(this->NumberOfBins, 0);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkCellArrayIterator* iter = this->Iterators.Local();
+    double* quadrics = this->Quadrics.Local().data();
+    unsigned char* usedBins = this->UsedBins.Local().data();
+    double p0[3], p1[3], p2[3], quadric[QuadricSize];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      iter->GetCellAtId(cellId, npts, pts);
+      for (vtkIdType j = 2; j < npts; ++j)
+      {
+        const vtkIdType ids[3] = { pts[0], pts[j - 1], pts[j] };
+        const vtkIdType bins[3] = { this->PointBins[ids[0]], this->PointBins[ids[1]],
+          this->PointBins[ids[2]] };
+        if (bins[0] == bins[1] && bins[1] == bins[2])
+        {
+          continue;
+        }
+        this->Points->GetPoint(ids[0], p0);
+        this->Points->GetPoint(ids[1], p1);
+        this->Points->GetPoint(ids[2], p2);
+        ComputeTriangleQuadric(p0, p1, p2, quadric);
+        for (int k = 0; k < 3; ++k)
+        {
+          // a triangle with two corners in a bin adds its quadric once.
+          if ((k > 0 && bins[k] == bins[0]) || (k > 1 && bins[k] == bins[1]))
+          {
+            continue;
+          }
+          double* binQuadric = quadrics + QuadricSize * bins[k];
+          for (int i = 0; i < QuadricSize; ++i)
+          {
+            binQuadric[i] += quadric[i];
+          }
+          usedBins[bins[k]] = 1;
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+// For each used bin, finds the input point closest to the optimal point of
+// the bin, in arrays local to the thread. Ties go to the smallest point id.
+struct FindClosestPoints
+{
+  vtkPoints* Points;
+  const std::vector<vtkIdType>& PointBins;
+  const std::vector<double>& OptimalPoints;
+  const std::vector<unsigned char>& UsedBins;
+
+  vtkSMPThreadLocal<std::vector<std::pair<double, vtkIdType>>> Closest;
+
+  FindClosestPoints(vtkPoints* points, const std::vector<vtkIdType>& pointBins,
+    const std::vector<double>& optimalPoints, const std::vector<unsigned char>& usedBins)
+    : Points(points)
+    , PointBins(pointBins)
+    , OptimalPoints(optimalPoints)
+    , UsedBins(usedBins)
+  {
+  }
+
+  void Initialize()
+  {
+    this->Closest.Local().assign(this->UsedBins.size(), std::make_pair(VTK_DOUBLE_MAX, -1));
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto& closest = this->Closest.Local();
+    double x[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      const vtkIdType bin = this->PointBins[ptId];
+      if (!this->UsedBins[bin])
+      {
+        continue;
+      }
+      this->Points->GetPoint(ptId, x);
+      const double distance2 = vtkMath::Distance2BetweenPoints(x, &this->OptimalPoints[3 * bin]);
+      if (distance2 < closest[bin].first ||
+        (distance2 == closest[bin].first && ptId < closest[bin].second))
+      {
+        closest[bin] = std::make_pair(distance2, ptId);
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+// An output triangle, with its point ids sorted to detect duplicates.
+struct OutputTriangle
+{
+  std::array<vtkIdType, 3> Ids;
+  std::array<vtkIdType, 3> SortedIds;
+  vtkIdType Triangle;
+  vtkIdType Cell;
+
+  bool operator<(const OutputTriangle& other) const
+  {
+    return std::tie(this->SortedIds, this->Triangle) < std::tie(other.SortedIds, other.Triangle);
+  }
+};
+}
+
+vtkStandardNewMacro(vtkPVQuadricClustering);
+//----------------------------------------------------------------------------
+vtkPVQuadricClustering::vtkPVQuadricClustering()
+{
+  this->AutoAdjustNumberOfDivisionsOff();
+}
+
+//----------------------------------------------------------------------------
+vtkPVQuadricClustering::~vtkPVQuadricClustering() = default;
+
+//----------------------------------------------------------------------------
+int vtkPVQuadricClustering::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPolyData* input = vtkPolyData::GetData(inputVector[0], 0);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
+  if (!input || !output || !this->GetUseInputPoints() || this->GetUseFeatureEdges() ||
+    this->GetUseInternalTriangles() || this->GetAutoAdjustNumberOfDivisions() ||
+    this->ComputeNumberOfDivisions || input->GetNumberOfVerts() > 0 ||
+    input->GetNumberOfLines() > 0 || input->GetNumberOfStrips() > 0 ||
+    input->GetNumberOfPolys() == 0)
+  {
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  // Bin layout, same as vtkQuadricClustering: the divisions split the bounds.
+  vtkPoints* inPts = input->GetPoints();
+  const vtkIdType numPts = inPts->GetNumberOfPoints();
+  double bounds[6];
+  input->GetBounds(bounds);
+  int divs[3];
+  this->GetNumberOfDivisions(divs);
+  double binSize[3], invBinSize[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    divs[i] = std::max(divs[i], 1);
+    binSize[i] = (bounds[2 * i + 1] - bounds[2 * i]) / divs[i];
+    invBinSize[i] = binSize[i] > 0.0 ? 1.0 / binSize[i] : 0.0;
+  }
+  const vtkIdType sliceSize = static_cast<vtkIdType>(divs[0]) * divs[1];
+
+  std::vector<vtkIdType> pointBins(numPts);
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      double x[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        inPts->GetPoint(ptId, x);
+        vtkIdType ijk[3];
+        for (int i = 0; i < 3; ++i)
+        {
+          ijk[i] = vtkMath::ClampValue(
+            static_cast<vtkIdType>((x[i] - bounds[2 * i]) * invBinSize[i]), vtkIdType(0),
+            static_cast<vtkIdType>(divs[i] - 1));
+        }
+        pointBins[ptId] = ijk[0] + ijk[1] * divs[0] + ijk[2] * sliceSize;
+      }
+    });
+
+  // Only the bins containing points are numbered, so that the arrays indexed
+  // by bin stay small with fine divisions.
+  std::vector<vtkIdType> bins(pointBins);
+  vtkSMPTools::Sort(bins.begin(), bins.end());
+  bins.erase(std::unique(bins.begin(), bins.end()), bins.end());
+  const vtkIdType numBins = static_cast<vtkIdType>(bins.size());
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        pointBins[ptId] = static_cast<vtkIdType>(
+          std::lower_bound(bins.begin(), bins.end(), pointBins[ptId]) - bins.begin());
+      }
+    });
+
+  vtkCellArray* polys = input->GetPolys();
+  const vtkIdType numPolys = polys->GetNumberOfCells();
+  AccumulateQuadrics accumulate(polys, inPts, pointBins, numBins);
+  vtkSMPTools::For(0, numPolys, accumulate);
+
+  // Sum the quadrics of all threads in the arrays of the first one.
+  std::vector<std::vector<double>*> threadQuadrics;
+  for (auto& quadrics : accumulate.Quadrics)
+  {
+    threadQuadrics.push_back(&quadrics);
+  }
+  std::vector<std::vector<unsigned char>*> threadUsedBins;
+  for (auto& usedBins : accumulate.UsedBins)
+  {
+    threadUsedBins.push_back(&usedBins);
+  }
+  std::vector<double>& quadrics = *threadQuadrics[0];
+  std::vector<unsigned char>& usedBins = *threadUsedBins[0];
+
+  // Each used bin is represented by the input point closest to the point
+  // minimizing its quadric error.
+  std::vector<double> optimalPoints(3 * numBins);
+  vtkSMPTools::For(0, numBins,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      double center[3];
+      for (vtkIdType bin = begin; bin < end; ++bin)
+      {
+        double* quadric = &quadrics[QuadricSize * bin];
+        for (std::size_t cc = 1; cc < threadQuadrics.size(); ++cc)
+        {
+          const double* threadQuadric = &(*threadQuadrics[cc])[QuadricSize * bin];
+          for (int i = 0; i < QuadricSize; ++i)
+          {
+            quadric[i] += threadQuadric[i];
+          }
+          usedBins[bin] |= (*threadUsedBins[cc])[bin];
+        }
+        if (!usedBins[bin])
+        {
+          continue;
+        }
+        const vtkIdType binId = bins[bin];
+        const vtkIdType ijk[3] = { binId % divs[0], (binId / divs[0]) % divs[1],
+          binId / sliceSize };
+        for (int i = 0; i < 3; ++i)
+        {
+          center[i] = bounds[2 * i] + (ijk[i] + 0.5) * binSize[i];
+        }
+        ComputeOptimalPoint(quadric, center, &optimalPoints[3 * bin]);
+      }
+    });
+  for (auto& threadQuadric : accumulate.Quadrics)
+  {
+    std::vector<double>().swap(threadQuadric);
+  }
+
+  FindClosestPoints findClosest(inPts, pointBins, optimalPoints, usedBins);
+  vtkSMPTools::For(0, numPts, findClosest);
+
+  // Output points are numbered in bin order.
+  std::vector<vtkIdType> outIds(numBins, -1);
+  vtkNew<vtkIdList> srcPointIds;
+  vtkNew<vtkIdList> dstPointIds;
+  for (vtkIdType bin = 0; bin < numBins; ++bin)
+  {
+    if (!usedBins[bin])
+    {
+      continue;
+    }
+    std::pair<double, vtkIdType> closest(VTK_DOUBLE_MAX, -1);
+    for (const auto& threadClosest : findClosest.Closest)
+    {
+      const auto& candidate = threadClosest[bin];
+      if (candidate.first < closest.first ||
+        (candidate.first == closest.first && candidate.second < closest.second))
+      {
+        closest = candidate;
+      }
+    }
+    outIds[bin] = srcPointIds->GetNumberOfIds();
+    srcPointIds->InsertNextId(closest.second);
+    dstPointIds->InsertNextId(outIds[bin]);
+  }
+  for (auto& threadClosest : findClosest.Closest)
+  {
+    std::vector<std::pair<double, vtkIdType>>().swap(threadClosest);
+  }
+  const vtkIdType numOutPts = srcPointIds->GetNumberOfIds();
+
+  vtkNew<vtkPoints> outPts;
+  outPts->SetDataType(inPts->GetDataType());
+  outPts->Allocate(numOutPts);
+  outPts->InsertPoints(dstPointIds, srcPointIds, inPts);
+  output->GetPointData()->CopyAllocate(input->GetPointData(), numOutPts);
+  output->GetPointData()->CopyData(input->GetPointData(), srcPointIds, dstPointIds);
+
+  // Triangles spanning three bins are output, once even if several input
+  // triangles collapse to the same one, in the order of the input triangles.
+  std::vector<vtkIdType> triangleOffsets(numPolys + 1, 0);
+  for (vtkIdType cellId = 0; cellId < numPolys; ++cellId)
+  {
+    const vtkIdType size = polys->GetCellSize(cellId);
+    triangleOffsets[cellId + 1] = triangleOffsets[cellId] + (size > 2 ? size - 2 : 0);
+  }
+  vtkSMPThreadLocal<std::vector<OutputTriangle>> threadTriangles;
+  vtkSMPTools::For(0, numPolys,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      auto& triangles = threadTriangles.Local();
+      auto iter = vtk::TakeSmartPointer(polys->NewIterator());
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        iter->GetCellAtId(cellId, npts, pts);
+        vtkIdType triangle = triangleOffsets[cellId];
+        for (vtkIdType j = 2; j < npts; ++j, ++triangle)
+        {
+          const vtkIdType b0 = pointBins[pts[0]];
+          const vtkIdType b1 = pointBins[pts[j - 1]];
+          const vtkIdType b2 = pointBins[pts[j]];
+          if (b0 != b1 && b1 != b2 && b0 != b2)
+          {
+            OutputTriangle outTriangle;
+            outTriangle.Ids = { outIds[b0], outIds[b1], outIds[b2] };
+            outTriangle.SortedIds = outTriangle.Ids;
+            std::sort(outTriangle.SortedIds.begin(), outTriangle.SortedIds.end());
+            outTriangle.Triangle = triangle;
+            outTriangle.Cell = cellId;
+            triangles.push_back(outTriangle);
+          }
+        }
+      }
+    });
+  std::vector<OutputTriangle> triangles;
+  for (auto& local : threadTriangles)
+  {
+    triangles.insert(triangles.end(), local.begin(), local.end());
+    std::vector<OutputTriangle>().swap(local);
+  }
+  vtkSMPTools::Sort(triangles.begin(), triangles.end());
+  triangles.erase(std::unique(triangles.begin(), triangles.end(),
+                    [](const OutputTriangle& a, const OutputTriangle& b)
+                    { return a.SortedIds == b.SortedIds; }),
+    triangles.end());
+  vtkSMPTools::Sort(triangles.begin(), triangles.end(),
+    [](const OutputTriangle& a, const OutputTriangle& b) { return a.Triangle < b.Triangle; });
+
+  const vtkIdType numOutTriangles = static_cast<vtkIdType>(triangles.size());
+  vtkNew<vtkCellArray> outPolys;
+  outPolys->AllocateExact(numOutTriangles, 3 * numOutTriangles);
+  vtkNew<vtkIdList> srcCellIds;
+  vtkNew<vtkIdList> dstCellIds;
+  srcCellIds->SetNumberOfIds(numOutTriangles);
+  dstCellIds->SetNumberOfIds(numOutTriangles);
+  for (vtkIdType cc = 0; cc < numOutTriangles; ++cc)
+  {
+    outPolys->InsertNextCell(3, triangles[cc].Ids.data());
+    srcCellIds->SetId(cc, triangles[cc].Cell);
+    dstCellIds->SetId(cc, cc);
+  }
+
+  output->SetPoints(outPts);
+  output->SetPolys(outPolys);
+  if (this->GetCopyCellData())
+  {
+    output->GetCellData()->CopyAllocate(input->GetCellData(), numOutTriangles);
+    output->GetCellData()->CopyData(input->GetCellData(), srcCellIds, dstCellIds);
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVQuadricClustering::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
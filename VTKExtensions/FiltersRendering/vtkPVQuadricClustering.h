@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVQuadricClustering
+ * @brief   multithreaded vtkQuadricClustering for polygonal meshes
+ *
+ * vtkPVQuadricClustering decimates polygonal meshes the same way as
+ * vtkQuadricClustering does with UseInputPoints on, UseInternalTriangles and
+ * UseFeatureEdges off, but with vtkSMPTools. Each thread accumulates the
+ * quadrics of its triangles in arrays indexed by bin, which are then summed,
+ * and each bin is represented by the input point closest to the point
+ * minimizing its quadric error. Polygons are split in fans of triangles, and
+ * output triangles spanning the same three bins are only output once.
+ *
+ * The number of divisions is used as is: AutoAdjustNumberOfDivisions is off
+ * by default. Input with vertices, lines or strips, and other options, are
+ * passed to vtkQuadricClustering.
+ *
+ * vtkGeometryRepresentation uses this filter to build LOD geometry.
+ */
+
+#ifndef vtkPVQuadricClustering_h
+#define vtkPVQuadricClustering_h
+
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
+#include "vtkQuadricClustering.h"
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkPVQuadricClustering
+  : public vtkQuadricClustering
+{
+public:
+  static vtkPVQuadricClustering* New();
+  vtkTypeMacro(vtkPVQuadricClustering, vtkQuadricClustering);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+protected:
+  vtkPVQuadricClustering();
+  ~vtkPVQuadricClustering() override;
+
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+private:
+  vtkPVQuadricClustering(const vtkPVQuadricClustering&) = delete;
+  void operator=(const vtkPVQuadricClustering&) = delete;
+};
+
+#endif
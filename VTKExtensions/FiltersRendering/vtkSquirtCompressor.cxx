@@ -7,6 +7,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkUnsignedCharArray.h"
 #include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <sstream>
 
 vtkStandardNewMacro(vtkSquirtCompressor);
@@ -20,191 +22,135 @@ vtkSquirtCompressor::vtkSquirtCompressor()
 //-----------------------------------------------------------------------------
 vtkSquirtCompressor::~vtkSquirtCompressor() = default;
 
-//-----------------------------------------------------------------------------
-int vtkSquirtCompressor::Compress()
+namespace
+{
+// Returns the mask applied to colors for the given compression level.
+unsigned int GetCompressMask(int compress_level)
 {
-  if (!(this->Input && this->Output))
-  {
-    vtkWarningMacro("Cannot compress empty input or output detected.");
-    return VTK_ERROR;
-  }
-
-  vtkUnsignedCharArray* input = this->GetInput();
-
-  if (input->GetNumberOfComponents() != 4 && input->GetNumberOfComponents() != 3)
-  {
-    vtkErrorMacro("Squirt only works with RGBA or RGB");
-    return VTK_ERROR;
-  }
-
-  int count = 0;
-  int index = 0;
-  int comp_index = 0;
-  int end_index;
-  int compress_level = this->LossLessMode ? 0 : this->SquirtLevel;
-  unsigned int current_color;
   unsigned char compress_masks[6][4] = { { 0xFF, 0xFF, 0xFF, 0xFF }, { 0xFE, 0xFF, 0xFE, 0xFE },
     { 0xFC, 0xFE, 0xFC, 0xFC }, { 0xF8, 0xFC, 0xF8, 0xF8 }, { 0xF0, 0xF8, 0xF0, 0xF0 },
     { 0xE0, 0xF0, 0xE0, 0xE0 } };
 
-  if (compress_level < 0 || compress_level > 5)
-  {
-    vtkErrorMacro("Squirt compression level (" << compress_level << ") is out of range [0,5].");
-    compress_level = 1;
-  }
-
   // Set bitmask based on compress_level
   unsigned int compress_mask;
   // I shifted the level by one so that 0 means no compression.
   memcpy(&compress_mask, &compress_masks[compress_level], 4);
+  return compress_mask;
+}
 
-  // Access raw arrays directly
-  if (input->GetNumberOfComponents() == 4)
+// RLE-encodes `numPixels` RGBA pixels. `_rawCompressedBuffer` must have room
+// for `numPixels` words. Returns the number of words written.
+int EncodeRGBA(
+  const unsigned int* _rawColorBuffer, int numPixels, unsigned int compress_mask,
+  unsigned int* _rawCompressedBuffer)
+{
+  int count = 0;
+  int index = 0;
+  int comp_index = 0;
+  int end_index = numPixels;
+  unsigned int current_color;
+
+  // Go through color buffer and put RLE format into compressed buffer
+  while ((index < end_index) && (comp_index < end_index))
   {
-    unsigned int* _rawColorBuffer;
-    unsigned int* _rawCompressedBuffer;
-    int numPixels = input->GetNumberOfTuples();
-    _rawColorBuffer = (unsigned int*)input->GetPointer(0);
-    _rawCompressedBuffer = (unsigned int*)this->Output->WritePointer(0, numPixels * 4);
-    end_index = numPixels;
-
-    // Go through color buffer and put RLE format into compressed buffer
-    while ((index < end_index) && (comp_index < end_index))
-    {
 
-      // Record color
-      current_color = _rawCompressedBuffer[comp_index] = _rawColorBuffer[index];
-      unsigned char opacity = *(((unsigned char*)&current_color) + 3);
-      index++;
+    // Record color
+    current_color = _rawCompressedBuffer[comp_index] = _rawColorBuffer[index];
+    unsigned char opacity = *(((unsigned char*)&current_color) + 3);
+    index++;
 
-      // Compute Run
-      while ((index < end_index) && (count < 0x0F) &&
-        ((current_color & compress_mask) == (_rawColorBuffer[index] & compress_mask)))
-      {
-        index++;
-        count++;
-      }
-      if (opacity > 0)
-      {
-        opacity /= 16; // since we want to encode 8-bit opacity into 4 bits.
-        opacity = opacity << 4;
-        count |= opacity;
-      }
+    // Compute Run
+    while ((index < end_index) && (count < 0x0F) &&
+      ((current_color & compress_mask) == (_rawColorBuffer[index] & compress_mask)))
+    {
+      index++;
+      count++;
+    }
+    if (opacity > 0)
+    {
+      opacity /= 16; // since we want to encode 8-bit opacity into 4 bits.
+      opacity = opacity << 4;
+      count |= opacity;
+    }
 
-      // Record Run length
-      *((unsigned char*)_rawCompressedBuffer + comp_index * 4 + 3) = (unsigned char)count;
-      comp_index++;
+    // Record Run length
+    *((unsigned char*)_rawCompressedBuffer + comp_index * 4 + 3) = (unsigned char)count;
+    comp_index++;
 
-      count = 0;
-    }
+    count = 0;
   }
-  else if (input->GetNumberOfComponents() == 3)
+  return comp_index;
+}
+
+// RLE-encodes `numPixels` RGB pixels. `_rawCompressedBuffer` must have room
+// for `numPixels` words. Returns the number of words written.
+int EncodeRGB(const unsigned char* _rawColorBuffer, int numPixels, unsigned int compress_mask,
+  unsigned int* _rawCompressedBuffer)
+{
+  int count = 0;
+  int index = 0;
+  int comp_index = 0;
+  int end_index = numPixels;
+  unsigned int current_color;
+
+  // Go through color buffer and put RLE format into compressed buffer
+  while ((index < 3 * numPixels) && (comp_index < end_index))
   {
-    unsigned char* _rawColorBuffer;
-    unsigned int* _rawCompressedBuffer;
-    int numPixels = input->GetNumberOfTuples();
-    _rawColorBuffer = (unsigned char*)input->GetPointer(0);
-    _rawCompressedBuffer = (unsigned int*)this->Output->WritePointer(0, numPixels * 4);
-    end_index = numPixels;
-
-    // Go through color buffer and put RLE format into compressed buffer
-    while ((index < 3 * numPixels) && (comp_index < end_index))
-    {
 
-      int next_color = 0;
-      // Record color
-      unsigned char* p = (unsigned char*)&current_color;
-      *p++ = _rawColorBuffer[index];
-      *p++ = _rawColorBuffer[index + 1];
-      *p++ = _rawColorBuffer[index + 2];
-      *p = 0x0;
+    int next_color = 0;
+    // Record color
+    unsigned char* p = (unsigned char*)&current_color;
+    *p++ = _rawColorBuffer[index];
+    *p++ = _rawColorBuffer[index + 1];
+    *p++ = _rawColorBuffer[index + 2];
+    *p = 0x0;
 
-      _rawCompressedBuffer[comp_index] = current_color;
-      index += 3;
+    _rawCompressedBuffer[comp_index] = current_color;
+    index += 3;
 
+    if (index < 3 * numPixels)
+    {
       p = (unsigned char*)&next_color;
       *p++ = _rawColorBuffer[index];
       *p++ = _rawColorBuffer[index + 1];
       *p++ = _rawColorBuffer[index + 2];
       *p = 0x0;
+    }
 
-      // Compute Run
-      while (((current_color & compress_mask) == (next_color & compress_mask)) &&
-        (index < 3 * numPixels) && (count < 255))
+    // Compute Run
+    while (((current_color & compress_mask) == (next_color & compress_mask)) &&
+      (index < 3 * numPixels) && (count < 255))
+    {
+      index += 3;
+      count++;
+      if (index < 3 * numPixels)
       {
-        index += 3;
-        count++;
-        if (index < 3 * numPixels)
-        {
-          p = (unsigned char*)&next_color;
-          *p++ = _rawColorBuffer[index];
-          *p++ = _rawColorBuffer[index + 1];
-          *p++ = _rawColorBuffer[index + 2];
-          *p = 0x0;
-        }
+        p = (unsigned char*)&next_color;
+        *p++ = _rawColorBuffer[index];
+        *p++ = _rawColorBuffer[index + 1];
+        *p++ = _rawColorBuffer[index + 2];
+        *p = 0x0;
       }
-
-      // Record Run length
-      reinterpret_cast<unsigned char*>(_rawCompressedBuffer)[comp_index * 4 + 3] =
-        static_cast<unsigned char>(count);
-      comp_index++;
-
-      count = 0;
     }
-  }
-
-  // Back to vtk arrays :)
-  this->Output->SetNumberOfComponents(1);
-  this->Output->SetNumberOfTuples(4 * comp_index);
 
-  return VTK_OK;
-}
+    // Record Run length
+    reinterpret_cast<unsigned char*>(_rawCompressedBuffer)[comp_index * 4 + 3] =
+      static_cast<unsigned char>(count);
+    comp_index++;
 
-//-----------------------------------------------------------------------------
-int vtkSquirtCompressor::Decompress()
-{
-  if (!(this->Input && this->Output))
-  {
-    vtkWarningMacro("Cannot decompress empty input or output detected.");
-    return VTK_ERROR;
-  }
-
-  vtkUnsignedCharArray* out = this->GetOutput();
-
-  // We assume that 'out' has exactly the same number of component set as the
-  // input before compression.
-  switch (out->GetNumberOfComponents())
-  {
-    case 3:
-      return this->DecompressRGB();
-    case 4:
-      return this->DecompressRGBA();
-
-    default:
-      vtkErrorMacro("SQUIRT only support 3 or 4 component arrays.");
-      return VTK_ERROR;
+    count = 0;
   }
+  return comp_index;
 }
 
-//-----------------------------------------------------------------------------
-int vtkSquirtCompressor::DecompressRGBA()
+// Decodes `CompSize` words into at most `numPixels` RGBA pixels. Returns
+// false if the runs do not fit.
+bool DecodeRGBA(const unsigned int* _rawCompressedBuffer, int CompSize,
+  unsigned int* _rawColorBuffer, vtkIdType numPixels)
 {
-  vtkUnsignedCharArray* in = this->GetInput();
-  vtkUnsignedCharArray* out = this->GetOutput();
-  assert(out->GetNumberOfComponents() == 4);
-
   int count = 0;
-  int index = 0;
+  vtkIdType index = 0;
   unsigned int current_color;
-  unsigned int* _rawColorBuffer;
-  unsigned int* _rawCompressedBuffer;
-
-  // Get compressed buffer size
-  int CompSize = in->GetNumberOfTuples() / 4; /// NOTE 1->4
-
-  // Access raw arrays directly
-  _rawColorBuffer = (unsigned int*)out->GetPointer(0);
-  _rawCompressedBuffer = (unsigned int*)in->GetPointer(0);
 
   // Go through compress buffer and extract RLE format into color buffer
   for (int i = 0; i < CompSize; i++)
@@ -229,6 +175,11 @@ int vtkSquirtCompressor::DecompressRGBA()
     }
     count &= 0x0F;
 
+    if (index + count + 1 > numPixels)
+    {
+      return false;
+    }
+
     // Set color
     _rawColorBuffer[index++] = current_color;
 
@@ -238,27 +189,17 @@ int vtkSquirtCompressor::DecompressRGBA()
       _rawColorBuffer[index++] = current_color;
     }
   }
-  return VTK_OK;
+  return true;
 }
 
-//-----------------------------------------------------------------------------
-int vtkSquirtCompressor::DecompressRGB()
+// Decodes `CompSize` words into at most `numPixels` RGB pixels. Returns
+// false if the runs do not fit.
+bool DecodeRGB(const unsigned int* _rawCompressedBuffer, int CompSize,
+  unsigned char* _rawColorBuffer, vtkIdType numPixels)
 {
-  vtkUnsignedCharArray* in = this->GetInput();
-  vtkUnsignedCharArray* out = this->GetOutput();
-  assert(out->GetNumberOfComponents() == 3);
-
   int count = 0;
+  vtkIdType index = 0;
   unsigned int current_color;
-  unsigned char* _rawColorBuffer;
-  unsigned int* _rawCompressedBuffer;
-
-  // Get compressed buffer size
-  int CompSize = in->GetNumberOfTuples() / 4; /// NOTE 1->4
-
-  // Access raw arrays directly
-  _rawColorBuffer = (unsigned char*)out->GetPointer(0);
-  _rawCompressedBuffer = (unsigned int*)in->GetPointer(0);
 
   // Go through compress buffer and extract RLE format into color buffer
   for (int i = 0; i < CompSize; i++)
@@ -271,6 +212,12 @@ int vtkSquirtCompressor::DecompressRGB()
 
     *((unsigned char*)&current_color + 3) = 0xff;
 
+    if (index + count + 1 > numPixels)
+    {
+      return false;
+    }
+    index += count + 1;
+
     unsigned char current_color_rgb[3];
     std::copy(reinterpret_cast<const unsigned char*>(&current_color),
       reinterpret_cast<const unsigned char*>(&current_color) + 3, current_color_rgb);
@@ -282,9 +229,178 @@ int vtkSquirtCompressor::DecompressRGB()
       _rawColorBuffer += 3;
     }
   }
+  return true;
+}
+}
+
+//-----------------------------------------------------------------------------
+int vtkSquirtCompressor::Compress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  vtkUnsignedCharArray* input = this->GetInput();
+
+  if (input->GetNumberOfComponents() != 4 && input->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro("Squirt only works with RGBA or RGB");
+    return VTK_ERROR;
+  }
+
+  int compress_level = this->LossLessMode ? 0 : this->SquirtLevel;
+  if (compress_level < 0 || compress_level > 5)
+  {
+    vtkErrorMacro("Squirt compression level (" << compress_level << ") is out of range [0,5].");
+    compress_level = 1;
+  }
+
+  // Large images are split in strips compressed in parallel.
+  const int numStrips = this->ComputeNumberOfStrips(input->GetNumberOfTuples());
+  if (numStrips > 1)
+  {
+    this->StripCompressLevel = compress_level;
+    return this->CompressStrips(numStrips);
+  }
+
+  const unsigned int compress_mask = ::GetCompressMask(compress_level);
+  int numPixels = input->GetNumberOfTuples();
+  unsigned int* _rawCompressedBuffer =
+    (unsigned int*)this->Output->WritePointer(0, numPixels * 4);
+  int comp_index = 0;
+
+  // Access raw arrays directly
+  if (input->GetNumberOfComponents() == 4)
+  {
+    comp_index = ::EncodeRGBA(
+      (unsigned int*)input->GetPointer(0), numPixels, compress_mask, _rawCompressedBuffer);
+  }
+  else if (input->GetNumberOfComponents() == 3)
+  {
+    comp_index = ::EncodeRGB(input->GetPointer(0), numPixels, compress_mask, _rawCompressedBuffer);
+  }
+
+  // Back to vtk arrays :)
+  this->Output->SetNumberOfComponents(1);
+  this->Output->SetNumberOfTuples(4 * comp_index);
+
   return VTK_OK;
 }
 
+//-----------------------------------------------------------------------------
+int vtkSquirtCompressor::Decompress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  vtkUnsignedCharArray* out = this->GetOutput();
+  if (out->GetNumberOfComponents() == 3 || out->GetNumberOfComponents() == 4)
+  {
+    if (vtkImageCompressor::IsStripContainer(this->Input))
+    {
+      return this->DecompressStrips();
+    }
+  }
+
+  // We assume that 'out' has exactly the same number of component set as the
+  // input before compression.
+  switch (out->GetNumberOfComponents())
+  {
+    case 3:
+      return this->DecompressRGB();
+    case 4:
+      return this->DecompressRGBA();
+
+    default:
+      vtkErrorMacro("SQUIRT only support 3 or 4 component arrays.");
+      return VTK_ERROR;
+  }
+}
+
+//-----------------------------------------------------------------------------
+int vtkSquirtCompressor::DecompressRGBA()
+{
+  vtkUnsignedCharArray* in = this->GetInput();
+  vtkUnsignedCharArray* out = this->GetOutput();
+  assert(out->GetNumberOfComponents() == 4);
+
+  // Get compressed buffer size
+  int CompSize = in->GetNumberOfTuples() / 4; /// NOTE 1->4
+
+  // Access raw arrays directly
+  if (!::DecodeRGBA((unsigned int*)in->GetPointer(0), CompSize,
+        (unsigned int*)out->GetPointer(0), out->GetNumberOfTuples()))
+  {
+    vtkErrorMacro("Compressed data does not fit in the output.");
+    return VTK_ERROR;
+  }
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+int vtkSquirtCompressor::DecompressRGB()
+{
+  vtkUnsignedCharArray* in = this->GetInput();
+  vtkUnsignedCharArray* out = this->GetOutput();
+  assert(out->GetNumberOfComponents() == 3);
+
+  // Get compressed buffer size
+  int CompSize = in->GetNumberOfTuples() / 4; /// NOTE 1->4
+
+  // Access raw arrays directly
+  if (!::DecodeRGB((unsigned int*)in->GetPointer(0), CompSize, out->GetPointer(0),
+        out->GetNumberOfTuples()))
+  {
+    vtkErrorMacro("Compressed data does not fit in the output.");
+    return VTK_ERROR;
+  }
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSquirtCompressor::CompressStrip(const unsigned char* input, vtkIdType numPixels,
+  int numComps, std::vector<unsigned char>& output)
+{
+  const unsigned int compress_mask = ::GetCompressMask(this->StripCompressLevel);
+
+  // words are used to hold both the RLE output and its alignment.
+  std::vector<unsigned int> words(static_cast<size_t>(numPixels));
+  int comp_index = 0;
+  if (numComps == 4)
+  {
+    comp_index = ::EncodeRGBA(reinterpret_cast<const unsigned int*>(input),
+      static_cast<int>(numPixels), compress_mask, words.data());
+  }
+  else
+  {
+    comp_index = ::EncodeRGB(input, static_cast<int>(numPixels), compress_mask, words.data());
+  }
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(words.data());
+  output.assign(bytes, bytes + 4 * static_cast<size_t>(comp_index));
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSquirtCompressor::DecompressStrip(const unsigned char* input, size_t inputSize,
+  unsigned char* output, vtkIdType numPixels, int numComps)
+{
+  // strips are not 4-byte aligned in the container.
+  std::vector<unsigned int> words(inputSize / 4);
+  memcpy(words.data(), input, 4 * words.size());
+  const int CompSize = static_cast<int>(words.size());
+  if (numComps == 4)
+  {
+    return ::DecodeRGBA(
+      words.data(), CompSize, reinterpret_cast<unsigned int*>(output), numPixels);
+  }
+  return ::DecodeRGB(words.data(), CompSize, output, numPixels);
+}
+
 //-----------------------------------------------------------------------------
 void vtkSquirtCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
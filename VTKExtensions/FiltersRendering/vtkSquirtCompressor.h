@@ -84,8 +84,21 @@ protected:
   int DecompressRGB();
   int DecompressRGBA();
 
+  ///@{
+  /**
+   * Compress/Decompress a single strip, see vtkImageCompressor::NumberOfStrips.
+   */
+  bool CompressStrip(const unsigned char* input, vtkIdType numPixels, int numComps,
+    std::vector<unsigned char>& output) override;
+  bool DecompressStrip(const unsigned char* input, size_t inputSize, unsigned char* output,
+    vtkIdType numPixels, int numComps) override;
+  ///@}
+
   int SquirtLevel;
 
+  // Level validated by Compress() and used by CompressStrip().
+  int StripCompressLevel = 0;
+
 private:
   vtkSquirtCompressor(const vtkSquirtCompressor&) = delete;
   void operator=(const vtkSquirtCompressor&) = delete;
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkFileSeriesReader.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkTestUtilities.h"
+#include "vtkThreadedCallbackQueue.h"
+#include "vtksys/FStream.hxx"
+
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Exposes the prefetching of vtkFileSeriesReader, without any internal reader.
+class vtkTestFileSeriesReader : public vtkFileSeriesReader
+{
+public:
+  static vtkTestFileSeriesReader* New();
+  vtkTypeMacro(vtkTestFileSeriesReader, vtkFileSeriesReader);
+
+  void SetFileNames(const std::vector<std::string>& fileNames)
+  {
+    this->RemoveAllFileNames();
+    for (const auto& fileName : fileNames)
+    {
+      this->AddFileName(fileName.c_str());
+    }
+    this->UpdateMetaData();
+  }
+
+  // Blocks the prefetch thread until `gate` is ready, so that the reads
+  // scheduled meanwhile are pending.
+  void BlockPrefetch(std::shared_future<void> gate)
+  {
+    this->GetPrefetchQueue()->Push([gate]() { gate.wait(); });
+  }
+
+  using vtkFileSeriesReader::GetCachedPrefetchIndices;
+  using vtkFileSeriesReader::GetScheduledPrefetchIndices;
+  using vtkFileSeriesReader::PrefetchFiles;
+  using vtkFileSeriesReader::WaitForPrefetch;
+
+protected:
+  vtkTestFileSeriesReader() = default;
+  ~vtkTestFileSeriesReader() override = default;
+
+private:
+  vtkTestFileSeriesReader(const vtkTestFileSeriesReader&) = delete;
+  void operator=(const vtkTestFileSeriesReader&) = delete;
+};
+vtkStandardNewMacro(vtkTestFileSeriesReader);
+
+std::vector<std::string> WriteFiles(const std::string& prefix, int count)
+{
+  std::vector<std::string> fileNames;
+  for (int cc = 0; cc < count; ++cc)
+  {
+    fileNames.push_back(prefix + std::to_string(cc) + ".txt");
+    vtksys::ofstream file(fileNames.back().c_str());
+    file << "file " << cc << std::endl;
+  }
+  return fileNames;
+}
+
+bool Check(const std::vector<int>& indices, const std::vector<int>& expected, const char* what)
+{
+  if (indices != expected)
+  {
+    std::cerr << "ERROR: wrong " << what << ":";
+    for (int index : indices)
+    {
+      std::cerr << " " << index;
+    }
+    std::cerr << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+extern int TestFileSeriesReaderPrefetch(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string prefix = std::string(tempDir) + "/TestFileSeriesReaderPrefetch_";
+  delete[] tempDir;
+
+  vtkNew<vtkTestFileSeriesReader> reader;
+  reader->SetFileNames(WriteFiles(prefix, 10));
+  vtkFileSeriesReader::SetNumberOfPrefetchedFiles(3);
+
+  // The files ahead of the one read are scheduled and read, and only the
+  // ones not scheduled yet are read when moving to the next file.
+  reader->PrefetchFiles(0);
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), { 1, 2, 3 }, "scheduled files") ||
+    !Check(reader->GetCachedPrefetchIndices(), { 1, 2, 3 }, "read files"))
+  {
+    return EXIT_FAILURE;
+  }
+  reader->PrefetchFiles(1);
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), { 2, 3, 4 }, "scheduled files") ||
+    !Check(reader->GetCachedPrefetchIndices(), { 2, 3, 4 }, "read files"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Reads pending when the direction of play changes are cancelled.
+  std::promise<void> directionGate;
+  reader->BlockPrefetch(directionGate.get_future().share());
+  reader->PrefetchFiles(5);
+  if (!Check(reader->GetScheduledPrefetchIndices(), { 6, 7, 8 }, "scheduled files"))
+  {
+    return EXIT_FAILURE;
+  }
+  reader->PrefetchFiles(4);
+  directionGate.set_value();
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), { 1, 2, 3 }, "scheduled files backwards") ||
+    !Check(reader->GetCachedPrefetchIndices(), { 1, 2, 3 }, "read files backwards"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The window is clamped to the first file.
+  reader->PrefetchFiles(1);
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), { 0 }, "scheduled files at the start") ||
+    !Check(reader->GetCachedPrefetchIndices(), { 0 }, "read files at the start"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Reads pending when the list of files changes are cancelled, and reading
+  // the new files starts forward.
+  std::promise<void> listGate;
+  reader->BlockPrefetch(listGate.get_future().share());
+  reader->PrefetchFiles(8);
+  reader->SetFileNames(WriteFiles(prefix + "other_", 4));
+  listGate.set_value();
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), {}, "scheduled files for the new list") ||
+    !Check(reader->GetCachedPrefetchIndices(), {}, "read files for the new list"))
+  {
+    return EXIT_FAILURE;
+  }
+  reader->PrefetchFiles(2);
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), { 3 }, "scheduled files at the end") ||
+    !Check(reader->GetCachedPrefetchIndices(), { 3 }, "read files at the end"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Nothing is prefetched when disabled.
+  vtkFileSeriesReader::SetNumberOfPrefetchedFiles(0);
+  reader->SetFileNames(WriteFiles(prefix, 10));
+  reader->PrefetchFiles(0);
+  reader->WaitForPrefetch();
+  if (!Check(reader->GetScheduledPrefetchIndices(), {}, "scheduled files when disabled"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
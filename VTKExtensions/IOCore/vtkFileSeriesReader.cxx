@@ -18,6 +18,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
+#include "vtkThreadedCallbackQueue.h"
 #include "vtkTypeTraits.h"
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
@@ -26,9 +27,11 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <atomic>
 #include <cctype> // for isprint().
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -40,6 +43,7 @@ vtkStandardNewMacro(vtkFileSeriesReader);
 vtkInformationKeyMacro(vtkFileSeriesReader, FILE_SERIES_NUMBER_OF_FILES, Integer);
 vtkInformationKeyMacro(vtkFileSeriesReader, FILE_SERIES_CURRENT_FILE_NUMBER, Integer);
 vtkInformationKeyMacro(vtkFileSeriesReader, FILE_SERIES_FIRST_FILENAME, String);
+int vtkFileSeriesReader::NumberOfPrefetchedFiles = 0;
 //=============================================================================
 // Internal class for holding time ranges.
 class vtkFileSeriesReaderTimeRanges
@@ -359,6 +363,21 @@ public:
 private:
   void operator=(const vtkRecordMTime&);
 };
+
+// Reads a file and discards its contents, so that the operating system caches
+// it. Gives up as soon as `generation` is no longer the current generation.
+// Returns true if the whole file was read.
+bool ReadFileToCache(
+  const std::string& fileName, int generation, const std::atomic<int>& currentGeneration)
+{
+  vtksys::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+  std::vector<char> buffer(4 << 20);
+  while (file && generation == currentGeneration)
+  {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  }
+  return file.eof() && generation == currentGeneration;
+}
 }
 
 //=============================================================================
@@ -369,6 +388,26 @@ struct vtkFileSeriesReaderInternals
   std::vector<double> TimeValues;
   bool FileNameIsSet;
   vtkFileSeriesReaderTimeRanges* TimeRanges;
+
+  // Background prefetching, see vtkFileSeriesReader::SetNumberOfPrefetchedFiles().
+  // Prefetch tasks stop when PrefetchGeneration changes. CachedIndices, the
+  // files read by these tasks, is guarded by PrefetchMutex. The other members
+  // are only used from the main thread.
+  vtkSmartPointer<vtkThreadedCallbackQueue> PrefetchQueue;
+  std::atomic<int> PrefetchGeneration{ 0 };
+  std::set<int> ScheduledIndices;
+  std::set<int> CachedIndices;
+  std::mutex PrefetchMutex;
+  int LastReadIndex = -1;
+  int PlayDirection = 1;
+
+  void ResetPrefetch()
+  {
+    std::lock_guard<std::mutex> lock(this->PrefetchMutex);
+    ++this->PrefetchGeneration;
+    this->ScheduledIndices.clear();
+    this->CachedIndices.clear();
+  }
 };
 
 //=============================================================================
@@ -390,6 +429,9 @@ vtkFileSeriesReader::vtkFileSeriesReader()
 //-----------------------------------------------------------------------------
 vtkFileSeriesReader::~vtkFileSeriesReader()
 {
+  // stop pending prefetch tasks and wait for the running one.
+  ++this->Internal->PrefetchGeneration;
+  this->Internal->PrefetchQueue = nullptr;
   delete this->Internal->TimeRanges;
   delete this->Internal;
 }
@@ -733,11 +775,151 @@ int vtkFileSeriesReader::RequestData(
   {
     // Now restore the information.
     this->Internal->TimeRanges->GetAggregateTimeInfo(outInfo);
+
+    // Files of serial formats are only read for the first piece, and the
+    // other ranks read at most the small meta files of partitioned formats.
+    // Prefetching on every rank would multiply the reads of each file by the
+    // number of ranks, so only the first piece prefetches.
+    const int piece = outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER())
+      ? outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER())
+      : 0;
+    if (piece == 0)
+    {
+      this->PrefetchFiles(this->_FileIndex);
+    }
   }
 
   return retVal;
 }
 
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::SetNumberOfPrefetchedFiles(int count)
+{
+  vtkFileSeriesReader::NumberOfPrefetchedFiles = std::max(count, 0);
+}
+
+//-----------------------------------------------------------------------------
+int vtkFileSeriesReader::GetNumberOfPrefetchedFiles()
+{
+  return vtkFileSeriesReader::NumberOfPrefetchedFiles;
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::PrefetchFiles(int index)
+{
+  auto& internals = *this->Internal;
+  const int count = vtkFileSeriesReader::NumberOfPrefetchedFiles;
+  if (count <= 0 || index < 0)
+  {
+    return;
+  }
+
+  if (internals.LastReadIndex >= 0 && index != internals.LastReadIndex)
+  {
+    const int direction = index > internals.LastReadIndex ? 1 : -1;
+    if (direction != internals.PlayDirection)
+    {
+      // files ahead in the previous direction are not needed anymore.
+      internals.ResetPrefetch();
+      internals.PlayDirection = direction;
+    }
+  }
+  internals.LastReadIndex = index;
+
+  // Forget files that are not ahead anymore, so that they are read again if
+  // they are needed later: the operating system may have evicted them.
+  const int first = internals.PlayDirection > 0 ? index + 1 : index - count;
+  const int last = internals.PlayDirection > 0 ? index + count : index - 1;
+  auto prune = [first, last](std::set<int>& indices)
+  {
+    for (auto iter = indices.begin(); iter != indices.end();)
+    {
+      iter = (*iter < first || *iter > last) ? indices.erase(iter) : ++iter;
+    }
+  };
+  prune(internals.ScheduledIndices);
+  {
+    std::lock_guard<std::mutex> lock(internals.PrefetchMutex);
+    prune(internals.CachedIndices);
+  }
+
+  const int numFiles = static_cast<int>(this->GetNumberOfFileNames());
+  std::vector<std::pair<int, std::string>> files;
+  for (int cc = 1; cc <= count; ++cc)
+  {
+    const int next = index + cc * internals.PlayDirection;
+    if (next < 0 || next >= numFiles)
+    {
+      break;
+    }
+    if (internals.ScheduledIndices.insert(next).second)
+    {
+      files.emplace_back(next, this->GetFileName(static_cast<unsigned int>(next)));
+    }
+  }
+  if (files.empty())
+  {
+    return;
+  }
+
+  vtkLogF(TRACE, "%s: prefetching %d file(s) after file %d", vtkLogIdentifier(this),
+    static_cast<int>(files.size()), index);
+  const int generation = internals.PrefetchGeneration;
+  vtkFileSeriesReaderInternals* internalsPtr = this->Internal;
+  this->GetPrefetchQueue()->Push(
+    [files, generation, internalsPtr]()
+    {
+      for (const auto& file : files)
+      {
+        if (::ReadFileToCache(file.second, generation, internalsPtr->PrefetchGeneration))
+        {
+          std::lock_guard<std::mutex> lock(internalsPtr->PrefetchMutex);
+          if (generation == internalsPtr->PrefetchGeneration)
+          {
+            internalsPtr->CachedIndices.insert(file.first);
+          }
+        }
+      }
+    });
+}
+
+//-----------------------------------------------------------------------------
+vtkThreadedCallbackQueue* vtkFileSeriesReader::GetPrefetchQueue()
+{
+  auto& internals = *this->Internal;
+  if (!internals.PrefetchQueue)
+  {
+    internals.PrefetchQueue = vtkSmartPointer<vtkThreadedCallbackQueue>::New();
+    internals.PrefetchQueue->SetNumberOfThreads(1);
+  }
+  return internals.PrefetchQueue;
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::WaitForPrefetch()
+{
+  if (this->Internal->PrefetchQueue)
+  {
+    // tasks run in order on a single thread.
+    this->Internal->PrefetchQueue->Push([]() {})->Wait();
+  }
+}
+
+//-----------------------------------------------------------------------------
+std::vector<int> vtkFileSeriesReader::GetScheduledPrefetchIndices()
+{
+  const auto& indices = this->Internal->ScheduledIndices;
+  return std::vector<int>(indices.begin(), indices.end());
+}
+
+//-----------------------------------------------------------------------------
+std::vector<int> vtkFileSeriesReader::GetCachedPrefetchIndices()
+{
+  std::lock_guard<std::mutex> lock(this->Internal->PrefetchMutex);
+  const auto& indices = this->Internal->CachedIndices;
+  return std::vector<int>(indices.begin(), indices.end());
+}
+
 //-----------------------------------------------------------------------------
 int vtkFileSeriesReader::RequestInformationForInput(
   int index, vtkInformation* request, vtkInformationVector* outputVector)
@@ -972,6 +1154,10 @@ void vtkFileSeriesReader::UpdateMetaData()
     this->CopyRealFileNamesFromFileNames();
   }
 
+  // indices of prefetched files may now refer to other files.
+  this->Internal->ResetPrefetch();
+  this->Internal->LastReadIndex = -1;
+  this->Internal->PlayDirection = 1;
   this->MetaFileReadTime.Modified();
 }
 
@@ -1000,6 +1186,8 @@ void vtkFileSeriesReader::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "UseMetaFile: " << this->UseMetaFile << endl;
   os << indent << "IgnoreReaderTime: " << this->IgnoreReaderTime << endl;
+  os << indent << "NumberOfPrefetchedFiles: " << vtkFileSeriesReader::NumberOfPrefetchedFiles
+     << endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -55,6 +55,10 @@
  * with SetMetaFileName in this case. Do not use the AddFileName() method when
  * using SetMetaFileName() as names set with AddFileName() will be ignored.
  *
+ * When SetNumberOfPrefetchedFiles() is used, the next files in the direction
+ * of play are read on a background thread after each file is read, on the
+ * process reading the first piece only.
+ *
 */
 
 #ifndef vtkFileSeriesReader_h
@@ -68,6 +72,7 @@
 class vtkInformationIntegerKey;
 class vtkInformationStringKey;
 class vtkStringArray;
+class vtkThreadedCallbackQueue;
 
 struct vtkFileSeriesReaderInternals;
 
@@ -151,6 +156,22 @@ public:
    */
   unsigned long GetErrorCode() override;
 
+  ///@{
+  /**
+   * Number of files, following the file that was just read in the direction of
+   * play, that are read on a background thread. Their contents are discarded:
+   * this only loads them in the operating system file cache, so that the
+   * internal reader reads the next time steps from memory rather than from
+   * disk. This helps when reading a file takes longer than processing it, for
+   * example on parallel file systems. Only the process reading the first
+   * piece prefetches files, since the other ones read at most the meta files
+   * of partitioned formats. Applies to all file series readers.
+   * Default is 0, which disables prefetching.
+   */
+  static void SetNumberOfPrefetchedFiles(int count);
+  static int GetNumberOfPrefetchedFiles();
+  ///@}
+
 protected:
   vtkFileSeriesReader();
   ~vtkFileSeriesReader() override;
@@ -227,11 +248,40 @@ protected:
 
   int ChooseInput(vtkInformation*);
 
+  /**
+   * Schedules the background read of the files following `index` in the
+   * direction of play. Called after the file at `index` is read. Reads still
+   * pending are cancelled when the direction of play or the list of files
+   * changes.
+   */
+  void PrefetchFiles(int index);
+
+  /**
+   * The single-threaded queue on which files are prefetched.
+   */
+  vtkThreadedCallbackQueue* GetPrefetchQueue();
+
+  /**
+   * Waits until the files scheduled for prefetching are read or cancelled.
+   */
+  void WaitForPrefetch();
+
+  ///@{
+  /**
+   * Indices of the files ahead of the last file read that are scheduled for
+   * prefetching, and of those among them that were read.
+   */
+  std::vector<int> GetScheduledPrefetchIndices();
+  std::vector<int> GetCachedPrefetchIndices();
+  ///@}
+
 private:
   vtkFileSeriesReader(const vtkFileSeriesReader&) = delete;
   void operator=(const vtkFileSeriesReader&) = delete;
 
   vtkFileSeriesReaderInternals* Internal;
+
+  static int NumberOfPrefetchedFiles;
 };
 
 #endif
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDataSet.h"
+#include "vtkDummyController.h"
+#include "vtkGenericEnSightReader.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPEnSightGoldBinaryReader.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<vtkDataSet*> GetLeaves(vtkMultiBlockDataSet* data)
+{
+  std::vector<vtkDataSet*> leaves;
+  vtkSmartPointer<vtkDataObjectTreeIterator> iter;
+  iter.TakeReference(data->NewTreeIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    leaves.push_back(vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()));
+  }
+  return leaves;
+}
+}
+
+// Reads an EnSight Gold binary file with vtkPEnSightGoldBinaryReader, which
+// decodes coordinates straight from the memory mapped file, and compares the
+// points with the ones read by VTK's stream based reader.
+extern int TestPEnSightGoldBinaryMappedReader(int argc, char* argv[])
+{
+  char* fname =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/EnSight/TEST_bin.case");
+  const std::string path = vtksys::SystemTools::GetFilenamePath(fname);
+  const std::string caseName = vtksys::SystemTools::GetFilenameName(fname);
+  delete[] fname;
+
+  // A single process reads all the points.
+  vtkNew<vtkDummyController> controller;
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  vtkNew<vtkPEnSightGoldBinaryReader> reader;
+  reader->SetFilePath(path.c_str());
+  reader->SetCaseFileName(caseName.c_str());
+  reader->Update();
+
+  vtkNew<vtkGenericEnSightReader> reference;
+  reference->SetFilePath(path.c_str());
+  reference->SetCaseFileName(caseName.c_str());
+  reference->Update();
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+
+  const auto leaves = GetLeaves(reader->GetOutput());
+  const auto expectedLeaves = GetLeaves(reference->GetOutput());
+  if (leaves.empty() || leaves.size() != expectedLeaves.size())
+  {
+    std::cerr << "Expected " << expectedLeaves.size() << " parts, got " << leaves.size() << "."
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The parallel reader only keeps the points used by its cells, possibly in
+  // another order, so each of its points must be one of the expected ones.
+  for (size_t part = 0; part < leaves.size(); ++part)
+  {
+    vtkDataSet* ds = leaves[part];
+    vtkDataSet* expected = expectedLeaves[part];
+    if (!ds || !expected || ds->GetNumberOfPoints() == 0 ||
+      ds->GetNumberOfPoints() > expected->GetNumberOfPoints())
+    {
+      std::cerr << "Wrong number of points in part " << part << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    std::set<std::array<double, 3>> expectedPoints;
+    for (vtkIdType cc = 0; cc < expected->GetNumberOfPoints(); ++cc)
+    {
+      std::array<double, 3> pt;
+      expected->GetPoint(cc, pt.data());
+      expectedPoints.insert(pt);
+    }
+    for (vtkIdType cc = 0; cc < ds->GetNumberOfPoints(); ++cc)
+    {
+      std::array<double, 3> pt;
+      ds->GetPoint(cc, pt.data());
+      if (expectedPoints.count(pt) == 0)
+      {
+        std::cerr << "Point " << cc << " of part " << part << " (" << pt[0] << ", " << pt[1]
+                  << ", " << pt[2] << ") was not decoded correctly." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
+    double bounds[6], expectedBounds[6];
+    ds->GetBounds(bounds);
+    expected->GetBounds(expectedBounds);
+    for (int i = 0; i < 6; ++i)
+    {
+      if (bounds[i] != expectedBounds[i])
+      {
+        std::cerr << "Wrong bounds for part " << part << "." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,185 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPEnSightReader.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+using IdMap = vtkPEnSightReader::vtkPEnSightReaderIdMap;
+
+// Checks the map against a plain vector with the same content.
+bool CheckMap(const IdMap& map, const std::vector<int>& expected)
+{
+  if (map.GetNumberOfIds() != static_cast<int>(expected.size()))
+  {
+    std::cerr << "Wrong number of ids: " << map.GetNumberOfIds() << " instead of "
+              << expected.size() << std::endl;
+    return false;
+  }
+  int numberOfLocalIds = 0;
+  for (int id = 0; id < static_cast<int>(expected.size()); ++id)
+  {
+    numberOfLocalIds += expected[id] != -1;
+    if (map.GetId(id) != expected[id])
+    {
+      std::cerr << "Wrong value for id " << id << ": " << map.GetId(id) << " instead of "
+                << expected[id] << std::endl;
+      return false;
+    }
+  }
+  if (map.GetNumberOfLocalIds() != numberOfLocalIds)
+  {
+    std::cerr << "Wrong number of local ids: " << map.GetNumberOfLocalIds() << " instead of "
+              << numberOfLocalIds << std::endl;
+    return false;
+  }
+
+  std::vector<int> range(expected.size() + 2);
+  map.GetIds(-1, static_cast<int>(range.size()), range.data());
+  for (size_t i = 0; i < range.size(); ++i)
+  {
+    const int expectedValue = (i > 0 && i <= expected.size()) ? expected[i - 1] : -1;
+    if (range[i] != expectedValue)
+    {
+      std::cerr << "Wrong value in range lookup at " << i << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Random inserts, overwrites and removals.
+bool TestRandom()
+{
+  std::srand(1);
+  for (int trial = 0; trial < 50; ++trial)
+  {
+    IdMap map;
+    std::vector<int> expected;
+    for (int op = 0; op < 2000; ++op)
+    {
+      const int value = (std::rand() % 4 == 0) ? -1 : std::rand() % 100000;
+      if (std::rand() % 2)
+      {
+        map.InsertNextId(value);
+        expected.push_back(value);
+      }
+      else
+      {
+        const int id = std::rand() % (static_cast<int>(expected.size()) + 100);
+        map.SetId(id, value);
+        if (id >= static_cast<int>(expected.size()))
+        {
+          expected.resize(id + 1, -1);
+        }
+        expected[id] = value;
+      }
+    }
+    if (!CheckMap(map, expected))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Mimics what one process of a distributed read of a part made of n^3
+// hexahedra stores, see vtkPEnSightReader::InsertNextCellAndId.
+bool TestDistributedHexahedra(int n, int numberOfProcesses, int processId)
+{
+  const int numberOfCells = n * n * n;
+  const int np = n + 1;
+  const int numberOfElements = numberOfCells / numberOfProcesses + 1;
+  const int begin = processId * numberOfElements;
+
+  IdMap pointIds;
+  IdMap cellIds;
+  std::vector<int> expectedPointIds;
+  std::vector<int> expectedCellIds;
+  int lastPointId = 0;
+  int lastCellId = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int cellId = 0; cellId < numberOfCells; ++cellId)
+  {
+    if (cellId < begin || cellId >= begin + numberOfElements)
+    {
+      cellIds.InsertNextId(-1);
+      expectedCellIds.push_back(-1);
+      continue;
+    }
+    const int i = cellId % n;
+    const int j = (cellId / n) % n;
+    const int k = cellId / (n * n);
+    const int points[8] = { i + np * (j + np * k), i + 1 + np * (j + np * k),
+      i + 1 + np * (j + 1 + np * k), i + np * (j + 1 + np * k), i + np * (j + np * (k + 1)),
+      i + 1 + np * (j + np * (k + 1)), i + 1 + np * (j + 1 + np * (k + 1)),
+      i + np * (j + 1 + np * (k + 1)) };
+    for (int pointId : points)
+    {
+      if (pointIds.GetId(pointId) == -1)
+      {
+        pointIds.SetId(pointId, lastPointId);
+        if (pointId >= static_cast<int>(expectedPointIds.size()))
+        {
+          expectedPointIds.resize(pointId + 1, -1);
+        }
+        expectedPointIds[pointId] = lastPointId++;
+      }
+    }
+    cellIds.InsertNextId(lastCellId);
+    expectedCellIds.push_back(lastCellId++);
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  // The previous storage was a vector of the global size.
+  const size_t vectorPointsSize = expectedPointIds.size() * sizeof(int);
+  const size_t vectorCellsSize = expectedCellIds.size() * sizeof(int);
+  std::cout << "Process " << processId << "/" << numberOfProcesses << ": " << lastCellId
+            << " cells, " << lastPointId << " points. Point ids: " << pointIds.GetMemorySize()
+            << " bytes (vector: " << vectorPointsSize << "), cell ids: " << cellIds.GetMemorySize()
+            << " bytes (vector: " << vectorCellsSize << "), " << elapsed.count() << " s"
+            << std::endl;
+
+  if (!CheckMap(pointIds, expectedPointIds) || !CheckMap(cellIds, expectedCellIds))
+  {
+    return false;
+  }
+  if (cellIds.GetMemorySize() > 1024)
+  {
+    std::cerr << "Cell ids of a contiguous range of cells should take a few bytes." << std::endl;
+    return false;
+  }
+  if (numberOfProcesses > 1 && processId > 0 && pointIds.GetMemorySize() * 2 > vectorPointsSize)
+  {
+    std::cerr << "Point ids are not compact." << std::endl;
+    return false;
+  }
+  if (pointIds.GetMemorySize() > 2 * vectorPointsSize)
+  {
+    std::cerr << "Point ids use much more memory than a vector." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+extern int TestPEnSightReaderIdMap(int, char*[])
+{
+  if (!TestRandom())
+  {
+    return EXIT_FAILURE;
+  }
+
+  const int n = 128;
+  bool success = TestDistributedHexahedra(n, 1, 0);
+  for (int processId : { 0, 15, 31 })
+  {
+    success &= TestDistributedHexahedra(n, 32, processId);
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -13,22 +13,205 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStringScanner.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <streambuf>
 #include <string>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 vtkStandardNewMacro(vtkPEnSightGoldBinaryReader);
 
 // This is half the precision of an int.
 #define MAXIMUM_PART_ID 65536
 
+namespace
+{
+// Arrays larger than this are byte swapped by several threads.
+constexpr vtkIdType SwapGrainSize = 65536;
+
+// Converts `count` 4-bytes words from the file byte order to the native one.
+template <typename T>
+void SwapRange(T* data, vtkIdType count, int byteOrder)
+{
+  auto swap = [data, byteOrder](vtkIdType begin, vtkIdType end)
+  {
+    if (byteOrder == vtkPEnSightReader::FILE_LITTLE_ENDIAN)
+    {
+      vtkByteSwap::Swap4LERange(data + begin, end - begin);
+    }
+    else
+    {
+      vtkByteSwap::Swap4BERange(data + begin, end - begin);
+    }
+  };
+  if (count > SwapGrainSize)
+  {
+    vtkSMPTools::For(0, count, SwapGrainSize, swap);
+  }
+  else
+  {
+    swap(0, count);
+  }
+}
+
+//----------------------------------------------------------------------------
+// A read-only stream buffer over a memory mapped file. The whole file is the
+// get area, so reads are memory copies and seeks only move the get pointer.
+class vtkPEnSightMappedFileBuffer : public std::streambuf
+{
+public:
+  vtkPEnSightMappedFileBuffer() = default;
+  ~vtkPEnSightMappedFileBuffer() override { this->Close(); }
+  vtkPEnSightMappedFileBuffer(const vtkPEnSightMappedFileBuffer&) = delete;
+  vtkPEnSightMappedFileBuffer& operator=(const vtkPEnSightMappedFileBuffer&) = delete;
+
+  bool Open(const char* filename, std::size_t size)
+  {
+    if (size == 0)
+    {
+      return false;
+    }
+#ifdef _WIN32
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+    {
+      return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mapping);
+    if (!data)
+    {
+      return false;
+    }
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd == -1)
+    {
+      return false;
+    }
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      return false;
+    }
+#endif
+    this->Data = static_cast<char*>(data);
+    this->Size = size;
+    this->setg(this->Data, this->Data, this->Data + this->Size);
+    return true;
+  }
+
+  void Close()
+  {
+    if (this->Data)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(this->Data);
+#else
+      munmap(this->Data, this->Size);
+#endif
+      this->Data = nullptr;
+      this->Size = 0;
+      this->setg(nullptr, nullptr, nullptr);
+    }
+  }
+
+  const char* GetData() const { return this->Data; }
+  std::size_t GetSize() const { return this->Size; }
+
+protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+      base = this->gptr() - this->eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      base = static_cast<off_type>(this->Size);
+    }
+    return this->seekpos(pos_type(base + off), which);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    const off_type offset = pos;
+    if (!(which & std::ios_base::in) || offset < 0 || offset > static_cast<off_type>(this->Size))
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->Data, this->Data + offset, this->Data + this->Size);
+    return pos;
+  }
+
+  std::streamsize xsgetn(char* s, std::streamsize n) override
+  {
+    const std::streamsize count = std::min<std::streamsize>(n, this->egptr() - this->gptr());
+    if (count > 0)
+    {
+      std::memcpy(s, this->gptr(), static_cast<std::size_t>(count));
+      this->setg(this->eback(), this->gptr() + count, this->egptr());
+    }
+    return count;
+  }
+
+private:
+  char* Data = nullptr;
+  std::size_t Size = 0;
+};
+
+// Holds the buffer so that it is constructed before the istream using it.
+struct vtkPEnSightMappedFileBufferHolder
+{
+  vtkPEnSightMappedFileBuffer Buffer;
+};
+
+//----------------------------------------------------------------------------
+// The input stream used instead of a vtksys::ifstream when the file could be
+// mapped in memory. Deleting it unmaps the file.
+class vtkPEnSightMappedFileStream
+  : private vtkPEnSightMappedFileBufferHolder
+  , public std::istream
+{
+public:
+  vtkPEnSightMappedFileStream()
+    : std::istream(&this->Buffer)
+  {
+  }
+
+  bool Open(const char* filename, std::size_t size) { return this->Buffer.Open(filename, size); }
+  const char* GetData() const { return this->Buffer.GetData(); }
+  std::size_t GetSize() const { return this->Buffer.GetSize(); }
+};
+}
+
 //----------------------------------------------------------------------------
 vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
 {
@@ -80,11 +263,23 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
     // Find out how big the file is.
     this->FileSize = (long)(fs.st_size);
 
+    // Map the file in memory when possible: the reader seeks back and forth a
+    // lot, which then costs no system call, and coordinates can be decoded
+    // straight from the mapped pages.
+    auto mapped = new vtkPEnSightMappedFileStream;
+    if (mapped->Open(filename, static_cast<std::size_t>(fs.st_size)))
+    {
+      this->IFile = mapped;
+    }
+    else
+    {
+      delete mapped;
 #ifdef _WIN32
-    this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
+      this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
 #else
-    this->IFile = new vtksys::ifstream(filename, ios::in);
+      this->IFile = new vtksys::ifstream(filename, ios::in);
 #endif
+    }
   }
   else
   {
@@ -4207,14 +4402,7 @@ int vtkPEnSightGoldBinaryReader::ReadIntArray(int* result, int numInts)
     return 0;
   }
 
-  if (this->ByteOrder == FILE_LITTLE_ENDIAN)
-  {
-    vtkByteSwap::Swap4LERange(result, numInts);
-  }
-  else
-  {
-    vtkByteSwap::Swap4BERange(result, numInts);
-  }
+  SwapRange(result, numInts, this->ByteOrder);
 
   if (this->Fortran)
   {
@@ -4253,14 +4441,7 @@ int vtkPEnSightGoldBinaryReader::ReadFloatArray(float* result, int numFloats)
     return 0;
   }
 
-  if (this->ByteOrder == FILE_LITTLE_ENDIAN)
-  {
-    vtkByteSwap::Swap4LERange(result, numFloats);
-  }
-  else
-  {
-    vtkByteSwap::Swap4BERange(result, numFloats);
-  }
+  SwapRange(result, numFloats, this->ByteOrder);
 
   if (this->Fortran)
   {
@@ -4306,7 +4487,6 @@ int vtkPEnSightGoldBinaryReader::ReadOrSkipCoordinates(
   this->FloatBufferFilePosition = currentPositionInFile;
   this->FloatBufferIndexBegin = 0;
   this->FloatBufferNumberOfVectors = numPts;
-  this->UpdateFloatBuffer();
 
   // Position to reach at the end of this method
   long endFilePosition = currentPositionInFile + 3 * numPts * (long)sizeof(float);
@@ -4343,6 +4523,16 @@ int vtkPEnSightGoldBinaryReader::ReadOrSkipCoordinates(
       vtkIdType i;
       int localNumberOfIds = this->GetPointIds(partId)->GetLocalNumberOfIds();
       points->SetNumberOfPoints(localNumberOfIds);
+      auto mapped = dynamic_cast<vtkPEnSightMappedFileStream*>(this->IFile);
+      if (mapped && endFilePosition <= static_cast<long>(mapped->GetSize()))
+      {
+        this->DecodeMappedCoordinates(
+          points, mapped->GetData() + currentPositionInFile, numPts, partId);
+        this->GetPointIds(partId)->SetNumberOfIds(numPts);
+        this->IFile->seekg(endFilePosition);
+        return localNumberOfIds;
+      }
+      this->UpdateFloatBuffer();
       int maxId = -1;
       int minId = -1;
       for (i = 0; i < numPts; i++)
@@ -4375,6 +4565,70 @@ int vtkPEnSightGoldBinaryReader::ReadOrSkipCoordinates(
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPEnSightGoldBinaryReader::DecodeMappedCoordinates(
+  vtkPoints* points, const char* coordinates, vtkIdType numPts, int partId)
+{
+  // The x, y and z components are stored one after the other, each wrapped in
+  // Fortran record markers when needed.
+  const long markerSize = this->Fortran ? 4 : 0;
+  const long componentSize = numPts * static_cast<long>(sizeof(float)) + 2 * markerSize;
+  const char* components[3];
+  for (int comp = 0; comp < 3; ++comp)
+  {
+    components[comp] = coordinates + comp * componentSize + markerSize;
+  }
+
+  vtkPEnSightReaderCellIds* pointIds = this->GetPointIds(partId);
+  vtkFloatArray* floatPoints = vtkFloatArray::FastDownCast(points->GetData());
+  const int byteOrder = this->ByteOrder;
+
+  // Point ids are unique, so each chunk writes to its own points.
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      float buffer[3][1024];
+      int ids[1024];
+      for (vtkIdType chunkBegin = begin; chunkBegin < end; chunkBegin += 1024)
+      {
+        const vtkIdType chunkSize = std::min<vtkIdType>(1024, end - chunkBegin);
+        for (int comp = 0; comp < 3; ++comp)
+        {
+          std::memcpy(
+            buffer[comp], components[comp] + chunkBegin * sizeof(float), chunkSize * sizeof(float));
+          if (byteOrder == FILE_LITTLE_ENDIAN)
+          {
+            vtkByteSwap::Swap4LERange(buffer[comp], chunkSize);
+          }
+          else
+          {
+            vtkByteSwap::Swap4BERange(buffer[comp], chunkSize);
+          }
+        }
+        pointIds->GetIds(static_cast<int>(chunkBegin), static_cast<int>(chunkSize), ids);
+        for (vtkIdType i = 0; i < chunkSize; ++i)
+        {
+          const int id = ids[i];
+          if (id == -1)
+          {
+            continue;
+          }
+          if (floatPoints)
+          {
+            float* point = floatPoints->GetPointer(3 * static_cast<vtkIdType>(id));
+            point[0] = buffer[0][i];
+            point[1] = buffer[1][i];
+            point[2] = buffer[2][i];
+          }
+          else
+          {
+            points->SetPoint(id, buffer[0][i], buffer[1][i], buffer[2][i]);
+          }
+        }
+      }
+    });
+}
+
 //----------------------------------------------------------------------------
 int vtkPEnSightGoldBinaryReader::InjectCoordinatesAtEnd(
   vtkUnstructuredGrid* output, long coordinatesOffset, int partId)
@@ -4472,14 +4726,7 @@ void vtkPEnSightGoldBinaryReader::UpdateFloatBuffer()
       vtkErrorMacro("Read failed");
     }
 
-    if (this->ByteOrder == FILE_LITTLE_ENDIAN)
-    {
-      vtkByteSwap::Swap4LERange(this->FloatBuffer[i], sizeToRead);
-    }
-    else
-    {
-      vtkByteSwap::Swap4BERange(this->FloatBuffer[i], sizeToRead);
-    }
+    SwapRange(this->FloatBuffer[i], sizeToRead, this->ByteOrder);
   }
 
   this->IFile->seekg(currentPosition);
@@ -164,6 +164,14 @@ protected:
    */
   int ReadOrSkipCoordinates(vtkPoints* points, long offset, int partId, bool skip);
 
+  /**
+   * Decode the coordinates of a part directly from a memory mapped file, using
+   * several threads. `coordinates` points to the first x coordinate, or to its
+   * Fortran record marker.
+   */
+  void DecodeMappedCoordinates(
+    vtkPoints* points, const char* coordinates, vtkIdType numPts, int partId);
+
   /**
    * Internal method to inject coordinates at the end
    * of a part read for unstructured data.
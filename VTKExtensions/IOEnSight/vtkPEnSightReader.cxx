@@ -29,7 +29,9 @@
 
 #include "vtksys/FStream.hxx"
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 typedef std::vector<vtkPEnSightReader::vtkPEnSightReaderCellIds*> vtkPEnSightReaderCellIdsTypeBase;
 class vtkPEnSightReaderCellIdsType : public vtkPEnSightReaderCellIdsTypeBase
@@ -2248,6 +2250,269 @@ void vtkPEnSightReader::RemoveLeadingBlanks(char* line)
   memcpy(line, line + count, len - count + 1);
 }
 
+//----------------------------------------------------------------------------
+int vtkPEnSightReader::vtkPEnSightReaderIdMap::GetId(int id) const
+{
+  if (id < 0 || id >= this->NumberOfIds)
+  {
+    return -1;
+  }
+  if (this->Dense)
+  {
+    return this->DenseValues[id];
+  }
+
+  // The table overrides the runs.
+  if (const Slot* slot = this->FindSlot(id))
+  {
+    return slot->Value;
+  }
+  auto run = std::upper_bound(this->Runs.begin(), this->Runs.end(), id,
+    [](int value, const Run& other) { return value < other.Id; });
+  if (run == this->Runs.begin())
+  {
+    return -1;
+  }
+  --run;
+  return id < run->Id + run->Length ? run->Value + (id - run->Id) : -1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::GetIds(int first, int count, int* result) const
+{
+  if (this->Dense || this->TableCount > 0)
+  {
+    for (int i = 0; i < count; i++)
+    {
+      result[i] = this->GetId(first + i);
+    }
+    return;
+  }
+
+  // Walk the runs once instead of searching them for each id.
+  auto run = std::upper_bound(this->Runs.begin(), this->Runs.end(), first,
+    [](int value, const Run& other) { return value < other.Id; });
+  if (run != this->Runs.begin())
+  {
+    --run;
+  }
+  for (int i = 0; i < count; i++)
+  {
+    const int id = first + i;
+    while (run != this->Runs.end() && id >= run->Id + run->Length)
+    {
+      ++run;
+    }
+    if (id >= 0 && run != this->Runs.end() && id >= run->Id)
+    {
+      result[i] = run->Value + (id - run->Id);
+    }
+    else
+    {
+      result[i] = -1;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::SetId(int id, int value)
+{
+  if (id < 0)
+  {
+    return;
+  }
+  const int previous = this->GetId(id);
+  this->NumberOfLocalIds += (value != -1) - (previous != -1);
+  if (id >= this->NumberOfIds)
+  {
+    this->NumberOfIds = id + 1;
+    if (this->Dense)
+    {
+      this->DenseValues.resize(this->NumberOfIds, -1);
+    }
+  }
+
+  if (this->Dense)
+  {
+    this->DenseValues[id] = value;
+  }
+  else if (value != previous)
+  {
+    this->Insert(id, value);
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPEnSightReader::vtkPEnSightReaderIdMap::InsertNextId(int value)
+{
+  const int id = this->NumberOfIds++;
+  if (value != -1)
+  {
+    this->NumberOfLocalIds++;
+  }
+  if (this->Dense)
+  {
+    this->DenseValues.push_back(value);
+  }
+  else if (value != -1)
+  {
+    this->Insert(id, value);
+  }
+  return id;
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::InsertNextIds(const int* values, int count)
+{
+  if (this->Dense)
+  {
+    this->DenseValues.insert(this->DenseValues.end(), values, values + count);
+    this->NumberOfIds += count;
+    this->NumberOfLocalIds +=
+      static_cast<int>(count - std::count(values, values + count, -1));
+    return;
+  }
+  for (int i = 0; i < count; i++)
+  {
+    this->InsertNextId(values[i]);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::Reset()
+{
+  this->NumberOfIds = 0;
+  this->NumberOfLocalIds = 0;
+  this->Dense = false;
+  std::vector<int>().swap(this->DenseValues);
+  std::vector<Run>().swap(this->Runs);
+  std::vector<Slot>().swap(this->Table);
+  this->TableCount = 0;
+}
+
+//----------------------------------------------------------------------------
+size_t vtkPEnSightReader::vtkPEnSightReaderIdMap::GetMemorySize() const
+{
+  return sizeof(*this) + this->DenseValues.capacity() * sizeof(int) +
+    this->Runs.capacity() * sizeof(Run) + this->Table.capacity() * sizeof(Slot);
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::Insert(int id, int value)
+{
+  // Ids after the last run extend it or start a new one. Ids are most of the
+  // time inserted in increasing order, for cells always.
+  const int end = this->Runs.empty() ? 0 : this->Runs.back().Id + this->Runs.back().Length;
+  if (id >= end && value != -1)
+  {
+    if (!this->Runs.empty() && id == end &&
+      value == this->Runs.back().Value + this->Runs.back().Length)
+    {
+      this->Runs.back().Length++;
+    }
+    else
+    {
+      this->Runs.push_back(Run{ id, value, 1 });
+    }
+  }
+  else if (id < end)
+  {
+    this->InsertSlot(id, value);
+  }
+  this->CheckDensity();
+}
+
+//----------------------------------------------------------------------------
+const vtkPEnSightReader::vtkPEnSightReaderIdMap::Slot*
+vtkPEnSightReader::vtkPEnSightReaderIdMap::FindSlot(int id) const
+{
+  if (this->TableCount == 0)
+  {
+    return nullptr;
+  }
+  const size_t mask = this->Table.size() - 1;
+  for (size_t index = (static_cast<unsigned int>(id) * 2654435761u) & mask;;
+       index = (index + 1) & mask)
+  {
+    const Slot& slot = this->Table[index];
+    if (slot.Id == id)
+    {
+      return &slot;
+    }
+    if (slot.Id == -1)
+    {
+      return nullptr;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::InsertSlot(int id, int value)
+{
+  // Keep the load factor under 1/2 so that probing stays short.
+  if (2 * (this->TableCount + 1) > this->Table.size())
+  {
+    std::vector<Slot> previous(std::max<size_t>(16, 2 * this->Table.size()), Slot{ -1, -1 });
+    previous.swap(this->Table);
+    this->TableCount = 0;
+    for (const Slot& slot : previous)
+    {
+      if (slot.Id != -1)
+      {
+        this->InsertSlot(slot.Id, slot.Value);
+      }
+    }
+  }
+
+  const size_t mask = this->Table.size() - 1;
+  for (size_t index = (static_cast<unsigned int>(id) * 2654435761u) & mask;;
+       index = (index + 1) & mask)
+  {
+    Slot& slot = this->Table[index];
+    if (slot.Id == id)
+    {
+      slot.Value = value;
+      return;
+    }
+    if (slot.Id == -1)
+    {
+      slot = Slot{ id, value };
+      this->TableCount++;
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::vtkPEnSightReaderIdMap::CheckDensity()
+{
+  // Switch to a plain vector once it would be smaller.
+  const size_t compactSize = this->Runs.size() * sizeof(Run) + this->Table.size() * sizeof(Slot);
+  const size_t denseSize = static_cast<size_t>(this->NumberOfIds) * sizeof(int);
+  if (compactSize <= denseSize || this->NumberOfIds < 64)
+  {
+    return;
+  }
+
+  this->DenseValues.assign(this->NumberOfIds, -1);
+  for (const Run& run : this->Runs)
+  {
+    std::iota(this->DenseValues.begin() + run.Id, this->DenseValues.begin() + run.Id + run.Length,
+      run.Value);
+  }
+  for (const Slot& slot : this->Table)
+  {
+    if (slot.Id != -1)
+    {
+      this->DenseValues[slot.Id] = slot.Value;
+    }
+  }
+  std::vector<Run>().swap(this->Runs);
+  std::vector<Slot>().swap(this->Table);
+  this->TableCount = 0;
+  this->Dense = true;
+}
+
 //----------------------------------------------------------------------------
 vtkPEnSightReader::vtkPEnSightReaderCellIds* vtkPEnSightReader::GetCellIds(int index, int cellType)
 {
@@ -2287,8 +2552,6 @@ vtkPEnSightReader::vtkPEnSightReaderCellIds* vtkPEnSightReader::GetCellIds(int i
   // Make sure this vtkIdList exists.
   if ((*this->CellIds)[cellIdsIndex] == nullptr)
   {
-    // TODO: FIXME: map consumes x12 times more memory than vector
-    // we need another way of store these ids...
     if (this->StructuredPartIds->IsId(index) != -1)
     {
       (*this->CellIds)[cellIdsIndex] = new vtkPEnSightReaderCellIds(IMPLICIT_STRUCTURED_MODE);
@@ -2335,7 +2598,6 @@ vtkPEnSightReader::vtkPEnSightReaderCellIds* vtkPEnSightReader::GetPointIds(int
   // Make sure this vtkIdList exists.
   if ((*this->PointIds)[index] == nullptr)
   {
-    // TODO: FIXME: map consumes x12 times more memory than vector
     if (this->StructuredPartIds->IsId(index) != -1)
     {
       (*this->PointIds)[index] = new vtkPEnSightReaderCellIds(IMPLICIT_STRUCTURED_MODE);
@@ -49,10 +49,73 @@ public:
   vtkTypeMacro(vtkPEnSightReader, vtkPGenericEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  //----------------------------------------------------------------------------
+  // Maps EnSight (global) ids to local ids, -1 meaning "not on this process".
+  // In distributed mode each process only keeps a small part of the ids, so
+  // they are stored as sorted runs of consecutive ids, plus an open addressing
+  // hash table for the ids that do not extend the runs. This is much smaller
+  // than a vector of the global size or a std::map. When the ids become dense
+  // enough, e.g. when a single process reads everything, the map switches to a
+  // plain vector, which is then smaller.
+  class VTKPVVTKEXTENSIONSIOENSIGHT_EXPORT vtkPEnSightReaderIdMap
+  {
+  public:
+    // return -1 if not found
+    int GetId(int id) const;
+
+    // Lookup `count` consecutive ids starting at `first`.
+    void GetIds(int first, int count, int* result) const;
+
+    void SetId(int id, int value);
+
+    // Append `value` (-1 allowed) at the end of the map, return its id.
+    int InsertNextId(int value);
+    void InsertNextIds(const int* values, int count);
+
+    // Largest id + 1
+    int GetNumberOfIds() const { return this->NumberOfIds; }
+
+    // Number of ids mapped to a value other than -1
+    int GetNumberOfLocalIds() const { return this->NumberOfLocalIds; }
+
+    void Reset();
+
+    // Memory used by the map, in bytes
+    size_t GetMemorySize() const;
+
+    bool IsDense() const { return this->Dense; }
+
+  private:
+    struct Run
+    {
+      int Id;
+      int Value;
+      int Length;
+    };
+    struct Slot
+    {
+      int Id;
+      int Value;
+    };
+
+    void Insert(int id, int value);
+    const Slot* FindSlot(int id) const;
+    void InsertSlot(int id, int value);
+    void CheckDensity();
+
+    int NumberOfIds = 0;
+    int NumberOfLocalIds = 0;
+    bool Dense = false;
+    std::vector<int> DenseValues;
+    std::vector<Run> Runs;
+    std::vector<Slot> Table;
+    size_t TableCount = 0;
+  };
+
   //----------------------------------------------------------------------------
   // PointIds and CellIds must be stored in a different way:
-  // std::vector in non distributed mode
-  // std::map in distributed mode
+  // vtkPEnSightReaderIdMap by default
+  // std::map in (legacy) sparse mode
   // note: Ensight Ids are INTEGERS, not longs
   class vtkPEnSightReaderCellIds
   {
@@ -65,7 +128,7 @@ public:
       : cellMap(nullptr)
       , cellNumberOfIds(-1)
       , cellLocalNumberOfIds(-1)
-      , cellVector(nullptr)
+      , cellIdMap(nullptr)
       , ImplicitDimensions(nullptr)
       , ImplicitLocalDimensions(nullptr)
       , ImplicitSplitDimension(-1)
@@ -79,7 +142,7 @@ public:
       : cellMap(nullptr)
       , cellNumberOfIds(-1)
       , cellLocalNumberOfIds(-1)
-      , cellVector(nullptr)
+      , cellIdMap(nullptr)
       , ImplicitDimensions(nullptr)
       , ImplicitLocalDimensions(nullptr)
       , ImplicitSplitDimension(-1)
@@ -91,7 +154,7 @@ public:
       {
         this->cellMap = new IntIntMap;
         this->cellNumberOfIds = 0;
-        this->cellVector = nullptr;
+        this->cellIdMap = nullptr;
       }
       else if (this->mode == IMPLICIT_STRUCTURED_MODE)
       {
@@ -103,7 +166,7 @@ public:
       else
       {
         this->cellMap = nullptr;
-        this->cellVector = new IntVector;
+        this->cellIdMap = new vtkPEnSightReaderIdMap;
         this->cellNumberOfIds = -1;
         this->cellLocalNumberOfIds = -1;
       }
@@ -112,7 +175,7 @@ public:
     ~vtkPEnSightReaderCellIds()
     {
       delete this->cellMap;
-      delete this->cellVector;
+      delete this->cellIdMap;
       delete[] this->ImplicitDimensions;
     }
 
@@ -123,7 +186,7 @@ public:
       {
         this->cellMap = new IntIntMap;
         this->cellNumberOfIds = 0;
-        this->cellVector = nullptr;
+        this->cellIdMap = nullptr;
       }
       else if (this->mode == IMPLICIT_STRUCTURED_MODE)
       {
@@ -135,7 +198,7 @@ public:
       else
       {
         this->cellMap = nullptr;
-        this->cellVector = new IntVector;
+        this->cellIdMap = new vtkPEnSightReaderIdMap;
         this->cellNumberOfIds = -1;
         this->cellLocalNumberOfIds = -1;
       }
@@ -217,14 +280,26 @@ public:
         }
         default:
         {
-          if (this->cellVector->size() > (unsigned int)(id))
-            return (*this->cellVector)[id];
-          break;
+          return this->cellIdMap->GetId(id);
         }
       }
       return -1;
     }
 
+    // Lookup `count` consecutive ids starting at `first`.
+    void GetIds(int first, int count, int* result)
+    {
+      if (this->mode == NON_SPARSE_MODE)
+      {
+        this->cellIdMap->GetIds(first, count, result);
+        return;
+      }
+      for (int i = 0; i < count; i++)
+      {
+        result[i] = this->GetId(first + i);
+      }
+    }
+
     void SetId(int id, int value)
     {
       switch (this->mode)
@@ -247,21 +322,7 @@ public:
         }
         default:
         {
-          if (this->cellVector->size() < (unsigned int)(id + 1))
-          {
-            int k;
-            int currentSize = static_cast<int>(this->cellVector->size());
-            this->cellVector->resize(id + 1);
-            for (k = currentSize; k < id; k++)
-            {
-              (*this->cellVector)[k] = -1;
-            }
-            (*this->cellVector)[id] = value;
-          }
-          else
-          {
-            (*this->cellVector)[id] = value;
-          }
+          this->cellIdMap->SetId(id, value);
           break;
         }
       }
@@ -292,12 +353,10 @@ public:
         }
         default:
         {
-          this->cellVector->push_back(id);
-          return static_cast<int>(this->cellVector->size() - 1);
-          break;
+          return this->cellIdMap->InsertNextId(id);
         }
       }
-      return static_cast<int>(this->cellVector->size() - 1);
+      return -1;
     }
 
     int GetNumberOfIds()
@@ -325,17 +384,17 @@ public:
         }
       }
 
-      // Point Ids are directly injected in the vector,
+      // Point Ids are directly injected in the map,
       // contrary to cell Ids which are "stacked" with
       // InsertNextId. So the real total number of Ids
-      // for Points cannot be the size of the vector.
+      // for Points cannot be the size of the map.
       // So we must inject it manually
       if (this->cellNumberOfIds >= 0)
       {
         return this->cellNumberOfIds;
       }
 
-      return static_cast<int>(this->cellVector->size());
+      return this->cellIdMap->GetNumberOfIds();
     }
 
     // Just inject the real total number of Ids
@@ -376,7 +435,7 @@ public:
       else
       {
         if (this->mode == NON_SPARSE_MODE)
-          this->cellVector->clear();
+          this->cellIdMap->Reset();
         if (this->cellNumberOfIds >= 0)
           this->cellNumberOfIds = -1;
         if (this->cellLocalNumberOfIds >= 0)
@@ -415,21 +474,15 @@ public:
         return this->cellLocalNumberOfIds;
       }
 
-      // Else compute the real size
-      int result = 0;
-      for (unsigned int i = 0; i < this->cellVector->size(); i++)
-      {
-        if ((*this->cellVector)[i] != -1)
-          result++;
-      }
-      return result;
+      // Else return the real size
+      return this->cellIdMap->GetNumberOfLocalIds();
     }
 
   protected:
     IntIntMap* cellMap;
     int cellNumberOfIds;
     int cellLocalNumberOfIds;
-    IntVector* cellVector;
+    vtkPEnSightReaderIdMap* cellIdMap;
     // Implicit Structured Real (global) dimensions
     int* ImplicitDimensions;
     // Implicit Structured local dimensions
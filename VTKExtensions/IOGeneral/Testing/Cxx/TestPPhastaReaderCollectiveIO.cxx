@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArray.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiPieceDataSet.h"
+#include "vtkNew.h"
+#include "vtkPPhastaReader.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTesting.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int NumberOfPieces = 2;
+
+// Writes a binary Phasta block: the header line with its integer values, the
+// data and a newline.
+template <typename T>
+void WriteBlock(std::ofstream& file, const std::string& header, const std::string& headerValues,
+  const std::vector<T>& values)
+{
+  const size_t size = values.size() * sizeof(T);
+  file << header << " : < " << size + 1 << " > " << headerValues << "\n";
+  file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(size));
+  file << "\n";
+}
+
+// Writes a meta-file with a geometry file shared by the pieces, a single
+// tetrahedron, and a field file per piece. The pressure of node n of piece p
+// is 10 * p + n.
+void WriteDataSet(const std::string& directory)
+{
+  std::ofstream meta(directory + "/TestPPhastaReader.pht");
+  meta << "<?xml version=\"1.0\" ?>\n"
+       << "<PhastaMetaFile number_of_pieces=\"" << NumberOfPieces << "\">\n"
+       << "  <GeometryFileNamePattern pattern=\"TestPPhastaReader.geombc\"\n"
+       << "                           has_piece_entry=\"0\" has_time_entry=\"0\"/>\n"
+       << "  <FieldFileNamePattern pattern=\"TestPPhastaReader.restart.%d.%d\"\n"
+       << "                        has_piece_entry=\"1\" has_time_entry=\"1\"/>\n"
+       << "  <TimeSteps number_of_steps=\"1\" auto_generate_indices=\"1\" start_index=\"0\"\n"
+       << "             increment_index_by=\"1\" start_value=\"0.\" increment_value_by=\"1.\"/>\n"
+       << "</PhastaMetaFile>\n";
+
+  std::ofstream geometry(directory + "/TestPPhastaReader.geombc", std::ios::binary);
+  geometry << "number of nodes : < 0 > 4\n"
+           << "number of interior elements : < 0 > 1\n"
+           << "number of interior tpblocks : < 0 > 1\n";
+  // coordinates are stored by component
+  const std::vector<double> coordinates = { 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+  WriteBlock(geometry, "co-ordinates", "4 3", coordinates);
+  // one block of one element with 4 vertices, numbered from 1
+  const std::vector<int> connectivity = { 1, 2, 3, 4 };
+  WriteBlock(geometry, "connectivity interior linear tetrahedron", "1 4 1 4 1 1 1", connectivity);
+
+  for (int piece = 0; piece < NumberOfPieces; ++piece)
+  {
+    std::ofstream field(
+      directory + "/TestPPhastaReader.restart.0." + std::to_string(piece + 1), std::ios::binary);
+    // pressure, velocity and temperature, stored by variable
+    std::vector<double> solution(5 * 4, 1.0);
+    for (int node = 0; node < 4; ++node)
+    {
+      solution[node] = 10.0 * piece + node;
+    }
+    WriteBlock(field, "solution", "4 5 0", solution);
+  }
+}
+
+bool Check(bool condition, const char* what)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << what << std::endl;
+  }
+  return condition;
+}
+
+// Updates the piece of a new reader and checks every piece it loaded.
+bool ReadPiece(const std::string& fileName, vtkMultiProcessController* controller,
+  bool useCollectiveIO, int piece, int numberOfPieces)
+{
+  vtkNew<vtkPPhastaReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->SetController(controller);
+  reader->SetUseCollectiveIO(useCollectiveIO);
+  reader->UpdatePiece(piece, numberOfPieces, 0);
+
+  auto pieces = vtkMultiPieceDataSet::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  if (!Check(pieces && pieces->GetNumberOfPieces() == NumberOfPieces, "wrong number of pieces"))
+  {
+    return false;
+  }
+  for (int loadingPiece = piece; loadingPiece < NumberOfPieces; loadingPiece += numberOfPieces)
+  {
+    auto grid = vtkUnstructuredGrid::SafeDownCast(pieces->GetPiece(loadingPiece));
+    if (!Check(grid != nullptr, "piece was not loaded") ||
+      !Check(grid->GetNumberOfPoints() == 4 && grid->GetNumberOfCells() == 1, "wrong geometry"))
+    {
+      return false;
+    }
+    vtkDataArray* pressure = grid->GetPointData()->GetArray("pressure");
+    if (!Check(pressure && pressure->GetNumberOfTuples() == 4, "missing pressure"))
+    {
+      return false;
+    }
+    for (vtkIdType node = 0; node < 4; ++node)
+    {
+      if (!Check(pressure->GetTuple1(node) == 10.0 * loadingPiece + node, "wrong pressure"))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+extern int TestPPhastaReaderCollectiveIO(int argc, char* argv[])
+{
+  vtkMPIController* contr = vtkMPIController::New();
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+
+  const int myRank = contr->GetLocalProcessId();
+  const int numRanks = contr->GetNumberOfProcesses();
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  if (!testing->GetTempDirectory())
+  {
+    vtkLogF(ERROR, "no temp directory specified!");
+    contr->Finalize();
+    contr->Delete();
+    return EXIT_FAILURE;
+  }
+  const std::string directory = testing->GetTempDirectory();
+  const std::string fileName = directory + "/TestPPhastaReader.pht";
+  if (myRank == 0)
+  {
+    WriteDataSet(directory);
+  }
+  contr->Barrier();
+
+  // All the processes update the reader, with and without MPI-IO.
+  int success = ReadPiece(fileName, contr, true, myRank, numRanks) &&
+    ReadPiece(fileName, contr, false, myRank, numRanks);
+
+  // Only the first process updates the reader. With a controller holding
+  // that process only, the collective reads must not wait for the others,
+  // whether or not the number of pieces matches the size of the controller.
+  vtkSmartPointer<vtkMultiProcessController> subController;
+  subController.TakeReference(contr->PartitionController(myRank == 0 ? 0 : 1, myRank));
+  if (myRank == 0)
+  {
+    success = success && ReadPiece(fileName, subController, true, 0, 1) &&
+      ReadPiece(fileName, subController, true, 0, NumberOfPieces);
+  }
+
+  int all_success;
+  contr->AllReduce(&success, &all_success, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  contr->Delete();
+  return all_success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
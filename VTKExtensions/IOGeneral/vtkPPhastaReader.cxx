@@ -4,11 +4,13 @@
 #include "vtkPPhastaReader.h"
 
 #include "vtkCellData.h"
+#include "vtkCharArray.h"
 #include "vtkFieldData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiPieceDataSet.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
@@ -19,11 +21,19 @@
 #include "vtkStringFormatter.h"
 #include "vtkUnstructuredGrid.h"
 
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPI.h"
+#include "vtkMPICommunicator.h"
+#include "vtkMPIController.h"
+#endif
+
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
 #include <map>
 #include <sstream>
+#include <string>
+#include <vector>
 
 struct vtkPPhastaReaderInternal
 {
@@ -47,8 +57,109 @@ struct vtkPPhastaReaderInternal
   CachedGridsMapType CachedGrids;
 };
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Builds the name of the file of a piece from a file name pattern. Relative
+// names are relative to the directory of the meta-file.
+std::string GetPhastaFileName(const char* metaFileName, const char* pattern,
+  const std::string& patternFormat, int hasPiece, int hasTime, int timeIndex, int piece)
+{
+  size_t name_sz = strlen(pattern) + 60;
+  std::vector<char> name(name_sz);
+  if (hasTime && hasPiece)
+  {
+    auto result = vtk::format_to_n(name.data(), name_sz, patternFormat, timeIndex, piece + 1);
+    *result.out = '\0';
+  }
+  else if (hasPiece)
+  {
+    auto result = vtk::format_to_n(name.data(), name_sz, patternFormat, piece + 1);
+    *result.out = '\0';
+  }
+  else if (hasTime)
+  {
+    auto result = vtk::format_to_n(name.data(), name_sz, patternFormat, timeIndex);
+    *result.out = '\0';
+  }
+  else
+  {
+    strncpy(name.data(), pattern, name_sz);
+    name[name_sz - 1] = '\0';
+  }
+
+  std::ostringstream fileName;
+  std::string npath = vtksys::SystemTools::GetFilenamePath(name.data());
+  if (npath.empty() || !vtksys::SystemTools::FileIsFullPath(npath.c_str()))
+  {
+    std::string path = vtksys::SystemTools::GetFilenamePath(metaFileName);
+    if (!path.empty())
+    {
+      fileName << path.c_str() << "/";
+    }
+  }
+  fileName << name.data();
+  return fileName.str();
+}
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+//----------------------------------------------------------------------------
+// Reads a whole file with collective MPI-IO. All the processes of comm must
+// call it with the same file name. They all request the whole file, which lets
+// the MPI-IO layer aggregate the requests and read the file once for the
+// group instead of each process opening and seeking through it with stdio.
+// Returns nullptr on failure, the file is then read with stdio.
+vtkSmartPointer<vtkCharArray> ReadFileCollectively(MPI_Comm comm, const std::string& fileName)
+{
+  MPI_File file;
+  if (MPI_File_open(comm, const_cast<char*>(fileName.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL,
+        &file) != MPI_SUCCESS)
+  {
+    return nullptr;
+  }
+  MPI_Offset size = 0;
+  if (MPI_File_get_size(file, &size) != MPI_SUCCESS)
+  {
+    size = -1;
+  }
+
+  // The processes must agree on the size, otherwise they would not make the
+  // same number of collective reads. -1 on any of them makes them all fail.
+  long long sizeRange[2] = { static_cast<long long>(size), -static_cast<long long>(size) };
+  MPI_Allreduce(MPI_IN_PLACE, sizeRange, 2, MPI_LONG_LONG, MPI_MIN, comm);
+  if (sizeRange[0] < 0 || sizeRange[0] != -sizeRange[1])
+  {
+    MPI_File_close(&file);
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkCharArray> buffer = vtkSmartPointer<vtkCharArray>::New();
+  buffer->SetNumberOfValues(static_cast<vtkIdType>(size));
+
+  // MPI counts are int, large files are read in chunks. All the processes
+  // read the same file so they make the same number of calls.
+  const MPI_Offset chunkSize = 1 << 30;
+  bool success = true;
+  for (MPI_Offset offset = 0; offset < size; offset += chunkSize)
+  {
+    const int count = static_cast<int>(std::min(chunkSize, size - offset));
+    MPI_Status status;
+    success &= MPI_File_read_at_all(file, offset, buffer->GetPointer(offset), count, MPI_CHAR,
+                 &status) == MPI_SUCCESS;
+  }
+  MPI_File_close(&file);
+  if (!success)
+  {
+    return nullptr;
+  }
+  return buffer;
+}
+#endif
+}
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkPPhastaReader);
+vtkCxxSetObjectMacro(vtkPPhastaReader, Controller, vtkMultiProcessController);
 
 //----------------------------------------------------------------------------
 vtkPPhastaReader::vtkPPhastaReader()
@@ -68,6 +179,11 @@ vtkPPhastaReader::vtkPPhastaReader()
 
   this->TimeStepRange[0] = 0;
   this->TimeStepRange[1] = 0;
+
+  this->UseCollectiveIO = true;
+
+  this->Controller = nullptr;
+  this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
 //----------------------------------------------------------------------------
@@ -82,6 +198,8 @@ vtkPPhastaReader::~vtkPPhastaReader()
   }
 
   delete this->Internal;
+
+  this->SetController(nullptr);
 }
 
 //----------------------------------------------------------------------------
@@ -198,92 +316,68 @@ int vtkPPhastaReader::RequestData(
     return 0;
   }
 
-  size_t geom_name_sz = strlen(geometryPattern) + 60;
-  char* geom_name = new char[geom_name_sz];
-  size_t field_name_sz = strlen(fieldPattern) + 60;
-  char* field_name = new char[field_name_sz];
-
   // now loop over all of the files that I should load
   const std::string geometryPatternFormat = vtk::is_printf_format(geometryPattern)
     ? vtk::printf_to_std_format(geometryPattern)
     : geometryPattern;
   const std::string fieldPatternFormat =
     vtk::is_printf_format(fieldPattern) ? vtk::printf_to_std_format(fieldPattern) : fieldPattern;
-  for (int loadingPiece = piece; loadingPiece < numPieces; loadingPiece += numProcPieces)
+  const int geomIndex = this->Internal->TimeStepInfoMap[this->ActualTimeStep].GeomIndex;
+  const int fieldIndex = this->Internal->TimeStepInfoMap[this->ActualTimeStep].FieldIndex;
+
+  // Files that do not depend on the piece are the same on all the processes.
+  // They are loaded once here, see ReadFileCollectively.
+  vtkSmartPointer<vtkCharArray> sharedGeometryBuffer;
+  vtkSmartPointer<vtkCharArray> sharedFieldBuffer;
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  vtkMPIController* controller = vtkMPIController::SafeDownCast(this->Controller);
+  vtkMPICommunicator* communicator =
+    controller ? vtkMPICommunicator::SafeDownCast(controller->GetCommunicator()) : nullptr;
+  const bool useMPIIO = this->UseCollectiveIO && communicator;
+  // Collective calls need all the processes of the controller. Without one
+  // process per piece, each reading the piece of its rank, some of them may
+  // not execute this request.
+  const bool useCollectiveIO = useMPIIO && controller->GetNumberOfProcesses() == numProcPieces &&
+    controller->GetLocalProcessId() == piece;
+  if (useCollectiveIO)
   {
-    if (geomHasTime && geomHasPiece)
-    {
-      auto result = vtk::format_to_n(geom_name, geom_name_sz, geometryPatternFormat,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].GeomIndex, loadingPiece + 1);
-      *result.out = '\0';
-    }
-    else if (geomHasPiece)
-    {
-      auto result =
-        vtk::format_to_n(geom_name, geom_name_sz, geometryPatternFormat, loadingPiece + 1);
-      *result.out = '\0';
-    }
-    else if (geomHasTime)
-    {
-      auto result = vtk::format_to_n(geom_name, geom_name_sz, geometryPatternFormat,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].GeomIndex);
-      *result.out = '\0';
-    }
-    else
-    {
-      strncpy(geom_name, geometryPattern, geom_name_sz);
-      geom_name[geom_name_sz - 1] = '\0';
-    }
+    MPI_Comm comm = *communicator->GetMPIComm()->GetHandle();
 
-    if (fieldHasTime && fieldHasPiece)
-    {
-      auto result = vtk::format_to_n(field_name, field_name_sz, fieldPatternFormat,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].FieldIndex, loadingPiece + 1);
-      *result.out = '\0';
-    }
-    else if (fieldHasPiece)
+    // the geometry is not needed if all of the pieces are cached
+    int needGeometry = 0;
+    for (int loadingPiece = piece; loadingPiece < numPieces; loadingPiece += numProcPieces)
     {
-      auto result =
-        vtk::format_to_n(field_name, field_name_sz, fieldPatternFormat, loadingPiece + 1);
-      *result.out = '\0';
+      needGeometry |= this->Internal->CachedGrids.count(loadingPiece) == 0;
     }
-    else if (fieldHasTime)
+    if (!geomHasPiece)
     {
-      auto result = vtk::format_to_n(field_name, field_name_sz, fieldPatternFormat,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].FieldIndex);
-      *result.out = '\0';
-    }
-    else
-    {
-      strncpy(field_name, fieldPattern, field_name_sz);
-      field_name[field_name_sz - 1] = '\0';
-    }
-
-    std::ostringstream geomFName;
-    std::string gpath = vtksys::SystemTools::GetFilenamePath(geom_name);
-    if (gpath.empty() || !vtksys::SystemTools::FileIsFullPath(gpath.c_str()))
-    {
-      std::string path = vtksys::SystemTools::GetFilenamePath(this->FileName);
-      if (!path.empty())
+      int anyNeedGeometry = 0;
+      MPI_Allreduce(&needGeometry, &anyNeedGeometry, 1, MPI_INT, MPI_MAX, comm);
+      if (anyNeedGeometry)
       {
-        geomFName << path.c_str() << "/";
+        sharedGeometryBuffer = ::ReadFileCollectively(comm,
+          ::GetPhastaFileName(this->FileName, geometryPattern, geometryPatternFormat, false,
+            geomHasTime, geomIndex, 0));
       }
     }
-    geomFName << geom_name << ends;
-    this->Reader->SetGeometryFileName(geomFName.str().c_str());
-
-    std::ostringstream fieldFName;
-    std::string fpath = vtksys::SystemTools::GetFilenamePath(field_name);
-    if (fpath.empty() || !vtksys::SystemTools::FileIsFullPath(fpath.c_str()))
+    if (!fieldHasPiece)
     {
-      std::string path = vtksys::SystemTools::GetFilenamePath(this->FileName);
-      if (!path.empty())
-      {
-        fieldFName << path.c_str() << "/";
-      }
+      sharedFieldBuffer = ::ReadFileCollectively(comm,
+        ::GetPhastaFileName(
+          this->FileName, fieldPattern, fieldPatternFormat, false, fieldHasTime, fieldIndex, 0));
     }
-    fieldFName << field_name << ends;
-    this->Reader->SetFieldFileName(fieldFName.str().c_str());
+  }
+#endif
+
+  for (int loadingPiece = piece; loadingPiece < numPieces; loadingPiece += numProcPieces)
+  {
+    const std::string geomFName = ::GetPhastaFileName(this->FileName, geometryPattern,
+      geometryPatternFormat, geomHasPiece, geomHasTime, geomIndex, loadingPiece);
+    this->Reader->SetGeometryFileName(geomFName.c_str());
+
+    const std::string fieldFName = ::GetPhastaFileName(this->FileName, fieldPattern,
+      fieldPatternFormat, fieldHasPiece, fieldHasTime, fieldIndex, loadingPiece);
+    this->Reader->SetFieldFileName(fieldFName.c_str());
 
     vtkPPhastaReaderInternal::CachedGridsMapType::iterator CachedCopy =
       this->Internal->CachedGrids.find(loadingPiece);
@@ -294,6 +388,22 @@ int vtkPPhastaReader::RequestData(
       this->Reader->SetCachedGrid(CachedCopy->second);
     }
 
+    vtkSmartPointer<vtkCharArray> geometryBuffer = sharedGeometryBuffer;
+    vtkSmartPointer<vtkCharArray> fieldBuffer = sharedFieldBuffer;
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+    // files of a single piece are read whole with one request
+    if (useMPIIO && geomHasPiece && CachedCopy == this->Internal->CachedGrids.end())
+    {
+      geometryBuffer = ::ReadFileCollectively(MPI_COMM_SELF, geomFName);
+    }
+    if (useMPIIO && fieldHasPiece)
+    {
+      fieldBuffer = ::ReadFileCollectively(MPI_COMM_SELF, fieldFName);
+    }
+#endif
+    this->Reader->SetGeometryFileBuffer(geometryBuffer);
+    this->Reader->SetFieldFileBuffer(fieldBuffer);
+
     this->Reader->Update();
 
     if (CachedCopy == this->Internal->CachedGrids.end())
@@ -310,8 +420,9 @@ int vtkPPhastaReader::RequestData(
     MultiPieceDataSet->SetPiece(loadingPiece, copy);
   }
 
-  delete[] geom_name;
-  delete[] field_name;
+  // release the file contents
+  this->Reader->SetGeometryFileBuffer(nullptr);
+  this->Reader->SetFieldFileBuffer(nullptr);
 
   if (steps)
   {
@@ -596,4 +707,6 @@ void vtkPPhastaReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "TimeStepIndex: " << this->TimeStepIndex << endl;
   os << indent << "TimeStepRange: " << this->TimeStepRange[0] << " " << this->TimeStepRange[1]
      << endl;
+  os << indent << "UseCollectiveIO: " << this->UseCollectiveIO << endl;
+  os << indent << "Controller: " << this->Controller << endl;
 }
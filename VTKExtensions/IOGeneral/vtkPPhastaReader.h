@@ -111,6 +111,7 @@
 #include "vtkMultiBlockDataSetAlgorithm.h"
 #include "vtkPVVTKExtensionsIOGeneralModule.h" //needed for exports
 
+class vtkMultiProcessController;
 class vtkPVXMLParser;
 class vtkPhastaReader;
 
@@ -146,6 +147,35 @@ public:
   vtkGetVector2Macro(TimeStepRange, int);
   ///@}
 
+  ///@{
+  /**
+   * When running with MPI, load the Phasta files with MPI-IO instead of stdio.
+   * Files shared by all the processes (patterns without a piece entry) are
+   * read with one collective call on the Controller, the files of a piece are
+   * read whole with a single request. Falls back to stdio if a file cannot be
+   * read this way. Has no effect without MPI. Default is true.
+   *
+   * The collective reads are used only when the Controller has one process per
+   * requested piece and the local process reads the piece of its rank. All the
+   * processes of the Controller must then execute RequestData together. Set a
+   * sub-controller holding the processes that update the reader, or turn this
+   * off, when only some of them do.
+   */
+  vtkSetMacro(UseCollectiveIO, bool);
+  vtkGetMacro(UseCollectiveIO, bool);
+  vtkBooleanMacro(UseCollectiveIO, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the controller used for the collective reads. By default
+   * initialized to `vtkMultiProcessController::GetGlobalController` in the
+   * constructor.
+   */
+  void SetController(vtkMultiProcessController* controller);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  ///@}
+
   static int CanReadFile(const char* filename);
 
 protected:
@@ -171,6 +201,10 @@ protected:
 
   int ActualTimeStep;
 
+  bool UseCollectiveIO;
+
+  vtkMultiProcessController* Controller;
+
 private:
   vtkPPhastaReaderInternal* Internal;
 
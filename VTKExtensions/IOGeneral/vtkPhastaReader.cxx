@@ -6,6 +6,7 @@
 #include "vtkByteSwap.h"
 #include "vtkCellData.h"
 #include "vtkCellType.h" //added for constants such as VTK_TETRA etc...
+#include "vtkCharArray.h"
 #include "vtkDataArray.h"
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
@@ -21,7 +22,13 @@
 vtkStandardNewMacro(vtkPhastaReader);
 
 vtkCxxSetObjectMacro(vtkPhastaReader, CachedGrid, vtkUnstructuredGrid);
+vtkCxxSetObjectMacro(vtkPhastaReader, GeometryFileBuffer, vtkCharArray);
+vtkCxxSetObjectMacro(vtkPhastaReader, FieldFileBuffer, vtkCharArray);
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <map>
 #include <sstream>
 #include <string>
@@ -50,22 +57,178 @@ struct vtkPhastaReaderInternal
 
   typedef std::map<std::string, FieldInfo> FieldInfoMapType;
   FieldInfoMapType FieldInfoMap;
+
+  // A file opened by openfile. It is either a stdio stream or a buffer
+  // holding the whole file, with the subset of stdio used by phastaIO.
+  struct FileInfo
+  {
+    FILE* Stream = nullptr;
+    vtkSmartPointer<vtkCharArray> Buffer;
+    vtkIdType Position = 0;
+    bool EndOfFile = false;
+    int ByteOrder = 0;
+    std::string LastHeaderKey;
+
+    bool IsOpen() const { return this->Stream || this->Buffer; }
+
+    void Close()
+    {
+      if (this->Stream)
+      {
+        fclose(this->Stream);
+      }
+      *this = FileInfo();
+    }
+
+    vtkIdType GetBufferSize() const { return this->Buffer->GetNumberOfValues(); }
+
+    // Same as fgets, returns false when nothing could be read.
+    bool Gets(char* str, int num)
+    {
+      if (this->Stream)
+      {
+        return fgets(str, num, this->Stream) != nullptr;
+      }
+      const char* data = this->Buffer->GetPointer(0);
+      const vtkIdType size = this->GetBufferSize();
+      if (this->Position >= size)
+      {
+        this->EndOfFile = true;
+        return false;
+      }
+      int count = 0;
+      while (count < num - 1 && this->Position < size)
+      {
+        str[count] = data[this->Position++];
+        if (str[count++] == '\n')
+        {
+          break;
+        }
+      }
+      if (this->Position >= size && str[count - 1] != '\n')
+      {
+        this->EndOfFile = true;
+      }
+      str[count] = '\0';
+      return true;
+    }
+
+    // Same as fread.
+    size_t Read(void* ptr, size_t size, size_t count)
+    {
+      if (this->Stream)
+      {
+        return fread(ptr, size, count, this->Stream);
+      }
+      const vtkIdType available = std::max<vtkIdType>(this->GetBufferSize() - this->Position, 0);
+      const size_t read = std::min(count, static_cast<size_t>(available) / size);
+      if (read > 0)
+      {
+        memcpy(ptr, this->Buffer->GetPointer(this->Position), read * size);
+        this->Position += static_cast<vtkIdType>(read * size);
+      }
+      if (read < count)
+      {
+        this->Position = std::max(this->Position, this->GetBufferSize());
+        this->EndOfFile = true;
+      }
+      return read;
+    }
+
+    // Same as fseek for SEEK_SET and SEEK_CUR.
+    int Seek(long offset, int whence)
+    {
+      if (this->Stream)
+      {
+        return fseek(this->Stream, offset, whence);
+      }
+      const vtkIdType position = (whence == SEEK_CUR ? this->Position : 0) + offset;
+      if (position < 0)
+      {
+        return -1;
+      }
+      this->Position = position;
+      this->EndOfFile = false;
+      return 0;
+    }
+
+    bool AtEnd() const { return this->Stream ? feof(this->Stream) != 0 : this->EndOfFile; }
+
+    void ClearError()
+    {
+      if (this->Stream)
+      {
+        clearerr(this->Stream);
+      }
+      else
+      {
+        this->EndOfFile = false;
+      }
+    }
+
+    // Reads the next whitespace separated token of an ascii file and skips
+    // the whitespaces that follow it.
+    std::string NextToken()
+    {
+      const char* data = this->Buffer->GetPointer(0);
+      const vtkIdType size = this->GetBufferSize();
+      while (this->Position < size && isspace(data[this->Position]))
+      {
+        this->Position++;
+      }
+      const vtkIdType begin = this->Position;
+      while (this->Position < size && !isspace(data[this->Position]))
+      {
+        this->Position++;
+      }
+      std::string token(data + std::min(begin, size), data + std::min(this->Position, size));
+      while (this->Position < size && isspace(data[this->Position]))
+      {
+        this->Position++;
+      }
+      this->EndOfFile = this->Position >= size;
+      return token;
+    }
+
+    int ScanInt()
+    {
+      if (this->Stream)
+      {
+        auto result = vtk::scan<int>(this->Stream, "{:d}\n");
+        return result ? result->value() : 0;
+      }
+      return static_cast<int>(std::strtol(this->NextToken().c_str(), nullptr, 10));
+    }
+
+    double ScanDouble()
+    {
+      if (this->Stream)
+      {
+        auto result = vtk::scan<double>(this->Stream, "{:f}\n");
+        return result ? result->value() : 0;
+      }
+      return std::strtod(this->NextToken().c_str(), nullptr);
+    }
+  };
+
+  // Indexed by file descriptor - 1.
+  std::vector<FileInfo> Files;
+  int LastHeaderNotFound = 0;
+  int WrongEndian = 0;
+  int StrictError = 0;
+  int BinaryFormat = 0;
+
+  ~vtkPhastaReaderInternal()
+  {
+    for (FileInfo& file : this->Files)
+    {
+      file.Close();
+    }
+  }
 };
 
 // Begin of copy from phastaIO
 
-namespace
-{
-std::map<int, char*> LastHeaderKey;
-std::vector<FILE*> fileArray;
-std::vector<int> byte_order;
-std::vector<int> header_type;
-int LastHeaderNotFound = 0;
-int Wrong_Endian = 0;
-int Strict_Error = 0;
-int binary_format = 0;
-}
-
 // the caller has the responsibility to delete the returned string
 char* vtkPhastaReader::StringStripper(const char istring[])
 {
@@ -124,11 +287,11 @@ void vtkPhastaReader::isBinary(const char iotype[])
   char* fname = StringStripper(iotype);
   if (cscompare(fname, "binary"))
   {
-    ::binary_format = 1;
+    this->Internal->BinaryFormat = 1;
   }
   else
   {
-    ::binary_format = 0;
+    this->Internal->BinaryFormat = 0;
   }
   delete[] fname;
 }
@@ -162,25 +325,26 @@ size_t vtkPhastaReader::typeSize(const char typestring[])
 
 namespace
 {
-void xfgets(char* str, int num, FILE* stream)
+void xfgets(char* str, int num, vtkPhastaReaderInternal::FileInfo& file)
 {
-  if (fgets(str, num, stream) == nullptr)
+  if (!file.Gets(str, num))
   {
     vtkGenericWarningMacro(<< "Could not read or end of file" << endl);
   }
 }
 
-void xfread(void* ptr, size_t size, size_t count, FILE* stream)
+void xfread(void* ptr, size_t size, size_t count, vtkPhastaReaderInternal::FileInfo& file)
 {
-  if (fread(ptr, size, count, stream) != count)
+  if (file.Read(ptr, size, count) != count)
   {
     vtkGenericWarningMacro(<< "Could not read or end of file" << endl);
   }
 }
 }
 
-int vtkPhastaReader::readHeader(FILE* fileObject, const char phrase[], int* params, int expect)
+int vtkPhastaReader::readHeader(int fileIndex, const char phrase[], int* params, int expect)
 {
+  vtkPhastaReaderInternal::FileInfo& fileObject = this->Internal->Files[fileIndex];
   char* text_header;
   char* token;
   char Line[1024];
@@ -190,9 +354,9 @@ int vtkPhastaReader::readHeader(FILE* fileObject, const char phrase[], int* para
   int skip_size, integer_value;
   int rewind_count = 0;
 
-  if (!fgets(Line, 1024, fileObject) && feof(fileObject))
+  if (!fileObject.Gets(Line, 1024) && fileObject.AtEnd())
   {
-    if (fseek(fileObject, 0, SEEK_SET))
+    if (fileObject.Seek(0, SEEK_SET))
     {
       vtkErrorWithObjectMacro(nullptr, << "Failed to rewind input: " << strerror(errno) << endl);
       return 1;
@@ -226,19 +390,18 @@ int vtkPhastaReader::readHeader(FILE* fileObject, const char phrase[], int* para
       }
       else if (cscompare(token, "byteorder magic number"))
       {
-        if (::binary_format)
+        if (this->Internal->BinaryFormat)
         {
           xfread((void*)&integer_value, sizeof(int), 1, fileObject);
           xfread(&junk, sizeof(char), 1, fileObject);
           if (362436 != integer_value)
           {
-            ::Wrong_Endian = 1;
+            this->Internal->WrongEndian = 1;
           }
         }
         else
         {
-          auto result = vtk::scan<int>(fileObject, "{:d}\n");
-          integer_value = result ? result->value() : 0;
+          integer_value = fileObject.ScanInt();
         }
       }
       else
@@ -246,9 +409,9 @@ int vtkPhastaReader::readHeader(FILE* fileObject, const char phrase[], int* para
         /* some other header, so just skip over */
         token = strtok(nullptr, " ,;<>");
         VTK_FROM_CHARS_IF_ERROR_RETURN(token, skip_size, 1);
-        if (::binary_format)
+        if (this->Internal->BinaryFormat)
         {
-          fseek(fileObject, skip_size, SEEK_CUR);
+          fileObject.Seek(skip_size, SEEK_CUR);
         }
         else
         {
@@ -263,15 +426,15 @@ int vtkPhastaReader::readHeader(FILE* fileObject, const char phrase[], int* para
 
     if (!FOUND)
     {
-      if (!fgets(Line, 1024, fileObject) && feof(fileObject))
+      if (!fileObject.Gets(Line, 1024) && fileObject.AtEnd())
       {
-        if (fseek(fileObject, 0, SEEK_SET))
+        if (fileObject.Seek(0, SEEK_SET))
         {
           vtkErrorWithObjectMacro(
             nullptr, << "Failed to rewind input: " << strerror(errno) << endl);
           return 1;
         }
-        clearerr(fileObject);
+        fileObject.ClearError();
         rewind_count++;
         xfgets(Line, 1024, fileObject);
       }
@@ -303,7 +466,8 @@ void vtkPhastaReader::SwapArrayByteOrder(void* array, int nbytes, int nItems)
   }
 }
 
-void vtkPhastaReader::openfile(const char filename[], const char mode[], int* fileDescriptor)
+void vtkPhastaReader::openfile(
+  const char filename[], const char mode[], int* fileDescriptor, vtkCharArray* buffer)
 {
   FILE* file = nullptr;
   *fileDescriptor = 0;
@@ -315,41 +479,58 @@ void vtkPhastaReader::openfile(const char filename[], const char mode[], int* fi
 
   if (cscompare("read", imode))
   {
-    file = vtksys::SystemTools::Fopen(fname, "rb");
+    if (!buffer)
+    {
+      file = vtksys::SystemTools::Fopen(fname, "rb");
+    }
   }
   else if (cscompare("write", imode))
   {
     file = vtksys::SystemTools::Fopen(fname, "wb");
+    buffer = nullptr;
   }
   else if (cscompare("append", imode))
   {
     file = vtksys::SystemTools::Fopen(fname, "ab");
+    buffer = nullptr;
   }
 
-  if (!file)
+  if (!file && !buffer)
   {
     vtkGenericWarningMacro(<< "unable to open file : " << fname << endl);
   }
   else
   {
-    ::fileArray.push_back(file);
-    ::byte_order.push_back(0);
-    ::header_type.push_back(sizeof(int));
-    *fileDescriptor = static_cast<int>(::fileArray.size());
+    // reuse the descriptor of a closed file if any
+    std::vector<vtkPhastaReaderInternal::FileInfo>& files = this->Internal->Files;
+    auto slot = std::find_if(files.begin(), files.end(),
+      [](const vtkPhastaReaderInternal::FileInfo& info) { return !info.IsOpen(); });
+    if (slot == files.end())
+    {
+      slot = files.emplace(files.end());
+    }
+    slot->Stream = file;
+    slot->Buffer = buffer;
+    *fileDescriptor = static_cast<int>(slot - files.begin()) + 1;
   }
   delete[] imode;
 }
 
 void vtkPhastaReader::closefile(int* fileDescriptor, const char mode[])
 {
+  if (*fileDescriptor < 1 || *fileDescriptor > static_cast<int>(this->Internal->Files.size()))
+  {
+    return;
+  }
+  vtkPhastaReaderInternal::FileInfo& file = this->Internal->Files[*fileDescriptor - 1];
   char* imode = StringStripper(mode);
 
-  if (cscompare("write", imode) || cscompare("append", imode))
+  if (file.Stream && (cscompare("write", imode) || cscompare("append", imode)))
   {
-    fflush(::fileArray[*fileDescriptor - 1]);
+    fflush(file.Stream);
   }
 
-  fclose(::fileArray[*fileDescriptor - 1]);
+  file.Close();
   delete[] imode;
 }
 
@@ -357,10 +538,10 @@ void vtkPhastaReader::readheader(int* fileDescriptor, const char keyphrase[], vo
   int* nItems, const char datatype[], const char iotype[])
 {
   int filePtr = *fileDescriptor - 1;
-  FILE* fileObject;
   int* valueListInt;
 
-  if (*fileDescriptor < 1 || *fileDescriptor > (int)::fileArray.size())
+  if (*fileDescriptor < 1 || *fileDescriptor > static_cast<int>(this->Internal->Files.size()) ||
+    !this->Internal->Files[filePtr].IsOpen())
   {
     vtkGenericWarningMacro(<< "No file associated with Descriptor " << *fileDescriptor << "\n"
                            << "openfile function has to be called before \n"
@@ -368,12 +549,12 @@ void vtkPhastaReader::readheader(int* fileDescriptor, const char keyphrase[], vo
                            << "fatal error: cannot continue, returning out of call\n");
     return;
   }
+  vtkPhastaReaderInternal::FileInfo& file = this->Internal->Files[filePtr];
 
-  ::LastHeaderKey[filePtr] = const_cast<char*>(keyphrase);
-  ::LastHeaderNotFound = 0;
+  file.LastHeaderKey = keyphrase;
+  this->Internal->LastHeaderNotFound = 0;
 
-  fileObject = ::fileArray[filePtr];
-  ::Wrong_Endian = ::byte_order[filePtr];
+  this->Internal->WrongEndian = file.ByteOrder;
 
   isBinary(iotype);
   typeSize(datatype); // redundant call, just avoid a compiler warning.
@@ -382,13 +563,13 @@ void vtkPhastaReader::readheader(int* fileDescriptor, const char keyphrase[], vo
   // on the header line.
 
   valueListInt = static_cast<int*>(valueArray);
-  int ierr = readHeader(fileObject, keyphrase, valueListInt, *nItems);
+  int ierr = readHeader(filePtr, keyphrase, valueListInt, *nItems);
 
-  ::byte_order[filePtr] = ::Wrong_Endian;
+  file.ByteOrder = this->Internal->WrongEndian;
 
   if (ierr)
   {
-    ::LastHeaderNotFound = 1;
+    this->Internal->LastHeaderNotFound = 1;
   }
 }
 
@@ -396,10 +577,10 @@ void vtkPhastaReader::readdatablock(int* fileDescriptor, const char keyphrase[],
   int* nItems, const char datatype[], const char iotype[])
 {
   int filePtr = *fileDescriptor - 1;
-  FILE* fileObject;
   char junk;
 
-  if (*fileDescriptor < 1 || *fileDescriptor > (int)::fileArray.size())
+  if (*fileDescriptor < 1 || *fileDescriptor > static_cast<int>(this->Internal->Files.size()) ||
+    !this->Internal->Files[filePtr].IsOpen())
   {
     vtkGenericWarningMacro(<< "No file associated with Descriptor " << *fileDescriptor << "\n"
                            << "openfile function has to be called before \n"
@@ -407,41 +588,41 @@ void vtkPhastaReader::readdatablock(int* fileDescriptor, const char keyphrase[],
                            << "fatal error: cannot continue, returning out of call\n");
     return;
   }
+  vtkPhastaReaderInternal::FileInfo& fileObject = this->Internal->Files[filePtr];
 
   // error check..
   // since we require that a consistent header always precede the data block
   // let us check to see that it is actually the case.
 
-  if (!cscompare(::LastHeaderKey[filePtr], keyphrase))
+  if (!cscompare(fileObject.LastHeaderKey.c_str(), keyphrase))
   {
     vtkGenericWarningMacro(<< "Header not consistent with data block\n"
-                           << "Header: " << ::LastHeaderKey[filePtr] << "\n"
+                           << "Header: " << fileObject.LastHeaderKey << "\n"
                            << "DataBlock: " << keyphrase << "\n"
                            << "Please recheck read sequence \n");
-    if (::Strict_Error)
+    if (this->Internal->StrictError)
     {
       vtkGenericWarningMacro(<< "fatal error: cannot continue, returning out of call\n");
       return;
     }
   }
 
-  if (::LastHeaderNotFound)
+  if (this->Internal->LastHeaderNotFound)
   {
     return;
   }
 
-  fileObject = ::fileArray[filePtr];
-  ::Wrong_Endian = ::byte_order[filePtr];
+  this->Internal->WrongEndian = fileObject.ByteOrder;
 
   size_t type_size = typeSize(datatype);
   int nUnits = *nItems;
   isBinary(iotype);
 
-  if (::binary_format)
+  if (this->Internal->BinaryFormat)
   {
     xfread(valueArray, type_size, nUnits, fileObject);
     xfread(&junk, sizeof(char), 1, fileObject);
-    if (::Wrong_Endian)
+    if (this->Internal->WrongEndian)
     {
       SwapArrayByteOrder(valueArray, static_cast<int>(type_size), nUnits);
     }
@@ -454,12 +635,7 @@ void vtkPhastaReader::readdatablock(int* fileDescriptor, const char keyphrase[],
       auto intValueArray = static_cast<int*>(valueArray);
       for (int n = 0; n < nUnits; n++)
       {
-        auto result = vtk::scan<int>(fileObject, "{:d}\n");
-        intValueArray[n] = result ? result->value() : 0;
-        if (result)
-        {
-          intValueArray[n] = result->value();
-        }
+        intValueArray[n] = fileObject.ScanInt();
       }
     }
     else if (cscompare("double", ts1))
@@ -467,8 +643,7 @@ void vtkPhastaReader::readdatablock(int* fileDescriptor, const char keyphrase[],
       auto doubleValueArray = static_cast<double*>(valueArray);
       for (int n = 0; n < nUnits; n++)
       {
-        auto result = vtk::scan<double>(fileObject, "{:f}\n");
-        doubleValueArray[n] = result ? result->value() : 0;
+        doubleValueArray[n] = fileObject.ScanDouble();
       }
     }
     delete[] ts1;
@@ -484,6 +659,8 @@ vtkPhastaReader::vtkPhastaReader()
   this->SetNumberOfInputPorts(0);
   this->Internal = new vtkPhastaReaderInternal;
   this->CachedGrid = nullptr;
+  this->GeometryFileBuffer = nullptr;
+  this->FieldFileBuffer = nullptr;
 }
 
 vtkPhastaReader::~vtkPhastaReader()
@@ -492,6 +669,8 @@ vtkPhastaReader::~vtkPhastaReader()
   delete[] this->FieldFileName;
   delete this->Internal;
   this->SetCachedGrid(nullptr);
+  this->SetGeometryFileBuffer(nullptr);
+  this->SetFieldFileBuffer(nullptr);
 }
 
 void vtkPhastaReader::ClearFieldInfo()
@@ -626,7 +805,7 @@ void vtkPhastaReader::ReadGeomFile(
   int i, j, k, item;
   int geomfile;
 
-  openfile(geomFileName, "read", &geomfile);
+  openfile(geomFileName, "read", &geomfile, this->GeometryFileBuffer);
   // geomfile = vtksys::SystemTools::Fopen(GeometryFileName,"rb");
 
   if (!geomfile)
@@ -796,7 +975,7 @@ void vtkPhastaReader::ReadFieldFile(
   double* data;
   int fieldfile;
 
-  openfile(fieldFileName, "read", &fieldfile);
+  openfile(fieldFileName, "read", &fieldfile, this->FieldFileBuffer);
   // fieldfile = vtksys::SystemTools::Fopen(FieldFileName,"rb");
 
   if (!fieldfile)
@@ -889,7 +1068,7 @@ void vtkPhastaReader::ReadFieldFile(
   int item;
   int fieldfile;
 
-  openfile(fieldFileName, "read", &fieldfile);
+  openfile(fieldFileName, "read", &fieldfile, this->FieldFileBuffer);
   // fieldfile = vtksys::SystemTools::Fopen(FieldFileName,"rb");
 
   if (!fieldfile)
@@ -1172,4 +1351,6 @@ void vtkPhastaReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FieldFileName: " << (this->FieldFileName ? this->FieldFileName : "(none)")
      << endl;
   os << indent << "CachedGrid: " << this->CachedGrid << endl;
+  os << indent << "GeometryFileBuffer: " << this->GeometryFileBuffer << endl;
+  os << indent << "FieldFileBuffer: " << this->FieldFileBuffer << endl;
 }
@@ -17,6 +17,7 @@
 #include "vtkPVVTKExtensionsIOGeneralModule.h" //needed for exports
 #include "vtkUnstructuredGridAlgorithm.h"
 
+class vtkCharArray;
 class vtkUnstructuredGrid;
 class vtkPoints;
 class vtkDataSetAttributes;
@@ -59,6 +60,19 @@ public:
   void SetCachedGrid(vtkUnstructuredGrid*);
   vtkGetObjectMacro(CachedGrid, vtkUnstructuredGrid);
 
+  ///@{
+  /**
+   * Provide the content of the geometry or field file already loaded in
+   * memory, e.g. by a collective MPI-IO read in vtkPPhastaReader. When set,
+   * the file is parsed from this buffer instead of being opened with stdio.
+   * The file names are still used in messages. Set to nullptr to read from disk.
+   */
+  void SetGeometryFileBuffer(vtkCharArray*);
+  vtkGetObjectMacro(GeometryFileBuffer, vtkCharArray);
+  void SetFieldFileBuffer(vtkCharArray*);
+  vtkGetObjectMacro(FieldFileBuffer, vtkCharArray);
+  ///@}
+
 protected:
   vtkPhastaReader();
   ~vtkPhastaReader() override;
@@ -77,21 +91,31 @@ private:
   char* GeometryFileName;
   char* FieldFileName;
   vtkUnstructuredGrid* CachedGrid;
+  vtkCharArray* GeometryFileBuffer;
+  vtkCharArray* FieldFileBuffer;
 
   int NumberOfVariables; // number of variable in the field file
 
   static char* StringStripper(const char istring[]);
   static int cscompare(const char teststring[], const char targetstring[]);
-  static void isBinary(const char iotype[]);
   static size_t typeSize(const char typestring[]);
-  static int readHeader(FILE* fileObject, const char phrase[], int* params, int expect);
   static void SwapArrayByteOrder(void* array, int nbytes, int nItems);
-  static void openfile(const char filename[], const char mode[], int* fileDescriptor);
-  static void closefile(int* fileDescriptor, const char mode[]);
-  static void readheader(int* fileDescriptor, const char keyphrase[], void* valueArray, int* nItems,
+
+  ///@{
+  /**
+   * phastaIO functions. The state of the open files is kept in Internal so
+   * that several readers can be used at the same time.
+   */
+  void isBinary(const char iotype[]);
+  int readHeader(int fileIndex, const char phrase[], int* params, int expect);
+  void openfile(
+    const char filename[], const char mode[], int* fileDescriptor, vtkCharArray* buffer = nullptr);
+  void closefile(int* fileDescriptor, const char mode[]);
+  void readheader(int* fileDescriptor, const char keyphrase[], void* valueArray, int* nItems,
     const char datatype[], const char iotype[]);
-  static void readdatablock(int* fileDescriptor, const char keyphrase[], void* valueArray,
-    int* nItems, const char datatype[], const char iotype[]);
+  void readdatablock(int* fileDescriptor, const char keyphrase[], void* valueArray, int* nItems,
+    const char datatype[], const char iotype[]);
+  ///@}
 
   vtkPhastaReaderInternal* Internal;
 
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDummyController.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkSpyPlotReader.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::vector<vtkDataSet*> GetLeaves(vtkDataObject* data)
+{
+  std::vector<vtkDataSet*> leaves;
+  auto cd = vtkCompositeDataSet::SafeDownCast(data);
+  if (!cd)
+  {
+    return leaves;
+  }
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(cd->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    leaves.push_back(vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()));
+  }
+  return leaves;
+}
+
+// Returns true if both outputs have the same blocks with identical cell data.
+bool CompareOutputs(vtkDataObject* output, vtkDataObject* expected, const std::string& what)
+{
+  const auto leaves = GetLeaves(output);
+  const auto expectedLeaves = GetLeaves(expected);
+  if (leaves.empty() || leaves.size() != expectedLeaves.size())
+  {
+    std::cerr << what << ": expected " << expectedLeaves.size() << " blocks, got "
+              << leaves.size() << "." << std::endl;
+    return false;
+  }
+  for (size_t block = 0; block < leaves.size(); ++block)
+  {
+    vtkCellData* cd = leaves[block]->GetCellData();
+    vtkCellData* expectedCD = expectedLeaves[block]->GetCellData();
+    if (cd->GetNumberOfArrays() != expectedCD->GetNumberOfArrays())
+    {
+      std::cerr << what << ": wrong number of cell arrays in block " << block << "."
+                << std::endl;
+      return false;
+    }
+    for (int idx = 0; idx < expectedCD->GetNumberOfArrays(); ++idx)
+    {
+      vtkDataArray* expectedArray = expectedCD->GetArray(idx);
+      if (!expectedArray)
+      {
+        continue;
+      }
+      const char* name = expectedArray->GetName();
+      vtkDataArray* array = cd->GetArray(name);
+      if (!array || array->GetDataType() != expectedArray->GetDataType() ||
+        array->GetNumberOfValues() != expectedArray->GetNumberOfValues() ||
+        array->GetNumberOfComponents() != expectedArray->GetNumberOfComponents())
+      {
+        std::cerr << what << ": array '" << name << "' of block " << block << " differs."
+                  << std::endl;
+        return false;
+      }
+      for (vtkIdType cc = 0; cc < array->GetNumberOfValues(); ++cc)
+      {
+        const int nc = array->GetNumberOfComponents();
+        if (array->GetComponent(cc / nc, cc % nc) !=
+          expectedArray->GetComponent(cc / nc, cc % nc))
+        {
+          std::cerr << what << ": value " << cc << " of array '" << name << "' of block "
+                    << block << " differs." << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+// Switches time steps and toggles a cell array with the decoded array cache
+// enabled, and checks that the output is the same as without the cache.
+extern int TestSpyPlotReaderDecodedArrayCache(int argc, char* argv[])
+{
+  char* fname = vtkTestUtilities::ExpandDataFileName(
+    argc, argv, "Testing/Data/SPCTH/Dave_Karelitz_Small/spcth_a.0");
+
+  vtkNew<vtkDummyController> controller;
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  vtkNew<vtkSpyPlotReader> cached;
+  cached->SetGlobalController(controller);
+  cached->SetFileName(fname);
+  cached->SetDecodedArrayCacheSize(64);
+
+  vtkNew<vtkSpyPlotReader> reference;
+  reference->SetGlobalController(controller);
+  reference->SetFileName(fname);
+  delete[] fname;
+
+  cached->UpdateInformation();
+  reference->UpdateInformation();
+  vtkInformation* outInfo = cached->GetOutputInformation(0);
+  const int numTimeSteps = outInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  if (numTimeSteps < 2 || cached->GetNumberOfCellArrays() < 2)
+  {
+    std::cerr << "Expected a dataset with several time steps and cell arrays." << std::endl;
+    vtkMultiProcessController::SetGlobalController(nullptr);
+    return EXIT_FAILURE;
+  }
+  const double* timeSteps = outInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  const std::string toggled = cached->GetCellArrayName(0);
+
+  struct Step
+  {
+    int TimeStep;
+    bool Enabled;
+    const char* What;
+  };
+  const Step steps[] = {
+    { 0, true, "first time step" },
+    { numTimeSteps - 1, true, "last time step" },
+    { 0, true, "back to the first time step" },
+    { 0, false, "array disabled" },
+    { 0, true, "array enabled again" },
+    { numTimeSteps - 1, false, "last time step, array disabled" },
+    { numTimeSteps - 1, true, "last time step, array enabled again" },
+  };
+
+  int status = EXIT_SUCCESS;
+  for (const auto& step : steps)
+  {
+    for (vtkSpyPlotReader* reader : { cached.Get(), reference.Get() })
+    {
+      reader->SetCellArrayStatus(toggled.c_str(), step.Enabled ? 1 : 0);
+      reader->UpdateTimeStep(timeSteps[step.TimeStep]);
+    }
+    if (!CompareOutputs(cached->GetOutputDataObject(0), reference->GetOutputDataObject(0),
+          step.What))
+    {
+      status = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  return status;
+}
@@ -86,6 +86,7 @@ vtkSpyPlotReader::vtkSpyPlotReader()
   this->TimeStepRange[1] = 0;
   this->ComputeDerivedVariables = 1;
   this->DownConvertVolumeFraction = 1;
+  this->DecodedArrayCacheSize = 0;
   this->MergeXYZComponents = 1;
 
   // this has all of the processes.
@@ -1338,6 +1339,26 @@ void vtkSpyPlotReader::SetDownConvertVolumeFraction(int vf)
   this->Modified();
 }
 
+//-----------------------------------------------------------------------------
+void vtkSpyPlotReader::SetDecodedArrayCacheSize(int size)
+{
+  if (size == this->DecodedArrayCacheSize)
+  {
+    return;
+  }
+  vtkSpyPlotReaderMap::MapOfStringToSPCTH::iterator mapIt;
+  for (mapIt = this->Map->Files.begin(); mapIt != this->Map->Files.end(); ++mapIt)
+  {
+    // Only update the readers already created, GetReader sets up the others.
+    if (mapIt->second)
+    {
+      mapIt->second->SetDecodedArrayCacheSize(static_cast<vtkTypeInt64>(size) * 1024 * 1024);
+    }
+  }
+  // The cache does not change the output, so do not call Modified().
+  this->DecodedArrayCacheSize = size;
+}
+
 //-----------------------------------------------------------------------------
 void vtkSpyPlotReader::SetMergeXYZComponents(int merge)
 {
@@ -1381,6 +1402,8 @@ void vtkSpyPlotReader::PrintSelf(ostream& os, vtkIndent indent)
     os << "false" << endl;
   }
 
+  os << "DecodedArrayCacheSize: " << this->DecodedArrayCacheSize << endl;
+
   os << "MergeXYZComponents: ";
   if (this->MergeXYZComponents)
   {
@@ -170,6 +170,17 @@ public:
   vtkBooleanMacro(DownConvertVolumeFraction, int);
   ///@}
 
+  ///@{
+  /**
+   * Maximum memory, in MiB, used for each file to keep the decoded cell
+   * arrays of other time steps and of unselected arrays. Going back to a time
+   * step or selecting an array again then reuses them instead of decoding the
+   * file again. 0 by default, which disables the cache.
+   */
+  void SetDecodedArrayCacheSize(int size);
+  vtkGetMacro(DecodedArrayCacheSize, int);
+  ///@}
+
   ///@{
   /**
    * If true, the reader will calculate all derived variables it can given
@@ -382,6 +393,8 @@ protected:
 
   int DownConvertVolumeFraction;
 
+  int DecodedArrayCacheSize;
+
   bool TimeRequestedFromPipeline;
 
   int MergeXYZComponents;
@@ -136,6 +136,8 @@ vtkSpyPlotUniReader* vtkSpyPlotReaderMap::GetReader(
     // by later calls to the property setters on the vtkSpyPlotReader object.
     it->second->SetDownConvertVolumeFraction(parent->GetDownConvertVolumeFraction());
     it->second->SetGenerateMarkers(parent->GetGenerateMarkers());
+    it->second->SetDecodedArrayCacheSize(
+      static_cast<vtkTypeInt64>(parent->GetDecodedArrayCacheSize()) * 1024 * 1024);
   }
   return it->second;
 }
@@ -7,6 +7,8 @@
 #include "vtkFloatArray.h"
 #include "vtkIntArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkSpyPlotBlock.h"
 #include "vtkSpyPlotIStream.h"
 #include "vtkUnsignedCharArray.h"
@@ -14,8 +16,11 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/RegularExpression.hxx"
 
+#include <atomic>
 #include <iostream>
+#include <list>
 #include <sstream>
+#include <string>
 #include <vector>
 
 //=============================================================================
@@ -45,8 +50,41 @@ inline ostream& operator<<(ostream& os, const vtkSpyPlotWriteString& c)
   os.flush();
   return os;
 }
+
+template <class t>
+int vtkSpyPlotUniReaderRunLengthDataDecode(
+  vtkSpyPlotUniReader* self, const unsigned char* in, int inSize, t* out, int outSize, t scale = 1);
+
+// A compressed plane of a cell field, read from the file and waiting to be
+// decoded.
+struct vtkSpyPlotCompressedPlane
+{
+  size_t Offset;
+  int NumberOfBytes;
+  vtkDataArray* Array;
+  int PlaneIndex;
+  int PlaneSize;
+};
 }
 
+//-----------------------------------------------------------------------------
+// Decoded arrays released by the reader, most recently released first.
+class vtkSpyPlotUniReader::vtkDecodedArrayCache
+{
+public:
+  struct Entry
+  {
+    int Dump;
+    std::string Name;
+    int Block;
+    int Fixed;
+    vtkSmartPointer<vtkDataArray> Array;
+    vtkTypeInt64 Size;
+  };
+  std::list<Entry> Entries;
+  vtkTypeInt64 Size = 0;
+};
+
 //-----------------------------------------------------------------------------
 vtkSpyPlotUniReader::vtkSpyPlotUniReader()
 {
@@ -88,6 +126,8 @@ vtkSpyPlotUniReader::vtkSpyPlotUniReader()
   this->HaveInformation = 0;
   this->DownConvertVolumeFraction = 1;
   this->DataTypeChanged = 0;
+  this->DecodedArrayCacheSize = 0;
+  this->DecodedArrayCache = new vtkDecodedArrayCache;
   this->GeomTimeStep = -1; // Indicate that geometry will have to be loaded
   this->NeedToCheck = 1;   // Indicates non-geometric data needs to be checked
   if (!this->HaveInformation)
@@ -145,6 +185,7 @@ vtkSpyPlotUniReader::~vtkSpyPlotUniReader()
   }
   delete[] this->DataDumps;
   delete[] this->Blocks;
+  delete this->DecodedArrayCache;
   this->SetFileName(nullptr);
   this->SetCellArraySelection(nullptr);
 
@@ -201,6 +242,69 @@ void vtkSpyPlotUniReader::SetDownConvertVolumeFraction(int vf)
   this->DataTypeChanged = 1;
 }
 
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::SetDecodedArrayCacheSize(vtkTypeInt64 size)
+{
+  if (this->DecodedArrayCacheSize == size)
+  {
+    return;
+  }
+  this->DecodedArrayCacheSize = size;
+  this->PruneDecodedArrayCache();
+}
+
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::ReleaseCellFieldData(int dump, Variable* var, int block)
+{
+  vtkDataArray* array = var->DataBlocks[block];
+  if (!array)
+  {
+    return;
+  }
+  if (this->DecodedArrayCacheSize > 0)
+  {
+    vtkDecodedArrayCache::Entry entry{ dump, var->Name, block, var->GhostCellsFixed[block], array,
+      static_cast<vtkTypeInt64>(array->GetActualMemorySize()) * 1024 };
+    this->DecodedArrayCache->Size += entry.Size;
+    this->DecodedArrayCache->Entries.push_front(std::move(entry));
+  }
+  array->Delete();
+  var->DataBlocks[block] = nullptr;
+  this->PruneDecodedArrayCache();
+}
+
+//-----------------------------------------------------------------------------
+vtkDataArray* vtkSpyPlotUniReader::TakeCachedCellFieldData(
+  int dump, Variable* var, int block, int dataType, int* fixed)
+{
+  auto& entries = this->DecodedArrayCache->Entries;
+  for (auto it = entries.begin(); it != entries.end(); ++it)
+  {
+    if (it->Dump == dump && it->Block == block && it->Array->GetDataType() == dataType &&
+      it->Name == var->Name)
+    {
+      vtkDataArray* array = it->Array;
+      array->Register(this);
+      *fixed = it->Fixed;
+      this->DecodedArrayCache->Size -= it->Size;
+      entries.erase(it);
+      return array;
+    }
+  }
+  return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::PruneDecodedArrayCache()
+{
+  auto& entries = this->DecodedArrayCache->Entries;
+  while (!entries.empty() && this->DecodedArrayCache->Size > this->DecodedArrayCacheSize)
+  {
+    this->DecodedArrayCache->Size -= entries.back().Size;
+    entries.pop_back();
+  }
+}
+
 //-----------------------------------------------------------------------------
 int vtkSpyPlotUniReader::MakeCurrent()
 {
@@ -315,11 +419,7 @@ int vtkSpyPlotUniReader::MakeCurrent()
           int ca;
           for (ca = 0; ca < dp->ActualNumberOfBlocks; ++ca)
           {
-            if (cv->DataBlocks[ca])
-            {
-              cv->DataBlocks[ca]->Delete();
-              cv->DataBlocks[ca] = nullptr;
-            }
+            this->ReleaseCellFieldData(dump, cv, ca);
           }
           vtkDebugMacro("* Delete Data blocks for variable: " << cv->Name);
           delete[] cv->DataBlocks;
@@ -357,8 +457,7 @@ int vtkSpyPlotUniReader::MakeCurrent()
         int dataBlock;
         for (dataBlock = 0; dataBlock < dp->ActualNumberOfBlocks; ++dataBlock)
         {
-          var->DataBlocks[dataBlock]->Delete();
-          var->DataBlocks[dataBlock] = nullptr;
+          this->ReleaseCellFieldData(dump, var, dataBlock);
         }
         delete[] var->DataBlocks;
         var->DataBlocks = nullptr;
@@ -395,7 +494,11 @@ int vtkSpyPlotUniReader::MakeCurrent()
     // vtkDebugMacro( "  Field: " << fieldCnt << " / " << dp->NumVars
     // << " [" << var->Name << "]" );
     // vtkDebugMacro( "    Jump to: " << dp->SavedVariableOffsets[fieldCnt] );
+    // Read the compressed planes of all the blocks first, then decode them
+    // in parallel.
     spis.Seek(dp->SavedVariableOffsets[fieldCnt]);
+    std::vector<vtkSpyPlotCompressedPlane> planes;
+    size_t bufferSize = 0;
     int numBytes;
     int block;
     int actualBlockId = 0;
@@ -404,27 +507,36 @@ int vtkSpyPlotUniReader::MakeCurrent()
       vtkSpyPlotBlock* bk = this->Blocks + block;
       if (bk->IsAllocated())
       {
-        vtkFloatArray* floatArray = nullptr;
-        vtkUnsignedCharArray* unsignedCharArray = nullptr;
         vtkDataArray* dataArray = nullptr;
+        int fixed = 0;
+        bool decode = false;
         if (this->CellArraySelection->ArrayIsEnabled(var->Name) && !var->DataBlocks[actualBlockId])
         {
-          if (this->DownConvertVolumeFraction && this->IsVolumeFraction(var))
+          const bool unsignedChar = this->DownConvertVolumeFraction && this->IsVolumeFraction(var);
+          dataArray = this->TakeCachedCellFieldData(dump, var, actualBlockId,
+            unsignedChar ? VTK_UNSIGNED_CHAR : VTK_FLOAT, &fixed);
+          if (dataArray)
           {
-            unsignedCharArray = vtkUnsignedCharArray::New();
-            dataArray = unsignedCharArray;
+            vtkDebugMacro(" " << dataArray << " reused from cache: " << dataArray->GetName());
           }
           else
           {
-            floatArray = vtkFloatArray::New();
-            dataArray = floatArray;
+            if (unsignedChar)
+            {
+              dataArray = vtkUnsignedCharArray::New();
+            }
+            else
+            {
+              dataArray = vtkFloatArray::New();
+            }
+            dataArray->SetNumberOfComponents(1);
+            dataArray->SetNumberOfTuples(
+              bk->GetDimension(0) * bk->GetDimension(1) * bk->GetDimension(2));
+            dataArray->SetName(var->Name);
+            decode = true;
+            // vtkDebugMacro( "*** Create data array: "
+            // << dataArray->GetNumberOfTuples() );
           }
-          dataArray->SetNumberOfComponents(1);
-          dataArray->SetNumberOfTuples(
-            bk->GetDimension(0) * bk->GetDimension(1) * bk->GetDimension(2));
-          dataArray->SetName(var->Name);
-          // vtkDebugMacro( "*** Create data array: "
-          // << dataArray->GetNumberOfTuples() );
         }
         int zax;
         int bdims[3];
@@ -437,43 +549,69 @@ int vtkSpyPlotUniReader::MakeCurrent()
             vtkErrorMacro("Problem reading the number of bytes");
             return 0;
           }
-          if (static_cast<int>(arrayBuffer.size()) < numBytes)
-          {
-            arrayBuffer.resize(numBytes);
-          }
-          if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
+          if (!decode)
           {
-            vtkErrorMacro("Problem reading the bytes");
-            return 0;
+            spis.Seek(numBytes, true);
+            continue;
           }
-          if (floatArray)
+          if (arrayBuffer.size() < bufferSize + numBytes)
           {
-            float* ptr = floatArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
-            {
-              vtkErrorMacro("Problem RLD decoding float data array");
-              return 0;
-            }
+            arrayBuffer.resize(bufferSize + numBytes);
           }
-          if (unsignedCharArray)
+          if (!spis.ReadString(arrayBuffer.data() + bufferSize, numBytes))
           {
-            unsigned char* ptr = unsignedCharArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
-            {
-              vtkErrorMacro("Problem RLD decoding unsigned char data array");
-              return 0;
-            }
+            vtkErrorMacro("Problem reading the bytes");
+            return 0;
           }
+          planes.push_back(
+            vtkSpyPlotCompressedPlane{ bufferSize, numBytes, dataArray, zax, planeSize });
+          bufferSize += numBytes;
         }
         if (dataArray)
         {
           var->DataBlocks[actualBlockId] = dataArray;
-          var->GhostCellsFixed[actualBlockId] = 0;
+          var->GhostCellsFixed[actualBlockId] = fixed;
           vtkDebugMacro(" " << dataArray << " initialized: " << dataArray->GetName());
           actualBlockId++;
         }
       }
     }
+
+    std::atomic<bool> decodeFailed(false);
+    const unsigned char* buffer = arrayBuffer.data();
+    vtkSMPTools::For(0, static_cast<vtkIdType>(planes.size()), 1,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType cc = begin; cc < end && !decodeFailed; ++cc)
+        {
+          const vtkSpyPlotCompressedPlane& plane = planes[cc];
+          const unsigned char* in = buffer + plane.Offset;
+          const vtkIdType start = static_cast<vtkIdType>(plane.PlaneIndex) * plane.PlaneSize;
+          int result;
+          if (auto floatArray = vtkFloatArray::FastDownCast(plane.Array))
+          {
+            result = ::vtkSpyPlotUniReaderRunLengthDataDecode<float>(
+              nullptr, in, plane.NumberOfBytes, floatArray->GetPointer(start), plane.PlaneSize);
+          }
+          else
+          {
+            result = ::vtkSpyPlotUniReaderRunLengthDataDecode<unsigned char>(nullptr, in,
+              plane.NumberOfBytes,
+              vtkUnsignedCharArray::FastDownCast(plane.Array)->GetPointer(start), plane.PlaneSize,
+              static_cast<unsigned char>(255));
+          }
+          if (!result)
+          {
+            decodeFailed = true;
+          }
+        }
+      });
+    if (decodeFailed)
+    {
+      vtkErrorMacro("Problem RLD decoding data array " << var->Name
+                                                      << ". Too much data generated.");
+      return 0;
+    }
   }
 
   if (blocksUpdated && needMarkers)
@@ -675,7 +813,7 @@ namespace
 {
 template <class t>
 int vtkSpyPlotUniReaderRunLengthDataDecode(
-  vtkSpyPlotUniReader* self, const unsigned char* in, int inSize, t* out, int outSize, t scale = 1)
+  vtkSpyPlotUniReader* self, const unsigned char* in, int inSize, t* out, int outSize, t scale)
 {
   int outIndex = 0, inIndex = 0;
 
@@ -699,8 +837,12 @@ int vtkSpyPlotUniReaderRunLengthDataDecode(
       {
         if (outIndex >= outSize)
         {
-          vtkErrorWithObjectMacro(
-            self, "Problem doing RLD decode. Too much data generated. Expected: " << outSize);
+          // self is null when decoding from several threads, the caller reports the error.
+          if (self)
+          {
+            vtkErrorWithObjectMacro(
+              self, "Problem doing RLD decode. Too much data generated. Expected: " << outSize);
+          }
           return 0;
         }
         out[outIndex] = static_cast<t>(val * scale);
@@ -715,8 +857,12 @@ int vtkSpyPlotUniReaderRunLengthDataDecode(
       {
         if (outIndex >= outSize)
         {
-          vtkErrorWithObjectMacro(
-            self, "Problem doing RLD decode. Too much data generated. Expected: " << outSize);
+          // self is null when decoding from several threads, the caller reports the error.
+          if (self)
+          {
+            vtkErrorWithObjectMacro(
+              self, "Problem doing RLD decode. Too much data generated. Expected: " << outSize);
+          }
           return 0;
         }
         float val;
@@ -1349,6 +1495,7 @@ void vtkSpyPlotUniReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DataTypeChanged: " << this->DataTypeChanged << endl;
   os << indent << "NumberOfCellFields: " << this->NumberOfCellFields << endl;
   os << indent << "NeedToCheck: " << this->NeedToCheck << endl;
+  os << indent << "DecodedArrayCacheSize: " << this->DecodedArrayCacheSize << endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -223,6 +223,19 @@ public:
   vtkSetMacro(DataTypeChanged, int);
   void SetDownConvertVolumeFraction(int vf);
 
+  ///@{
+  /**
+   * Set/Get the maximum size, in bytes, of the decoded cell arrays kept once
+   * they are not needed anymore, i.e. arrays of other time steps or of
+   * unselected fields. The least recently released arrays are dropped first.
+   * They are reused instead of decoding the file again when going back to a
+   * time step or selecting a field again. Default is 0, which disables the
+   * cache.
+   */
+  void SetDecodedArrayCacheSize(vtkTypeInt64 size);
+  vtkGetMacro(DecodedArrayCacheSize, vtkTypeInt64);
+  ///@}
+
 protected:
   vtkSpyPlotUniReader();
   ~vtkSpyPlotUniReader() override;
@@ -243,6 +256,18 @@ private:
 
   vtkDataArray* GetMaterialField(const int& block, const int& materialIndex, const char* Id);
 
+  ///@{
+  /**
+   * Release the decoded array of a block of a variable, keeping it in the
+   * decoded array cache when enabled, or take it back from the cache.
+   * TakeCachedCellFieldData returns a new reference, or nullptr.
+   */
+  void ReleaseCellFieldData(int dump, Variable* var, int block);
+  vtkDataArray* TakeCachedCellFieldData(
+    int dump, Variable* var, int block, int dataType, int* fixed);
+  void PruneDecodedArrayCache();
+  ///@}
+
   // Header information
   char FileDescription[128];
   int FileVersion;
@@ -299,6 +324,10 @@ private:
   int DataTypeChanged;
   int DownConvertVolumeFraction;
 
+  vtkTypeInt64 DecodedArrayCacheSize;
+  class vtkDecodedArrayCache;
+  vtkDecodedArrayCache* DecodedArrayCache;
+
   int NumberOfCellFields;
 
   vtkDataArraySelection* CellArraySelection;